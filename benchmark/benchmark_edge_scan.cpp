@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <graph/container/traits/vob_graph_traits.hpp>
+#include <graph/container/traits/vol_graph_traits.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+
+using namespace std;
+using namespace graph;
+using namespace graph::container;
+
+using vov_int = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false>>;
+using vol_int = dynamic_graph<int, void, void, uint32_t, false, vol_graph_traits<int, void, void, uint32_t, false>>;
+using vob_int = dynamic_graph<int, void, void, uint32_t, false, vob_graph_traits<int, void, void, uint32_t, false>>;
+
+// Edges are generated round-robin over the sources so each vertex's adjacency grows incrementally,
+// as it would when a graph is built from a stream of edges.
+static vector<copyable_edge_t<uint32_t, int>> make_edges(uint32_t n, uint32_t avg_degree) {
+    vector<copyable_edge_t<uint32_t, int>> ee;
+    ee.reserve(static_cast<size_t>(n) * avg_degree);
+    uint64_t x = 88172645463325252ull;
+    for (uint32_t k = 0; k < avg_degree; ++k) {
+        for (uint32_t u = 0; u < n; ++u) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17; // xorshift
+            ee.push_back({u, static_cast<uint32_t>(x % n), static_cast<int>(k)});
+        }
+    }
+    return ee;
+}
+
+template <class G>
+static void scan_edges(benchmark::State& state, bool compact = false) {
+    const auto n  = static_cast<uint32_t>(state.range(0));
+    auto       ee = make_edges(n, 16);
+    G          g;
+    // vertex_count is passed so edges are appended in input order (no per-vertex reserve)
+    g.load_edges(ee, identity(), n);
+    if constexpr (requires { g.compact(); }) {
+        if (compact)
+            g.compact();
+    }
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (auto u : vertices(g)) {
+            for (auto uv : edges(g, u)) {
+                sum += edge_value(g, uv) + static_cast<int64_t>(target_id(g, uv));
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(num_edges(g)));
+}
+
+static void BM_EdgeScan_vov(benchmark::State& state) { scan_edges<vov_int>(state); }
+static void BM_EdgeScan_vol(benchmark::State& state) { scan_edges<vol_int>(state); }
+static void BM_EdgeScan_vob(benchmark::State& state) { scan_edges<vob_int>(state); }
+static void BM_EdgeScan_vob_compacted(benchmark::State& state) { scan_edges<vob_int>(state, true); }
+
+BENCHMARK(BM_EdgeScan_vov)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_EdgeScan_vol)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_EdgeScan_vob)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_EdgeScan_vob_compacted)->RangeMultiplier(10)->Range(1000, 100000);
+
+// Building the graph from the same streamed edges
+template <class G>
+static void load_edges(benchmark::State& state) {
+    const auto n  = static_cast<uint32_t>(state.range(0));
+    auto       ee = make_edges(n, 16);
+    for (auto _ : state) {
+        G g;
+        g.load_edges(ee, identity(), n);
+        benchmark::DoNotOptimize(g);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(ee.size()));
+}
+
+static void BM_LoadEdges_vov(benchmark::State& state) { load_edges<vov_int>(state); }
+static void BM_LoadEdges_vol(benchmark::State& state) { load_edges<vol_int>(state); }
+static void BM_LoadEdges_vob(benchmark::State& state) { load_edges<vob_int>(state); }
+
+BENCHMARK(BM_LoadEdges_vov)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_LoadEdges_vol)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_LoadEdges_vob)->RangeMultiplier(10)->Range(1000, 100000);
@@ -262,6 +262,28 @@ concept index_adjacency_list =
     adjacency_list<G> &&
     index_vertex_range<G>;
 
+/**
+ * @brief Concept for adjacency lists whose vertex descriptors hold the vertex index
+ * 
+ * Vertex ids are dense in [0, num_vertices(g)) and can be used directly as array
+ * indexes, which is what the algorithms in graph/algorithm need. Unlike
+ * index_adjacency_list it doesn't require vertices(g) to be a random access range
+ * (vertex_descriptor_view is forward-only), so vector/deque based graphs and
+ * compressed_graph satisfy it.
+ * 
+ * Requirements:
+ * - Must satisfy adjacency_list
+ * - vertex_t<G> is a random_access_descriptor
+ * - vertex_id_t<G> is integral
+ * 
+ * @tparam G Graph type
+ */
+template<typename G>
+concept index_descriptor_adjacency_list =
+    adjacency_list<G> &&
+    random_access_descriptor<vertex_t<G>> &&
+    std::integral<std::remove_cvref_t<vertex_id_t<G>>>;
+
 /**
  * @brief Concept for graphs with sourced adjacency list structure
  * 
@@ -0,0 +1,407 @@
+/**
+ * @file betweenness_centrality.hpp
+ * @brief Parallel Brandes betweenness centrality, exact or from sampled sources
+ *
+ * @code
+ *   std::vector<double> scores(num_vertices(g));
+ *   betweenness_centrality(g, scores);                                 // exact: every vertex is a source
+ *   betweenness_centrality(g, scores, {.samples = 256, .seed = 7});    // estimate from 256 random sources
+ *   betweenness_centrality(g, scores, std::vector<uint32_t>{0, 5, 9}); // from the given sources
+ *   betweenness_centrality(g, scores, [&g](auto&& uv) { return edge_value(g, uv); }); // weighted
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/algorithm/common_shortest_paths.hpp"
+#include "graph/detail/indexed_dary_heap.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  Brandes, "A Faster Algorithm for Betweenness Centrality" (2001). From each source s a BFS counts
+//  the shortest paths sigma[v] to every vertex, and then the dependencies
+//
+//    delta[v] = sum over the edges v->w with dist[w] = dist[v] + 1 of sigma[v] / sigma[w] * (1 + delta[w])
+//
+//  are accumulated in the reverse of the BFS order. The score of v is the sum of delta[v] over the
+//  sources other than v. The backward pass reads the out-edges of v again instead of keeping lists
+//  of predecessors, so both passes stream the same rows and no per-edge memory is allocated.
+//
+//  With an edge weight function the forward pass is Dijkstra instead of BFS: order holds the
+//  vertices in the order they're settled, and an edge v->w counts toward sigma[w] (and later toward
+//  delta[v]) when dist[v] + weight = dist[w]. Weights must be positive, so that every predecessor of
+//  a vertex is settled before it and its path count is final when it's settled.
+//
+//  Sources are handed out to workers one at a time through an atomic
+//  counter, since the cost of a search varies a lot. Each worker has its own distance, path count and
+//  dependency arrays, reset in O(vertices reached) after each source, and its own score array; the
+//  score arrays are summed at the end, so there are no atomics on the hot path.
+//
+//  The order in which a worker adds up its sources depends on the schedule, so with more than one
+//  thread the scores can differ between runs in the last bits.
+//
+//  With k sources out of n the sums are scaled by n / k. Exact scores use every vertex; a random
+//  sample of k sources gives an unbiased estimate (Brandes & Pich, "Centrality Estimation in Large
+//  Networks", 2007).
+
+namespace graph {
+
+/**
+ * @brief Options of betweenness_centrality
+ */
+struct betweenness_centrality_options {
+  /// Number of random sources when none are given; 0, or at least num_vertices(g), uses every vertex
+  size_t samples = 0;
+  /// Seed of the source sampling
+  uint64_t seed = 0x5eed;
+  /// Divide the scores by (n-1)(n-2), the number of ordered pairs of other vertices
+  bool normalize = false;
+  /// Every edge u->v has a matching v->u. Each path is then found from both ends, so the
+  /// unnormalized scores are halved.
+  bool symmetric = false;
+};
+
+namespace detail {
+  /// What a worker needs to run Brandes from one source after another
+  template <class VId, class T>
+  struct brandes_workspace {
+    static constexpr VId unreached = std::numeric_limits<VId>::max();
+
+    std::vector<VId>    dist;
+    std::vector<double> sigma;
+    std::vector<double> delta;
+    std::vector<VId>    order; // vertices in BFS order
+    std::vector<T>      scores;
+
+    explicit brandes_workspace(size_t n) : dist(n, unreached), sigma(n, 0.0), delta(n, 0.0), scores(n, T{0}) {
+      order.reserve(n);
+    }
+
+    // Add the dependencies of every vertex on source s to scores
+    template <class G>
+    void accumulate(G& g, VId s) {
+      order.clear();
+      order.push_back(s);
+      dist[static_cast<size_t>(s)]  = 0;
+      sigma[static_cast<size_t>(s)] = 1;
+      for (size_t head = 0; head < order.size(); ++head) {
+        const VId    v  = order[head];
+        const VId    dw = static_cast<VId>(dist[static_cast<size_t>(v)] + 1);
+        const double sv = sigma[static_cast<size_t>(v)];
+        for (auto&& vw : edges_of(g, v)) {
+          const size_t w = static_cast<size_t>(graph::target_id(g, vw));
+          if (dist[w] == unreached) {
+            dist[w] = dw;
+            order.push_back(static_cast<VId>(w));
+          }
+          if (dist[w] == dw)
+            sigma[w] += sv;
+        }
+      }
+
+      for (size_t i = order.size(); i-- > 0;) {
+        const size_t v  = static_cast<size_t>(order[i]);
+        const VId    dw = static_cast<VId>(dist[v] + 1);
+        double       dv = 0;
+        for (auto&& vw : edges_of(g, order[i])) {
+          const size_t w = static_cast<size_t>(graph::target_id(g, vw));
+          if (dist[w] == dw)
+            dv += (1 + delta[w]) / sigma[w];
+        }
+        delta[v] = dv * sigma[v];
+        if (i > 0)
+          scores[v] += static_cast<T>(delta[v]);
+      }
+
+      for (const VId v : order) {
+        dist[static_cast<size_t>(v)]  = unreached;
+        sigma[static_cast<size_t>(v)] = 0;
+        delta[static_cast<size_t>(v)] = 0;
+      }
+    }
+  };
+
+  /// brandes_workspace with a Dijkstra forward pass, for positive edge weights given by evf
+  template <class VId, class T, class D, class EVF>
+  struct weighted_brandes_workspace {
+    static constexpr D infinite = shortest_path_infinite_distance<D>();
+
+    EVF&                         evf;
+    std::vector<D>               dist;
+    std::vector<double>          sigma;
+    std::vector<double>          delta;
+    std::vector<VId>             order; // vertices in the order they're settled
+    std::vector<T>               scores;
+    indexed_dary_heap<D, VId, 4> queue;
+
+    weighted_brandes_workspace(size_t n, EVF& f)
+          : evf(f), dist(n, infinite), sigma(n, 0.0), delta(n, 0.0), scores(n, T{0}), queue(n) {
+      order.reserve(n);
+    }
+
+    template <class E>
+    D weight(const E& uv) {
+      const auto w = evf(uv);
+      if (!(w > 0))
+        throw graph_error("betweenness_centrality: edge weights must be positive");
+      return static_cast<D>(w);
+    }
+
+    // Add the dependencies of every vertex on source s to scores
+    template <class G>
+    void accumulate(G& g, VId s) {
+      order.clear();
+      dist[static_cast<size_t>(s)]  = D{0};
+      sigma[static_cast<size_t>(s)] = 1;
+      queue.push(s, D{0});
+      while (!queue.empty()) {
+        const auto [dv, v] = queue.pop();
+        order.push_back(v);
+        const double sv = sigma[static_cast<size_t>(v)];
+        for (auto&& vw : edges_of(g, v)) {
+          const size_t w  = static_cast<size_t>(graph::target_id(g, vw));
+          const D      dw = extend_path(dv, weight(vw));
+          if (dw < dist[w]) {
+            dist[w]  = dw;
+            sigma[w] = sv;
+            queue.push_or_decrease(static_cast<VId>(w), dw);
+          } else if (dw == dist[w] && dw != infinite) {
+            sigma[w] += sv;
+          }
+        }
+      }
+
+      for (size_t i = order.size(); i-- > 0;) {
+        const size_t v = static_cast<size_t>(order[i]);
+        double       dv = 0;
+        for (auto&& vw : edges_of(g, order[i])) {
+          const size_t w = static_cast<size_t>(graph::target_id(g, vw));
+          if (dist[w] != infinite && extend_path(dist[v], weight(vw)) == dist[w])
+            dv += (1 + delta[w]) / sigma[w];
+        }
+        delta[v] = dv * sigma[v];
+        if (i > 0)
+          scores[v] += static_cast<T>(delta[v]);
+      }
+
+      for (const VId v : order) {
+        dist[static_cast<size_t>(v)]  = infinite;
+        sigma[static_cast<size_t>(v)] = 0;
+        delta[static_cast<size_t>(v)] = 0;
+      }
+    }
+  };
+
+  // Runs space.accumulate(g, s) for each source on workers with a Space(n, args...) each, and
+  // writes the scaled sums of their scores
+  template <class Space, class G, class Scores, class... Args>
+  void brandes(G&                                                       g,
+               size_t                                                   n,
+               const std::vector<std::remove_cvref_t<vertex_id_t<G>>>& sources,
+               Scores&&                                                 scores,
+               const betweenness_centrality_options&                    options,
+               Args&... args) {
+    using T = std::ranges::range_value_t<Scores>;
+
+    const size_t       workers = std::min(hardware_threads(), sources.size());
+    std::vector<Space> spaces;
+    spaces.reserve(workers);
+    for (size_t w = 0; w < workers; ++w)
+      spaces.emplace_back(n, args...);
+
+    std::atomic<size_t> next{0};
+    parallel_for_chunks(
+          size_t{0}, workers,
+          [&](size_t lo, size_t, size_t) {
+            Space& space = spaces[lo];
+            for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < sources.size();
+                 i         = next.fetch_add(1, std::memory_order_relaxed))
+              space.accumulate(g, sources[i]);
+          },
+          1);
+
+    double scale = sources.empty() ? 0.0 : static_cast<double>(n) / static_cast<double>(sources.size());
+    if (options.normalize)
+      scale = n > 2 ? scale / (static_cast<double>(n - 1) * static_cast<double>(n - 2)) : 0.0;
+    else if (options.symmetric)
+      scale /= 2;
+
+    auto out = std::ranges::begin(scores);
+    parallel_for(
+          size_t{0}, n,
+          [&](size_t v) {
+            double sum = 0;
+            for (auto& space : spaces)
+              sum += static_cast<double>(space.scores[v]);
+            out[static_cast<std::ptrdiff_t>(v)] = static_cast<T>(sum * scale);
+          },
+          1 << 12);
+  }
+
+  // Checks that scores holds a score per vertex, and returns num_vertices(g)
+  template <class G, class Scores>
+  size_t check_brandes_scores(G& g, const Scores& scores) {
+    const size_t n = static_cast<size_t>(graph::num_vertices(g));
+    if (static_cast<size_t>(std::ranges::size(scores)) < n)
+      throw graph_error("betweenness_centrality: scores is smaller than num_vertices(g)");
+    return n;
+  }
+
+  // The ids of the given sources, each checked to be a vertex of g before it's narrowed to VId
+  template <class VId, class Sources>
+  std::vector<VId> given_sources(size_t n, Sources&& sources) {
+    std::vector<VId> ids;
+    for (auto&& s : sources) {
+      if (std::cmp_less(s, 0) || std::cmp_greater_equal(s, n))
+        throw graph_error("betweenness_centrality: source is not a vertex of g");
+      ids.push_back(static_cast<VId>(s));
+    }
+    return ids;
+  }
+
+  // Every vertex, or options.samples of them picked at random
+  template <class VId>
+  std::vector<VId> sampled_sources(size_t n, const betweenness_centrality_options& options) {
+    std::vector<VId> ids;
+    if (options.samples == 0 || options.samples >= n) {
+      ids.reserve(n);
+      for (size_t v = 0; v < n; ++v)
+        ids.push_back(static_cast<VId>(v));
+    } else {
+      // Selection sampling (Knuth's algorithm S): picks each k-subset with the same probability, in id order
+      std::mt19937_64 rng(options.seed);
+      ids.reserve(options.samples);
+      for (size_t v = 0; v < n && ids.size() < options.samples; ++v)
+        if (std::uniform_int_distribution<size_t>(0, n - v - 1)(rng) < options.samples - ids.size())
+          ids.push_back(static_cast<VId>(v));
+    }
+    return ids;
+  }
+
+  template <class G, class Scores>
+  void unweighted_brandes(G& g, size_t n, const std::vector<std::remove_cvref_t<vertex_id_t<G>>>& sources,
+                          Scores&& scores, const betweenness_centrality_options& options) {
+    using space = brandes_workspace<std::remove_cvref_t<vertex_id_t<G>>, std::ranges::range_value_t<Scores>>;
+    brandes<space>(g, n, sources, scores, options);
+  }
+
+  template <class G, class Scores, class EVF>
+  void weighted_brandes(G& g, size_t n, const std::vector<std::remove_cvref_t<vertex_id_t<G>>>& sources,
+                        Scores&& scores, EVF& evf, const betweenness_centrality_options& options) {
+    using VId   = std::remove_cvref_t<vertex_id_t<G>>;
+    using D     = std::remove_cvref_t<std::invoke_result_t<EVF&, edge_t<G>>>;
+    using space = weighted_brandes_workspace<VId, std::ranges::range_value_t<Scores>, D, EVF>;
+    brandes<space>(g, n, sources, scores, options, evf);
+  }
+} // namespace detail
+
+/**
+ * @brief Betweenness centrality accumulated from the given sources, in parallel over the sources.
+ *
+ * The sum of the dependencies on the sources is scaled by num_vertices(g) / size(sources): with
+ * every vertex as a source the scores are exact, and with a random sample they're an estimate.
+ * options.samples is ignored.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g)). Edges are unweighted.
+ * @param scores  Random access range of float or double, indexed by vertex id, with at least
+ *                num_vertices(g) elements. Receives the score of each vertex.
+ * @param sources Vertex ids to run from; a vertex may appear more than once
+ * @param options Normalization, and whether g is symmetric
+ * @throws graph_error if scores is too small or a source isn't a vertex of g
+ * @note Complexity: O(S (V + E)) work for S sources, and O(T V) memory for T threads
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Scores, std::ranges::input_range Sources>
+requires std::floating_point<std::ranges::range_value_t<Scores>> && std::integral<std::ranges::range_value_t<Sources>>
+void betweenness_centrality(G&& g, Scores&& scores, Sources&& sources, const betweenness_centrality_options& options = {}) {
+  const size_t n   = detail::check_brandes_scores(g, scores);
+  const auto   ids = detail::given_sources<std::remove_cvref_t<vertex_id_t<G>>>(n, sources);
+  detail::unweighted_brandes(g, n, ids, scores, options);
+}
+
+/**
+ * @brief Betweenness centrality from every vertex, or estimated from options.samples random
+ *        sources, in parallel over the sources.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g)). Edges are unweighted.
+ * @param scores  Random access range of float or double, indexed by vertex id, with at least
+ *                num_vertices(g) elements. Receives the score of each vertex.
+ * @param options Number of sampled sources and seed, normalization, and whether g is symmetric
+ * @throws graph_error if scores is too small
+ * @note Complexity: O(V (V + E)) work when exact, O(samples (V + E)) when sampled, and O(T V)
+ *       memory for T threads
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Scores>
+requires std::floating_point<std::ranges::range_value_t<Scores>>
+void betweenness_centrality(G&& g, Scores&& scores, const betweenness_centrality_options& options = {}) {
+  const size_t n   = detail::check_brandes_scores(g, scores);
+  const auto   ids = detail::sampled_sources<std::remove_cvref_t<vertex_id_t<G>>>(n, options);
+  detail::unweighted_brandes(g, n, ids, scores, options);
+}
+
+/**
+ * @brief Weighted betweenness centrality accumulated from the given sources, with a Dijkstra
+ *        forward pass from each.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g))
+ * @param scores  Random access range of float or double, indexed by vertex id, with at least
+ *                num_vertices(g) elements. Receives the score of each vertex.
+ * @param sources Vertex ids to run from; a vertex may appear more than once
+ * @param evf     Edge weight function, evf(uv); weights must be positive
+ * @param options Normalization, and whether g is symmetric (with v->u as heavy as u->v)
+ * @throws graph_error if scores is too small, a source isn't a vertex of g or a weight isn't positive
+ * @note Complexity: O(S (V + E) log V) work for S sources, and O(T V) memory for T threads
+ */
+template <index_descriptor_adjacency_list G,
+          std::ranges::random_access_range Scores,
+          std::ranges::input_range         Sources,
+          class EVF>
+requires std::floating_point<std::ranges::range_value_t<Scores>> &&
+         std::integral<std::ranges::range_value_t<Sources>> &&
+         std::is_arithmetic_v<std::remove_cvref_t<std::invoke_result_t<EVF&, edge_t<std::remove_reference_t<G>>>>>
+void betweenness_centrality(G&&                                   g,
+                            Scores&&                              scores,
+                            Sources&&                             sources,
+                            EVF&&                                 evf,
+                            const betweenness_centrality_options& options = {}) {
+  const size_t n   = detail::check_brandes_scores(g, scores);
+  const auto   ids = detail::given_sources<std::remove_cvref_t<vertex_id_t<G>>>(n, sources);
+  detail::weighted_brandes(g, n, ids, scores, evf, options);
+}
+
+/**
+ * @brief Weighted betweenness centrality from every vertex, or estimated from options.samples
+ *        random sources, with a Dijkstra forward pass from each.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g))
+ * @param scores  Random access range of float or double, indexed by vertex id, with at least
+ *                num_vertices(g) elements. Receives the score of each vertex.
+ * @param evf     Edge weight function, evf(uv); weights must be positive
+ * @param options Number of sampled sources and seed, normalization, and whether g is symmetric
+ * @throws graph_error if scores is too small or a weight isn't positive
+ * @note Complexity: O(V (V + E) log V) work when exact, O(samples (V + E) log V) when sampled, and
+ *       O(T V) memory for T threads
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Scores, class EVF>
+requires std::floating_point<std::ranges::range_value_t<Scores>> &&
+         std::is_arithmetic_v<std::remove_cvref_t<std::invoke_result_t<EVF&, edge_t<std::remove_reference_t<G>>>>>
+void betweenness_centrality(G&& g, Scores&& scores, EVF&& evf, const betweenness_centrality_options& options = {}) {
+  const size_t n   = detail::check_brandes_scores(g, scores);
+  const auto   ids = detail::sampled_sources<std::remove_cvref_t<vertex_id_t<G>>>(n, options);
+  detail::weighted_brandes(g, n, ids, scores, evf, options);
+}
+
+} // namespace graph
@@ -0,0 +1,250 @@
+/**
+ * @file bipartite_matching.hpp
+ * @brief Maximum matching of a bipartite graph by parallel Hopcroft-Karp
+ *
+ * @code
+ *   // Left vertices [0, nl) in partition 0, right vertices [nl, n) in partition 1
+ *   compressed_graph<void, void, void, uint32_t, uint32_t> g(edges, std::identity(), std::vector<uint32_t>{0, nl});
+ *   std::vector<uint32_t> mates(num_vertices(g));
+ *   size_t matched = maximum_bipartite_matching(g, mates);  // mates[v] == v when v is unmatched
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/detail/bitmap.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  The left vertices are those of partition 0 (vertices(g,0)) and the right vertices those of
+//  partition 1. Only the edges from a left vertex to a right vertex are used, so the edges may be
+//  stored from the left side only, or in both directions; edges within a side, and vertices of
+//  other partitions, are ignored.
+//
+//  The initial matching is greedy: each left vertex claims its first free right neighbor with a
+//  compare-and-swap, in parallel. Left vertices with one right neighbor go first, since they have
+//  no other choice; this is the one-sided form of the Karp-Sipser rule.
+//
+//  Hopcroft-Karp then works in phases, each O(E). A level-synchronous parallel BFS from the free
+//  left vertices layers the left vertices by their distance in alternating paths, stopping after
+//  the first layer that reaches a free right vertex. Then each free left vertex looks for an
+//  augmenting path along the layers by an iterative DFS, all of them in parallel: a right vertex
+//  is claimed with an atomic bit before its edge is followed, so paths found at once are vertex
+//  disjoint, and a left vertex that leads nowhere is marked dead for the rest of the phase. Each
+//  path found flips the mates along it. There are O(sqrt(V)) phases, so O(E sqrt(V)) work.
+//
+//  Which maximum matching is found depends on the thread schedule; its size doesn't.
+
+namespace graph {
+
+namespace detail {
+  // Vertex ids [first, last) of partition pid, which are contiguous
+  template <class G>
+  std::pair<size_t, size_t> partition_ids(G& g, size_t pid) {
+    auto&&       vs    = graph::vertices(g, pid);
+    const size_t count = static_cast<size_t>(std::ranges::distance(vs));
+    if (count == 0)
+      return {0, 0};
+    const size_t first = static_cast<size_t>(graph::vertex_id(g, *std::ranges::begin(vs)));
+    return {first, first + count};
+  }
+
+  // Hopcroft-Karp between left [l0, l1) and right [r0, r1); mate[v] is none for unmatched vertices.
+  // Returns the size of the matching.
+  template <class VId, class G>
+  size_t hopcroft_karp(G& g, size_t l0, size_t l1, size_t r0, size_t r1, std::vector<VId>& mate) {
+    constexpr VId    none  = std::numeric_limits<VId>::max();
+    constexpr size_t unset = std::numeric_limits<size_t>::max();
+    auto             right = [r0, r1](size_t v) { return v >= r0 && v < r1; };
+    auto             load  = [](auto& x) { return std::atomic_ref(x).load(std::memory_order_relaxed); };
+
+    // Greedy start: left vertices with one right neighbor, then the others
+    std::vector<size_t> right_degree(l1 - l0);
+    parallel_for(
+          l0, l1,
+          [&](size_t u) {
+            size_t d = 0;
+            for (auto&& uv : edges_of(g, u))
+              d += right(static_cast<size_t>(graph::target_id(g, uv)));
+            right_degree[u - l0] = d;
+          },
+          1024);
+    std::atomic<size_t> matched{0};
+    for (const bool single : {true, false})
+      parallel_for(
+            l0, l1,
+            [&](size_t u) {
+              if ((right_degree[u - l0] == 1) != single)
+                return;
+              for (auto&& uv : edges_of(g, u)) {
+                const size_t v = static_cast<size_t>(graph::target_id(g, uv));
+                VId          expected = none;
+                if (right(v) && std::atomic_ref(mate[v]).compare_exchange_strong(expected, static_cast<VId>(u),
+                                                                                 std::memory_order_relaxed)) {
+                  mate[u] = static_cast<VId>(v);
+                  matched.fetch_add(1, std::memory_order_relaxed);
+                  break;
+                }
+              }
+            },
+            1024);
+
+    std::vector<size_t>           dist(l1 - l0);
+    std::vector<VId>              frontier, roots;
+    std::vector<std::vector<VId>> found(hardware_threads());
+    bitmap                        claimed(r1 - r0);
+    for (;;) {
+      // Layer the left vertices by BFS from the free ones
+      frontier.clear();
+      for (size_t u = l0; u < l1; ++u) {
+        dist[u - l0] = mate[u] == none ? 0 : unset;
+        if (mate[u] == none)
+          frontier.push_back(static_cast<VId>(u));
+      }
+      roots = frontier;
+      std::atomic<bool> reached{false};
+      for (size_t d = 0; !frontier.empty() && !reached.load(); ++d) {
+        parallel_for_chunks(
+              size_t{0}, frontier.size(),
+              [&](size_t lo, size_t hi, size_t w) {
+                for (size_t i = lo; i < hi; ++i)
+                  for (auto&& uv : edges_of(g, frontier[i])) {
+                    const size_t v = static_cast<size_t>(graph::target_id(g, uv));
+                    if (!right(v))
+                      continue;
+                    const VId x = mate[v];
+                    if (x == none) {
+                      reached.store(true, std::memory_order_relaxed);
+                      continue;
+                    }
+                    size_t expected = unset;
+                    if (std::atomic_ref(dist[static_cast<size_t>(x) - l0])
+                              .compare_exchange_strong(expected, d + 1, std::memory_order_relaxed))
+                      found[w].push_back(x);
+                  }
+              },
+              256);
+        frontier.clear();
+        for (auto& f : found) {
+          frontier.insert(frontier.end(), f.begin(), f.end());
+          f.clear();
+        }
+      }
+      if (!reached.load())
+        break;
+
+      // Vertex-disjoint augmenting paths along the layers, from every free left vertex at once
+      claimed.clear();
+      const size_t before = matched.load();
+      parallel_for_chunks(
+            size_t{0}, roots.size(),
+            [&](size_t lo, size_t hi, size_t) {
+              using edge_range    = decltype(edges_of(g, VId{}));
+              using edge_iterator = std::ranges::iterator_t<edge_range>;
+              using edge_sentinel = std::ranges::sentinel_t<edge_range>;
+              struct frame {
+                VId           u;   // left vertex
+                VId           via; // right vertex matched to u that led here
+                edge_iterator it;
+                edge_sentinel last;
+              };
+              std::vector<frame> frames;
+              auto               push = [&](VId u, VId via) {
+                auto&& r = edges_of(g, u);
+                frames.push_back(frame{u, via, std::ranges::begin(r), std::ranges::end(r)});
+              };
+
+              for (size_t i = lo; i < hi; ++i) {
+                push(roots[i], none);
+                while (!frames.empty()) {
+                  frame&       top = frames.back();
+                  const size_t u   = static_cast<size_t>(top.u);
+                  if (top.it == top.last) {
+                    std::atomic_ref(dist[u - l0]).store(unset, std::memory_order_relaxed); // dead end
+                    frames.pop_back();
+                    continue;
+                  }
+                  const size_t v = static_cast<size_t>(graph::target_id(g, *top.it));
+                  ++top.it;
+                  if (!right(v))
+                    continue;
+                  const VId x = load(mate[v]);
+                  if (x != none && load(dist[static_cast<size_t>(x) - l0]) != dist[u - l0] + 1)
+                    continue;
+                  if (!claimed.atomic_test_and_set(v - r0))
+                    continue;
+                  if (x != none) {
+                    push(x, static_cast<VId>(v)); // may reallocate frames, invalidating top
+                    continue;
+                  }
+
+                  // Free right vertex: flip the path
+                  VId next = static_cast<VId>(v);
+                  for (auto f = frames.rbegin(); f != frames.rend(); ++f) {
+                    std::atomic_ref(mate[static_cast<size_t>(next)]).store(f->u, std::memory_order_relaxed);
+                    mate[static_cast<size_t>(f->u)] = next;
+                    next                            = f->via;
+                  }
+                  frames.clear();
+                  matched.fetch_add(1, std::memory_order_relaxed);
+                }
+              }
+            },
+            64);
+      if (matched.load() == before)
+        break;
+    }
+    return matched.load();
+  }
+} // namespace detail
+
+/**
+ * @brief Maximum matching of a bipartite graph, by parallel Hopcroft-Karp.
+ *
+ * @param g     Graph with vertex ids in [0, num_vertices(g)) and at least two partitions: the left
+ *              vertices in partition 0 and the right vertices in partition 1. Needs the edges from
+ *              each left vertex to its right neighbors.
+ * @param mates Random access range of integral values, indexed by vertex id, with at least
+ *              num_vertices(g) elements. Receives the vertex each vertex is matched to, or the vertex
+ *              itself if it's unmatched (including vertices outside partitions 0 and 1).
+ * @return The number of matched pairs
+ * @throws graph_error if mates is too small or g has fewer than two partitions
+ * @note Complexity: O(E sqrt(V)) work
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Mates>
+requires std::integral<std::ranges::range_value_t<Mates>>
+size_t maximum_bipartite_matching(G&& g, Mates&& mates) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  using M   = std::ranges::range_value_t<Mates>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(std::ranges::size(mates)) < n)
+    throw graph_error("maximum_bipartite_matching: mates is smaller than num_vertices(g)");
+  if (n > 0 && static_cast<size_t>(graph::num_partitions(g)) < 2)
+    throw graph_error("maximum_bipartite_matching: g needs two partitions, left and right");
+
+  const auto [l0, l1] = detail::partition_ids(g, size_t{0});
+  const auto [r0, r1] = detail::partition_ids(g, size_t{1});
+  std::vector<VId> mate(n, std::numeric_limits<VId>::max());
+  const size_t     matched = detail::hopcroft_karp<VId>(g, l0, l1, r0, r1, mate);
+
+  auto out = std::ranges::begin(mates);
+  for (size_t v = 0; v < n; ++v)
+    out[static_cast<std::ptrdiff_t>(v)] =
+          static_cast<M>(mate[v] == std::numeric_limits<VId>::max() ? static_cast<VId>(v) : mate[v]);
+  return matched;
+}
+
+} // namespace graph
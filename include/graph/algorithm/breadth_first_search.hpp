@@ -0,0 +1,282 @@
+/**
+ * @file breadth_first_search.hpp
+ * @brief Direction-optimizing breadth-first search for index graphs
+ *
+ * @code
+ *   std::vector<uint32_t> parents(num_vertices(g), no_parent);
+ *   size_t reached = breadth_first_search(g, seed, parents);
+ *
+ *   std::vector<int> levels(num_vertices(g), -1);
+ *   breadth_first_search_levels(g, seed, levels);
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <numeric>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/detail/bitmap.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  Each level is expanded either top-down, where the frontier is a queue of vertex ids and every
+//  edge out of it is checked, or bottom-up, where the frontier is a bitmap and every unvisited
+//  vertex looks through its in-edges for a parent in the frontier, stopping at the first one found.
+//  Bottom-up wins on the few large middle levels of low-diameter graphs, since most of the edges
+//  it would check are skipped. The switch uses the heuristics of Beamer, Asanovic & Patterson,
+//  "Direction-Optimizing Breadth-First Search" (SC'12):
+//
+//    top-down -> bottom-up  when m_f > m_u / alpha  (edges out of the frontier vs. unexplored edges)
+//    bottom-up -> top-down  when n_f < n / beta and the frontier is shrinking
+//
+//  Bottom-up needs the in-edges of a vertex. They come from in_edges(g,uid) when the graph has
+//  them (dynamic_graph with an in_edges_type, or compressed_graph once build_in_edges() has been
+//  called), or from edges(g,uid) when the caller says the graph is symmetric. Otherwise every
+//  level is expanded top-down.
+//
+//  Both directions run in parallel. Top-down claims vertices with an atomic test-and-set on the
+//  visited bitmap; bottom-up splits the vertices on bitmap word boundaries, so each word of the
+//  visited and next-frontier bitmaps has a single writer. Either way the output buffer is written
+//  once per reached vertex, by the thread that claimed it. The parent chosen for a vertex depends
+//  on the thread schedule, but its level doesn't.
+
+namespace graph {
+
+/**
+ * @brief Tuning options of breadth_first_search
+ */
+struct bfs_options {
+  /// Switch to bottom-up when the edges out of the frontier exceed the unexplored edges / alpha
+  double alpha = 15.0;
+  /// Switch back to top-down when the frontier has fewer than num_vertices / beta vertices
+  double beta = 18.0;
+  /// Every edge u->v has a matching v->u, so edges(g,v) can be used as the in-edges of v
+  bool symmetric = false;
+  /// Allow bottom-up levels. When false the search is a parallel top-down BFS.
+  bool direction_optimizing = true;
+};
+
+namespace detail {
+  /**
+   * @brief Direction-optimizing BFS from seed that calls visit(vid, parent_id, depth) once for
+   *        each reached vertex, including the seed (as its own parent, at depth 0).
+   *
+   * Calls for different vertices may run concurrently.
+   *
+   * @return The number of vertices reached
+   */
+  template <class G, class Visit>
+  size_t direction_optimizing_bfs(G& g, std::remove_cvref_t<vertex_id_t<G>> seed, const bfs_options& options,
+                                  Visit&& visit) {
+    using VId       = std::remove_cvref_t<vertex_id_t<G>>;
+    using word_type = bitmap::word_type;
+
+    const size_t n = static_cast<size_t>(graph::num_vertices(g));
+    if (static_cast<size_t>(seed) >= n)
+      throw graph_error("breadth_first_search: seed isn't a vertex of the graph");
+
+    const bool use_in_edges = !options.symmetric && in_edges_available(g);
+    const bool can_pull     = options.direction_optimizing && (use_in_edges || options.symmetric);
+
+    // Calls f(uid) for the source of each in-edge of vid until f returns true
+    auto find_in_neighbor = [&g, use_in_edges](VId vid, auto&& f) {
+      if constexpr (has_in_edges_by_id<G>) {
+        if (use_in_edges) {
+          for (auto&& e : in_edges_of(g, vid))
+            if (f(in_edge_source_id(g, e)))
+              return true;
+          return false;
+        }
+      }
+      for (auto&& uv : edges_of(g, vid))
+        if (f(static_cast<VId>(graph::target_id(g, uv))))
+          return true;
+      return false;
+    };
+
+    bitmap visited(n);
+    visited.set(static_cast<size_t>(seed));
+    visit(seed, seed, size_t{0});
+
+    const size_t                  workers = hardware_threads();
+    std::vector<std::vector<VId>> local(workers); // next frontier found by each worker
+    std::vector<size_t>           local_count(workers), local_edges(workers);
+
+    std::vector<VId> queue{seed};
+    bitmap           front, next_front; // only allocated once a level runs bottom-up
+    bool             bottom_up      = false;
+    size_t           frontier_size  = 1;
+    size_t           frontier_edges = degree_of(g, seed);
+    size_t           unexplored     = static_cast<size_t>(graph::num_edges(g));
+    size_t           reached        = 1;
+    unexplored -= std::min(unexplored, frontier_edges);
+
+    for (size_t depth = 1; frontier_size > 0; ++depth) {
+      const size_t prev_size = frontier_size;
+
+      if (can_pull && !bottom_up && static_cast<double>(frontier_edges) > static_cast<double>(unexplored) / options.alpha) {
+        if (front.size() != n) {
+          front.assign(n);
+          next_front.assign(n);
+        } else {
+          front.clear();
+        }
+        for (VId uid : queue)
+          front.set(static_cast<size_t>(uid));
+        bottom_up = true;
+      }
+
+      std::ranges::fill(local_count, size_t{0});
+      std::ranges::fill(local_edges, size_t{0});
+      size_t used = 0;
+
+      if (bottom_up) {
+        used = parallel_for_chunks(
+              size_t{0}, visited.num_words(),
+              [&](size_t lo, size_t hi, size_t w) {
+                size_t count = 0, degrees = 0;
+                for (size_t wi = lo; wi < hi; ++wi) {
+                  word_type todo = ~visited.word(wi);
+                  if (wi + 1 == visited.num_words() && n % bitmap::bits_per_word != 0)
+                    todo &= (word_type{1} << (n % bitmap::bits_per_word)) - 1;
+                  word_type found = 0;
+                  for (; todo != 0; todo &= todo - 1) {
+                    const int b   = std::countr_zero(todo);
+                    const VId vid = static_cast<VId>(wi * bitmap::bits_per_word + static_cast<size_t>(b));
+                    const bool hit = find_in_neighbor(vid, [&](VId uid) {
+                      if (!front.test(static_cast<size_t>(uid)))
+                        return false;
+                      visit(vid, uid, depth);
+                      return true;
+                    });
+                    if (hit) {
+                      found |= word_type{1} << b;
+                      ++count;
+                      degrees += degree_of(g, vid);
+                    }
+                  }
+                  next_front.word(wi) = found;
+                  visited.word(wi) |= found;
+                }
+                local_count[w] = count;
+                local_edges[w] = degrees;
+              },
+              64);
+        front.swap(next_front);
+      } else {
+        used = parallel_for_chunks(
+              size_t{0}, queue.size(),
+              [&](size_t lo, size_t hi, size_t w) {
+                auto&  out     = local[w];
+                size_t degrees = 0;
+                out.clear();
+                for (size_t i = lo; i < hi; ++i) {
+                  const VId uid = queue[i];
+                  for (auto&& uv : edges_of(g, uid)) {
+                    const VId vid = static_cast<VId>(graph::target_id(g, uv));
+                    if (visited.atomic_test_and_set(static_cast<size_t>(vid))) {
+                      visit(vid, uid, depth);
+                      out.push_back(vid);
+                      degrees += degree_of(g, vid);
+                    }
+                  }
+                }
+                local_count[w] = out.size();
+                local_edges[w] = degrees;
+              },
+              256);
+      }
+
+      frontier_size  = std::reduce(local_count.begin(), local_count.begin() + static_cast<std::ptrdiff_t>(used), size_t{0});
+      frontier_edges = std::reduce(local_edges.begin(), local_edges.begin() + static_cast<std::ptrdiff_t>(used), size_t{0});
+      unexplored -= std::min(unexplored, frontier_edges);
+      reached += frontier_size;
+
+      if (bottom_up) {
+        if (static_cast<double>(frontier_size) < static_cast<double>(n) / options.beta && frontier_size < prev_size) {
+          queue.clear();
+          for (size_t wi = 0; wi < front.num_words(); ++wi)
+            for (word_type bits = front.word(wi); bits != 0; bits &= bits - 1)
+              queue.push_back(static_cast<VId>(wi * bitmap::bits_per_word + static_cast<size_t>(std::countr_zero(bits))));
+          bottom_up = false;
+        }
+      } else {
+        queue.clear();
+        for (size_t w = 0; w < used; ++w)
+          queue.insert(queue.end(), local[w].begin(), local[w].end());
+      }
+    }
+    return reached;
+  }
+
+  template <class G, class R>
+  void check_bfs_output(const G& g, const R& out) {
+    if (static_cast<size_t>(std::ranges::size(out)) < static_cast<size_t>(graph::num_vertices(g)))
+      throw graph_error("breadth_first_search: output buffer is smaller than num_vertices(g)");
+  }
+} // namespace detail
+
+/**
+ * @brief Breadth-first search from @c seed that writes the BFS tree into @c parents.
+ *
+ * parents[vid] is set to the id of the vertex vid was reached from, and parents[seed] to seed.
+ * Elements of vertices that aren't reached aren't written, so initialize the buffer with a value
+ * that isn't a vertex id to tell them apart.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g))
+ * @param seed    Id of the starting vertex
+ * @param parents Random access range indexed by vertex id, with at least num_vertices(g) elements
+ *                (e.g. std::vector, std::span or vertex_property_map)
+ * @param options Direction switching options; set @c symmetric for undirected graphs without in-edges
+ * @return The number of vertices reached, including the seed
+ * @throws graph_error if seed isn't a vertex of g or parents is too small
+ * @note Complexity: O(V + E) work, split across hardware threads
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Parents>
+requires std::integral<std::ranges::range_value_t<Parents>> &&
+         (!std::same_as<std::ranges::range_value_t<Parents>, bool>)
+size_t breadth_first_search(G&& g, const vertex_id_t<G>& seed, Parents&& parents, const bfs_options& options = {}) {
+  detail::check_bfs_output(g, parents);
+  using parent_type = std::ranges::range_value_t<Parents>;
+  auto out          = std::ranges::begin(parents);
+  return detail::direction_optimizing_bfs(g, seed, options, [out](auto vid, auto uid, size_t) {
+    out[static_cast<std::ptrdiff_t>(vid)] = static_cast<parent_type>(uid);
+  });
+}
+
+/**
+ * @brief Breadth-first search from @c seed that writes the distance of each vertex, in edges,
+ *        into @c levels.
+ *
+ * levels[seed] is 0. Elements of vertices that aren't reached aren't written.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g))
+ * @param seed    Id of the starting vertex
+ * @param levels  Random access range of integers indexed by vertex id, with at least num_vertices(g) elements
+ * @param options Direction switching options
+ * @return The number of vertices reached, including the seed
+ * @throws graph_error if seed isn't a vertex of g or levels is too small
+ * @note Complexity: O(V + E) work, split across hardware threads
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Levels>
+requires std::integral<std::ranges::range_value_t<Levels>> &&
+         (!std::same_as<std::ranges::range_value_t<Levels>, bool>)
+size_t breadth_first_search_levels(G&& g, const vertex_id_t<G>& seed, Levels&& levels, const bfs_options& options = {}) {
+  using level_type = std::ranges::range_value_t<Levels>;
+  detail::check_bfs_output(g, levels);
+  auto out        = std::ranges::begin(levels);
+  return detail::direction_optimizing_bfs(g, seed, options, [out](auto vid, auto, size_t depth) {
+    out[static_cast<std::ptrdiff_t>(vid)] = static_cast<level_type>(depth);
+  });
+}
+
+} // namespace graph
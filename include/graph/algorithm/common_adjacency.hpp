@@ -0,0 +1,98 @@
+/**
+ * @file common_adjacency.hpp
+ * @brief Access to the out- and in-edges of a vertex by id, shared by the index graph algorithms
+ */
+
+#pragma once
+
+#include <concepts>
+#include <ranges>
+#include <type_traits>
+#include "graph/graph.hpp"
+
+namespace graph::detail {
+
+/// The id type taken by the graph's own find_vertex(g,uid) and in_edges(g,uid): G::vertex_id_type when
+/// it's defined (dynamic_graph reports size_t ids through its descriptors but takes its VId), otherwise
+/// vertex_id_t<G>
+template <class G>
+struct native_vertex_id {
+  using type = std::remove_cvref_t<vertex_id_t<G>>;
+};
+
+template <class G>
+requires requires { typename std::remove_cvref_t<G>::vertex_id_type; }
+struct native_vertex_id<G> {
+  using type = typename std::remove_cvref_t<G>::vertex_id_type;
+};
+
+template <class G>
+using native_vertex_id_t = typename native_vertex_id<G>::type;
+
+template <class G, std::integral I>
+[[nodiscard]] constexpr native_vertex_id_t<G> native_id(I uid) noexcept {
+  if constexpr (std::same_as<I, native_vertex_id_t<G>>)
+    return uid;
+  else
+    return static_cast<native_vertex_id_t<G>>(uid);
+}
+
+/// Vertex descriptor of the vertex with id uid
+template <class G, std::integral I>
+[[nodiscard]] constexpr auto vertex_of(G& g, I uid) {
+  return *graph::find_vertex(g, native_id<G>(uid));
+}
+
+/// Out-edges of the vertex with id uid
+template <class G, std::integral I>
+[[nodiscard]] constexpr auto edges_of(G& g, I uid) {
+  return graph::edges(g, vertex_of(g, uid));
+}
+
+/// Number of out-edges of the vertex with id uid
+template <class G, std::integral I>
+[[nodiscard]] constexpr size_t degree_of(G& g, I uid) {
+  const auto d = graph::degree(g, vertex_of(g, uid));
+  if constexpr (std::same_as<std::remove_cv_t<decltype(d)>, size_t>)
+    return d;
+  else
+    return static_cast<size_t>(d);
+}
+
+template <class G>
+concept has_in_edges_by_id = requires(G& g, native_vertex_id_t<G> uid) {
+  { graph::in_edges(g, uid) } -> std::ranges::forward_range;
+};
+
+/// in_edges(g,uid) can be used: the graph has it, and if it's optional (compressed_graph::build_in_edges)
+/// it has been built
+template <class G>
+[[nodiscard]] constexpr bool in_edges_available(const G& g) noexcept {
+  if constexpr (!has_in_edges_by_id<G>)
+    return false;
+  else if constexpr (requires { { g.has_in_edges() } -> std::convertible_to<bool>; })
+    return g.has_in_edges();
+  else
+    return true;
+}
+
+/// In-edges of the vertex with id uid
+template <class G, std::integral I>
+requires has_in_edges_by_id<G>
+[[nodiscard]] constexpr decltype(auto) in_edges_of(G& g, I uid) {
+  return graph::in_edges(g, native_id<G>(uid));
+}
+
+// Source id of an element of in_edges(g,uid): dynamic_graph and compressed_graph yield ids, other graphs may yield edges
+template <class G, class E>
+[[nodiscard]] constexpr auto in_edge_source_id(G& g, const E& e) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  if constexpr (std::same_as<E, VId>)
+    return e;
+  else if constexpr (std::convertible_to<E, VId>)
+    return static_cast<VId>(e);
+  else
+    return static_cast<VId>(graph::source_id(g, e));
+}
+
+} // namespace graph::detail
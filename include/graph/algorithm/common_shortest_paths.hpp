@@ -0,0 +1,34 @@
+/**
+ * @file common_shortest_paths.hpp
+ * @brief Definitions shared by the shortest path algorithms
+ */
+
+#pragma once
+
+#include <concepts>
+#include <limits>
+
+namespace graph {
+
+/**
+ * @brief Distance of the vertices that aren't reached
+ */
+template <class D>
+[[nodiscard]] constexpr D shortest_path_infinite_distance() noexcept {
+  return std::numeric_limits<D>::max();
+}
+
+namespace detail {
+  /// Length of a path of length du extended by an edge of weight w. For integral distances it's
+  /// clamped to shortest_path_infinite_distance<D>() rather than wrapping around.
+  template <class D>
+  [[nodiscard]] constexpr D extend_path(D du, D w) noexcept {
+    if constexpr (std::integral<D>) {
+      if (w > shortest_path_infinite_distance<D>() - du)
+        return shortest_path_infinite_distance<D>();
+    }
+    return static_cast<D>(du + w);
+  }
+} // namespace detail
+
+} // namespace graph
@@ -0,0 +1,166 @@
+/**
+ * @file connected_components.hpp
+ * @brief Parallel connected components by Afforest
+ *
+ * @code
+ *   std::vector<uint32_t> labels(num_vertices(g));
+ *   size_t count = connected_components(g, labels);       // labels[v] = least vertex id in v's component
+ *   connected_components(g, labels, {.symmetric = true}); // every edge is stored in both directions
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/detail/parallel.hpp"
+#include "graph/detail/union_find.hpp"
+
+// NOTES
+//  Afforest (Sutton, Ben-Nun & Barak, "Optimizing Parallel Graph Connectivity Computation via
+//  Subgraph Sampling", IPDPS'18) is Shiloach-Vishkin linking applied to the edges in an order that
+//  makes most of them unnecessary:
+//
+//    1. Link each vertex to its first neighbor_rounds neighbors, compressing after each round.
+//       On most graphs this already joins the bulk of the giant component.
+//    2. Estimate the largest component from a random sample of vertices.
+//    3. Link the remaining edges of every vertex that isn't in that component. Its edges to
+//       vertices outside it still have to be linked, but none of its own edges do.
+//
+//  Step 3 skips an edge u->v with u in the largest component, which is only safe if the edge is
+//  also seen from v: the graph is symmetric, or v's in-edges are linked too. With in_edges(g,uid)
+//  (dynamic_graph with an in_edges_type, or compressed_graph after build_in_edges()) they are;
+//  otherwise the largest component is only skipped when the caller says the graph is symmetric,
+//  and all remaining edges are linked.
+//
+//  Components are weakly connected: edge direction is ignored. Links always point to the smaller
+//  root, so the label of each vertex is the least vertex id of its component, independent of the
+//  thread schedule.
+
+namespace graph {
+
+/**
+ * @brief Options of connected_components
+ */
+struct connected_components_options {
+  /// Neighbors of each vertex linked before the largest component is estimated
+  size_t neighbor_rounds = 2;
+  /// Vertices sampled to estimate the largest component
+  size_t samples = 1024;
+  /// Every edge u->v has a matching v->u
+  bool symmetric = false;
+};
+
+namespace detail {
+  // Most frequent root among a sample of vertices
+  template <class Id>
+  Id sample_frequent_root(const union_find<Id>& sets, size_t samples) {
+    const size_t                          n = sets.size();
+    std::mt19937                          rng(27491095);
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+    std::vector<Id>                       roots(samples);
+    for (Id& r : roots)
+      r = sets.parent(static_cast<Id>(pick(rng)));
+    std::ranges::sort(roots);
+    Id     best     = roots.front();
+    size_t best_run = 0;
+    for (size_t i = 0, j = 0; i < roots.size(); i = j) {
+      while (j < roots.size() && roots[j] == roots[i])
+        ++j;
+      if (j - i > best_run) {
+        best     = roots[i];
+        best_run = j - i;
+      }
+    }
+    return best;
+  }
+} // namespace detail
+
+/**
+ * @brief Label each vertex with its (weakly) connected component, in parallel.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g))
+ * @param labels  Random access range of integral values, indexed by vertex id, with at least
+ *                num_vertices(g) elements. Receives the least vertex id of each vertex's component.
+ * @param options Sampling rounds and whether g is symmetric
+ * @return The number of components
+ * @throws graph_error if labels is too small
+ * @note Complexity: O(V + E) work in practice, O((V + E) log V) worst case
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Labels>
+requires std::integral<std::ranges::range_value_t<Labels>>
+size_t connected_components(G&& g, Labels&& labels, const connected_components_options& options = {}) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  using L   = std::ranges::range_value_t<Labels>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(std::ranges::size(labels)) < n)
+    throw graph_error("connected_components: labels is smaller than num_vertices(g)");
+  if (n == 0)
+    return 0;
+
+  detail::union_find<VId> sets(n);
+
+  // Calls f(vid) for the targets of the edges of uid, from the first-th edge up to (not including) the last-th
+  auto for_each_neighbor = [&g](VId uid, size_t first, size_t last, auto&& f) {
+    auto&& uvs  = detail::edges_of(g, uid);
+    auto   it   = std::ranges::begin(uvs);
+    auto   stop = std::ranges::end(uvs);
+    std::ranges::advance(it, static_cast<std::ranges::range_difference_t<decltype(uvs)>>(first), stop);
+    for (size_t i = first; i < last && it != stop; ++i, ++it)
+      f(static_cast<VId>(graph::target_id(g, *it)));
+  };
+
+  // 1. Sample a few neighbors of each vertex
+  for (size_t r = 0; r < options.neighbor_rounds; ++r) {
+    detail::parallel_for(
+          size_t{0}, n,
+          [&](size_t i) {
+            const VId uid = static_cast<VId>(i);
+            for_each_neighbor(uid, r, r + 1, [&](VId vid) { sets.concurrent_unite(uid, vid); });
+          },
+          4096);
+    sets.compress();
+  }
+
+  // 2. Skip the largest component when its edges are seen from the other side too
+  const bool use_in_edges = !options.symmetric && detail::in_edges_available(g);
+  const bool can_skip     = options.neighbor_rounds > 0 && options.samples > 0 && (use_in_edges || options.symmetric);
+  const VId  skip         = can_skip ? detail::sample_frequent_root(sets, options.samples) : static_cast<VId>(n);
+
+  // 3. Link the remaining edges
+  detail::parallel_for(
+        size_t{0}, n,
+        [&](size_t i) {
+          const VId uid = static_cast<VId>(i);
+          if (can_skip && sets.concurrent_find(uid) == skip)
+            return;
+          auto link = [&](VId vid) { sets.concurrent_unite(uid, vid); };
+          for_each_neighbor(uid, options.neighbor_rounds, std::numeric_limits<size_t>::max(), link);
+          if constexpr (detail::has_in_edges_by_id<std::remove_reference_t<G>>) {
+            if (can_skip && use_in_edges)
+              for (auto&& e : detail::in_edges_of(g, uid))
+                link(detail::in_edge_source_id(g, e));
+          }
+        },
+        1024);
+  sets.compress();
+
+  auto out = std::ranges::begin(labels);
+  detail::parallel_for(
+        size_t{0}, n, [&](size_t i) { out[static_cast<std::ptrdiff_t>(i)] = static_cast<L>(sets.parent(static_cast<VId>(i))); },
+        1 << 14);
+  return sets.count();
+}
+
+} // namespace graph
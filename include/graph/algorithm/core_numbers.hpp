@@ -0,0 +1,270 @@
+/**
+ * @file core_numbers.hpp
+ * @brief k-core decomposition by bucket peeling, sequential or in parallel
+ *
+ * @code
+ *   std::vector<uint32_t> cores(num_vertices(g));
+ *   size_t degeneracy = core_numbers(g, cores);         // cores[v] = largest k with v in the k-core
+ *
+ *   std::vector<uint32_t> order(num_vertices(g));
+ *   core_numbers(g, cores, order, {.parallel = true});  // and the degeneracy ordering
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  The graph is undirected: every edge u-v is stored as both u->v and v->u. The degree of a vertex
+//  counts its stored edges other than self-loops, so a duplicate edge counts twice. The k-core is
+//  the largest subgraph whose vertices all have degree >= k in it, and the core number of v is the
+//  largest k whose k-core holds v.
+//
+//  Sequentially, the vertices are kept sorted by current degree in one array with the start of
+//  each degree's bucket (Batagelj & Zaversnik, "An O(m) Algorithm for Cores Decomposition of
+//  Networks", 2003). The vertex of least degree is removed and each neighbor of higher degree is
+//  swapped to the front of its bucket and moved down one, in O(1). That's O(V + E) in all.
+//
+//  In parallel the peeling goes a level at a time (as in Kabir & Madduri's PKC). Level k starts with
+//  the remaining vertices of degree k, found by a scan. Removing them decrements the degrees of
+//  their neighbors with atomics, and the neighbors that drop to k form the next batch of the same
+//  level. A decrement that finds a degree at or below k is undone, so the degrees never fall below
+//  the level. Levels with no vertices are skipped, but each level costs a scan of the vertices:
+//  O(V * levels + E) work.
+//
+//  The removal order is a degeneracy ordering: each vertex has at most its core number of
+//  neighbors after it. Within a parallel batch vertices are sorted by id, so the parallel order
+//  doesn't depend on the thread schedule either (it can differ from the sequential one).
+
+namespace graph {
+
+/**
+ * @brief Options of core_numbers
+ */
+struct core_numbers_options {
+  /// Peel a level at a time in parallel instead of one vertex at a time
+  bool parallel = false;
+};
+
+namespace detail {
+  // Degrees without self-loops
+  template <class G>
+  std::vector<size_t> degrees_without_loops(G& g, size_t n) {
+    std::vector<size_t> degree(n);
+    parallel_for(
+          size_t{0}, n,
+          [&](size_t u) {
+            size_t d = 0;
+            for (auto&& uv : edges_of(g, u))
+              d += static_cast<size_t>(graph::target_id(g, uv)) != u;
+            degree[u] = d;
+          },
+          4096);
+    return degree;
+  }
+
+  // Batagelj-Zaversnik; calls removed(v, core) in removal order
+  template <class VId, class G, class Removed>
+  void peel_cores(G& g, size_t n, Removed&& removed) {
+    std::vector<size_t> degree = degrees_without_loops(g, n);
+    const size_t        max_d  = n == 0 ? 0 : *std::ranges::max_element(degree);
+
+    std::vector<size_t> bucket(max_d + 2, 0); // first position of each degree in vert
+    for (size_t v = 0; v < n; ++v)
+      ++bucket[degree[v] + 1];
+    for (size_t d = 0; d <= max_d; ++d)
+      bucket[d + 1] += bucket[d];
+    std::vector<size_t> pos(n);
+    std::vector<VId>    vert(n);
+    {
+      std::vector<size_t> next(bucket.begin(), bucket.end() - 1);
+      for (size_t v = 0; v < n; ++v) {
+        pos[v]       = next[degree[v]]++;
+        vert[pos[v]] = static_cast<VId>(v);
+      }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+      const size_t v = static_cast<size_t>(vert[i]);
+      removed(v, degree[v]);
+      for (auto&& vu : edges_of(g, v)) {
+        const size_t u = static_cast<size_t>(graph::target_id(g, vu));
+        if (degree[u] <= degree[v])
+          continue;
+        // Swap u with the first vertex of its bucket, then move the bucket boundary past it
+        const size_t du = degree[u];
+        const size_t pu = pos[u];
+        const size_t pw = bucket[du];
+        const size_t w  = static_cast<size_t>(vert[pw]);
+        if (u != w) {
+          pos[u]   = pw;
+          vert[pw] = static_cast<VId>(u);
+          pos[w]   = pu;
+          vert[pu] = static_cast<VId>(w);
+        }
+        ++bucket[du];
+        --degree[u];
+      }
+    }
+  }
+
+  // Level-synchronous peeling; calls removed(batch, core) for each batch in removal order
+  template <class VId, class G, class Removed>
+  void parallel_peel_cores(G& g, size_t n, Removed&& removed) {
+    constexpr size_t    unpeeled = std::numeric_limits<size_t>::max();
+    std::vector<size_t> degree   = degrees_without_loops(g, n);
+    std::vector<size_t> core(n, unpeeled);
+
+    std::vector<std::vector<VId>> found(hardware_threads());
+    std::vector<size_t>           least(hardware_threads());
+    std::vector<VId>              batch;
+    auto                          gather = [&] {
+      batch.clear();
+      for (auto& f : found) {
+        batch.insert(batch.end(), f.begin(), f.end());
+        f.clear();
+      }
+      std::ranges::sort(batch);
+    };
+
+    size_t left = n;
+    while (left > 0) {
+      // The level is the least degree left
+      std::ranges::fill(least, unpeeled);
+      parallel_for_chunks(
+            size_t{0}, n,
+            [&](size_t lo, size_t hi, size_t w) {
+              size_t m = unpeeled;
+              for (size_t v = lo; v < hi; ++v)
+                if (core[v] == unpeeled)
+                  m = std::min(m, degree[v]);
+              least[w] = m;
+            },
+            1 << 14);
+      const size_t k = *std::ranges::min_element(least);
+
+      parallel_for_chunks(
+            size_t{0}, n,
+            [&](size_t lo, size_t hi, size_t w) {
+              for (size_t v = lo; v < hi; ++v)
+                if (core[v] == unpeeled && degree[v] == k)
+                  found[w].push_back(static_cast<VId>(v));
+            },
+            1 << 14);
+      gather();
+
+      while (!batch.empty()) {
+        for (const VId v : batch)
+          core[static_cast<size_t>(v)] = k;
+        removed(batch, k);
+        left -= batch.size();
+        parallel_for_chunks(
+              size_t{0}, batch.size(),
+              [&](size_t lo, size_t hi, size_t w) {
+                for (size_t i = lo; i < hi; ++i)
+                  for (auto&& vu : edges_of(g, batch[i])) {
+                    const size_t            u = static_cast<size_t>(graph::target_id(g, vu));
+                    std::atomic_ref<size_t> du(degree[u]);
+                    if (du.load(std::memory_order_relaxed) <= k)
+                      continue;
+                    const size_t before = du.fetch_sub(1, std::memory_order_relaxed);
+                    if (before == k + 1)
+                      found[w].push_back(static_cast<VId>(u));
+                    else if (before <= k)
+                      du.fetch_add(1, std::memory_order_relaxed);
+                  }
+              },
+              256);
+        gather();
+      }
+    }
+  }
+
+  // Writes the core numbers and returns the degeneracy; calls peeled(v) in removal order
+  template <class G, class Cores, class Peeled>
+  size_t core_numbers_impl(G& g, Cores& cores, Peeled&& peeled, const core_numbers_options& options) {
+    using VId = std::remove_cvref_t<vertex_id_t<G>>;
+    using C   = std::ranges::range_value_t<Cores>;
+
+    const size_t n          = static_cast<size_t>(graph::num_vertices(g));
+    auto         out        = std::ranges::begin(cores);
+    size_t       degeneracy = 0;
+    auto         record     = [&](size_t v, size_t core) {
+      out[static_cast<std::ptrdiff_t>(v)] = static_cast<C>(core);
+      peeled(v);
+      degeneracy = std::max(degeneracy, core);
+    };
+
+    if (options.parallel)
+      parallel_peel_cores<VId>(g, n, [&](const std::vector<VId>& batch, size_t core) {
+        for (const VId v : batch)
+          record(static_cast<size_t>(v), core);
+      });
+    else
+      peel_cores<VId>(g, n, record);
+    return degeneracy;
+  }
+} // namespace detail
+
+/**
+ * @brief Core number of every vertex of an undirected graph.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g)) that stores every edge in both directions
+ * @param cores   Random access range of integral values, indexed by vertex id, with at least
+ *                num_vertices(g) elements. Receives the core number of each vertex.
+ * @param options Whether to peel in parallel
+ * @return The degeneracy of g: the largest core number, or 0 for an empty graph
+ * @throws graph_error if cores is too small
+ * @note Complexity: O(V + E) sequentially; O(V * levels + E) work in parallel
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Cores>
+requires std::integral<std::ranges::range_value_t<Cores>>
+size_t core_numbers(G&& g, Cores&& cores, const core_numbers_options& options = {}) {
+  if (static_cast<size_t>(std::ranges::size(cores)) < static_cast<size_t>(graph::num_vertices(g)))
+    throw graph_error("core_numbers: cores is smaller than num_vertices(g)");
+  return detail::core_numbers_impl(g, cores, [](size_t) {}, options);
+}
+
+/**
+ * @brief Core number of every vertex of an undirected graph, and a degeneracy ordering.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g)) that stores every edge in both directions
+ * @param cores   Random access range of integral values, indexed by vertex id, with at least
+ *                num_vertices(g) elements. Receives the core number of each vertex.
+ * @param order   Random access range of integral values with at least num_vertices(g) elements.
+ *                Receives the vertex ids in the order they were peeled; each vertex has at most its
+ *                core number of neighbors after it.
+ * @param options Whether to peel in parallel
+ * @return The degeneracy of g: the largest core number, or 0 for an empty graph
+ * @throws graph_error if cores or order is too small
+ * @note Complexity: O(V + E) sequentially; O(V * levels + E) work in parallel
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Cores, std::ranges::random_access_range Order>
+requires std::integral<std::ranges::range_value_t<Cores>> && std::integral<std::ranges::range_value_t<Order>>
+size_t core_numbers(G&& g, Cores&& cores, Order&& order, const core_numbers_options& options = {}) {
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(std::ranges::size(cores)) < n)
+    throw graph_error("core_numbers: cores is smaller than num_vertices(g)");
+  if (static_cast<size_t>(std::ranges::size(order)) < n)
+    throw graph_error("core_numbers: order is smaller than num_vertices(g)");
+  using O = std::ranges::range_value_t<Order>;
+
+  auto   out      = std::ranges::begin(order);
+  size_t position = 0;
+  return detail::core_numbers_impl(
+        g, cores, [&](size_t v) { out[static_cast<std::ptrdiff_t>(position++)] = static_cast<O>(v); }, options);
+}
+
+} // namespace graph
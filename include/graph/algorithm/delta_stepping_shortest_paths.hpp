@@ -0,0 +1,293 @@
+/**
+ * @file delta_stepping_shortest_paths.hpp
+ * @brief Parallel single-source shortest distances by delta-stepping
+ *
+ * @code
+ *   std::vector<double> distances(num_vertices(g));
+ *   delta_stepping_shortest_paths(g, seed, distances);               // delta chosen from the weights
+ *   delta_stepping_shortest_paths(g, seed, distances, {.delta = 50}); // explicit bucket width
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/algorithm/common_shortest_paths.hpp"
+#include "graph/detail/bitmap.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  Delta-stepping (Meyer & Sanders) relaxes vertices in buckets of tentative distance
+//  [i*delta, (i+1)*delta) rather than one at a time, so all the vertices of a bucket can be
+//  processed in parallel. Each bucket is processed in two phases:
+//
+//    light  Edges of weight <= delta are relaxed from the bucket's vertices. They can put vertices
+//           back into the same bucket, so the phase repeats until the bucket stays empty.
+//    heavy  Edges of weight > delta are relaxed once from every vertex the bucket settled. They
+//           can only reach later buckets.
+//
+//  Distances are lowered with an atomic compare-and-swap min. A vertex whose distance improves is
+//  appended to the worker's own bin for its new bucket; a vertex can be in several bins, and stale
+//  entries (whose distance has since moved to an earlier bucket) are skipped. The bins of all
+//  workers are gathered into the shared frontier of the next bucket between rounds.
+//
+//  Only a window of delta_stepping_bucket_window buckets has bins, reused cyclically, so memory
+//  doesn't grow with max distance / delta. A vertex filed beyond the window waits in its worker's
+//  overflow list; when the window runs out of vertices it moves to the first bucket in those
+//  lists, and the ones that now fall inside it are filed into their bins.
+//
+//  When the edges of each vertex are sorted by weight (e.g. a compressed_graph loaded that way),
+//  set edges_sorted_by_weight and the light phase stops at a vertex's first heavy edge.
+//
+//  With delta = the smallest edge weight this is Dijkstra's algorithm with ties processed
+//  together; with delta = infinity it's Bellman-Ford. The default picks max_weight / average
+//  degree, which Meyer & Sanders show is a good choice for random weights.
+//
+//  Only distances are computed. Since they're final, a predecessor of v is any u with an edge
+//  uv such that distances[u] + w(uv) == distances[v].
+
+namespace graph {
+
+/**
+ * @brief Options of delta_stepping_shortest_paths
+ */
+struct delta_stepping_options {
+  /// Width of a bucket of distances; 0 selects max edge weight / average degree
+  double delta = 0;
+  /// The edges of each vertex are in increasing weight order
+  bool edges_sorted_by_weight = false;
+};
+
+namespace detail {
+  /// Number of buckets that have bins at a time
+  inline constexpr size_t delta_stepping_bucket_window = 256;
+
+  /// Bucket width chosen from the edge weights of g: max weight / average degree, at least 1 for integer distances
+  template <class D, class G, class EVF>
+  double auto_delta(G& g, EVF& evf) {
+    const size_t n = static_cast<size_t>(graph::num_vertices(g));
+    if (n == 0)
+      return 1.0;
+    std::vector<double> local_max(hardware_threads(), 0.0);
+    std::vector<size_t> local_m(hardware_threads(), 0);
+    parallel_for_chunks(
+          size_t{0}, n,
+          [&](size_t lo, size_t hi, size_t w) {
+            double max_w = 0;
+            size_t m     = 0;
+            for (size_t uid = lo; uid < hi; ++uid) {
+              for (auto&& uv : detail::edges_of(g, uid)) {
+                max_w = std::max(max_w, static_cast<double>(evf(uv)));
+                ++m;
+              }
+            }
+            local_max[w] = max_w;
+            local_m[w]   = m;
+          },
+          4096);
+    const double max_w = *std::ranges::max_element(local_max);
+    size_t       m     = 0;
+    for (size_t x : local_m)
+      m += x;
+    const double avg_degree = std::max(1.0, static_cast<double>(m) / static_cast<double>(n));
+    double       delta      = max_w / avg_degree;
+    if constexpr (std::integral<D>)
+      delta = std::max(1.0, std::floor(delta));
+    return delta > 0 ? delta : 1.0;
+  }
+} // namespace detail
+
+/**
+ * @brief Shortest distances from @c seed computed in parallel by delta-stepping.
+ *
+ * @param g         Graph with vertex ids in [0, num_vertices(g))
+ * @param seed      Id of the source vertex
+ * @param distances Random access range of arithmetic values, indexed by vertex id, with at least
+ *                  num_vertices(g) elements. Every element is written; unreached vertices get
+ *                  shortest_path_infinite_distance<D>().
+ * @param evf       Edge weight function, evf(uv); weights must not be negative
+ * @param options   Bucket width and edge order
+ * @throws graph_error if seed isn't a vertex of g, distances is too small, delta is negative or an
+ *         edge weight is negative
+ * @note Complexity: O(V + E + L/delta) work for maximum distance L on random weights, in
+ *       O(L/delta) rounds that are each split across hardware threads
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Distances, class EVF>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Distances>> &&
+         std::same_as<std::ranges::range_reference_t<Distances>, std::ranges::range_value_t<Distances>&> &&
+         std::invocable<EVF&, edge_t<std::remove_reference_t<G>>>
+void delta_stepping_shortest_paths(G&&                           g,
+                                   const vertex_id_t<G>&         seed,
+                                   Distances&&                   distances,
+                                   EVF&&                         evf,
+                                   const delta_stepping_options& options = {}) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  using D   = std::ranges::range_value_t<Distances>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(seed) >= n)
+    throw graph_error("delta_stepping_shortest_paths: seed isn't a vertex of the graph");
+  if (static_cast<size_t>(std::ranges::size(distances)) < n)
+    throw graph_error("delta_stepping_shortest_paths: distances is smaller than num_vertices(g)");
+  if (options.delta < 0)
+    throw graph_error("delta_stepping_shortest_paths: delta is negative");
+
+  auto dist = std::ranges::begin(distances);
+  auto at   = [&dist](auto id) -> D& { return dist[static_cast<std::ptrdiff_t>(id)]; };
+  detail::parallel_for(size_t{0}, n, [&](size_t i) { at(i) = shortest_path_infinite_distance<D>(); }, 4096);
+  at(seed) = D{0};
+
+  const double delta  = options.delta > 0 ? options.delta : detail::auto_delta<D>(g, evf);
+  auto         bin_of = [delta](D d) { return static_cast<size_t>(static_cast<double>(d) / delta); };
+
+  const size_t     workers = detail::hardware_threads();
+  constexpr size_t window  = detail::delta_stepping_bucket_window;
+  size_t           base    = 0; // the window holds the buckets [base, base + window)
+  std::vector<std::vector<std::vector<VId>>> bins(workers, std::vector<std::vector<VId>>(window)); // bins[worker][bucket % window]
+  std::vector<std::vector<VId>>              overflow(workers); // vertices filed for buckets past the window
+  std::vector<std::vector<VId>>              settled(workers);  // vertices each worker took from the bucket
+  detail::bitmap                             in_settled(n);
+
+  // Lower the distance of the target of uv; if it improved, file it in the worker's bin for its bucket
+  auto relax = [&](D du, const auto& uv, const auto& w, size_t worker) {
+    if constexpr (std::is_signed_v<std::remove_cvref_t<decltype(w)>>) {
+      if (w < 0)
+        throw graph_error("delta_stepping_shortest_paths: negative edge weight");
+    }
+    const VId vid = static_cast<VId>(graph::target_id(g, uv));
+    const D   dv  = detail::extend_path(du, static_cast<D>(w));
+    if (detail::atomic_fetch_min(at(vid), dv)) {
+      const size_t b = bin_of(dv);
+      if (b < base + window)
+        bins[worker][b % window].push_back(vid);
+      else
+        overflow[worker].push_back(vid);
+    }
+  };
+
+  std::vector<VId> frontier{static_cast<VId>(seed)};
+  auto             take_bucket = [&](size_t b) {
+    for (auto& my_bins : bins) {
+      auto& bin = my_bins[b % window];
+      frontier.insert(frontier.end(), bin.begin(), bin.end());
+      bin.clear();
+    }
+  };
+
+  size_t bucket = 0;
+  for (;;) {
+    // Light phase, repeated while the bucket refills
+    while (!frontier.empty()) {
+      detail::parallel_for_chunks(
+            size_t{0}, frontier.size(),
+            [&](size_t lo, size_t hi, size_t worker) {
+              for (size_t i = lo; i < hi; ++i) {
+                const VId uid = frontier[i];
+                const D   du  = std::atomic_ref<D>(at(uid)).load(std::memory_order_relaxed);
+                if (bin_of(du) != bucket)
+                  continue; // stale: uid moved to an earlier bucket after it was filed here
+                if (in_settled.atomic_test_and_set(static_cast<size_t>(uid)))
+                  settled[worker].push_back(uid);
+                for (auto&& uv : detail::edges_of(g, uid)) {
+                  const auto w = evf(uv);
+                  if (static_cast<double>(w) > delta) {
+                    if (options.edges_sorted_by_weight)
+                      break;
+                    continue;
+                  }
+                  relax(du, uv, w, worker);
+                }
+              }
+            },
+            256);
+      frontier.clear();
+      take_bucket(bucket);
+    }
+
+    // Heavy phase: every vertex settled by this bucket, once
+    std::vector<VId> done;
+    for (auto& s : settled) {
+      done.insert(done.end(), s.begin(), s.end());
+      s.clear();
+    }
+    detail::parallel_for_chunks(
+          size_t{0}, done.size(),
+          [&](size_t lo, size_t hi, size_t worker) {
+            for (size_t i = lo; i < hi; ++i) {
+              const VId uid = done[i];
+              const D   du  = at(uid);
+              for (auto&& uv : detail::edges_of(g, uid)) {
+                const auto w = evf(uv);
+                if (static_cast<double>(w) > delta)
+                  relax(du, uv, w, worker);
+              }
+            }
+          },
+          256);
+    for (VId uid : done)
+      in_settled.reset(static_cast<size_t>(uid));
+
+    // Next non-empty bucket in the window
+    size_t next = std::numeric_limits<size_t>::max();
+    for (size_t b = bucket + 1; b < base + window && next == std::numeric_limits<size_t>::max(); ++b)
+      for (auto& my_bins : bins)
+        if (!my_bins[b % window].empty()) {
+          next = b;
+          break;
+        }
+
+    // Otherwise move the window to the first bucket waiting in the overflow lists. A vertex whose
+    // distance has since dropped into the old window was filed there too, and is done.
+    if (next == std::numeric_limits<size_t>::max()) {
+      std::vector<VId> waiting;
+      for (auto& o : overflow) {
+        for (VId vid : o)
+          if (bin_of(at(vid)) >= base + window)
+            waiting.push_back(vid);
+        o.clear();
+      }
+      if (waiting.empty())
+        break;
+      next = bin_of(at(waiting.front()));
+      for (VId vid : waiting)
+        next = std::min(next, bin_of(at(vid)));
+      base = next;
+      for (VId vid : waiting) {
+        const size_t b = bin_of(at(vid));
+        if (b < base + window)
+          bins[0][b % window].push_back(vid);
+        else
+          overflow[0].push_back(vid);
+      }
+    }
+    bucket = next;
+    take_bucket(bucket);
+  }
+}
+
+/**
+ * @brief Shortest distances from @c seed by delta-stepping, with edge_value(g,uv) as the weight of each edge.
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Distances>
+requires requires(G& g, const edge_t<std::remove_reference_t<G>>& uv) {
+  { graph::edge_value(g, uv) } -> std::convertible_to<std::ranges::range_value_t<Distances>>;
+}
+void delta_stepping_shortest_paths(G&&                           g,
+                                   const vertex_id_t<G>&         seed,
+                                   Distances&&                   distances,
+                                   const delta_stepping_options& options = {}) {
+  auto evf = [&g](const auto& uv) { return graph::edge_value(g, uv); };
+  delta_stepping_shortest_paths(g, seed, distances, evf, options);
+}
+
+} // namespace graph
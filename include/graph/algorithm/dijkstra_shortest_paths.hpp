@@ -0,0 +1,194 @@
+/**
+ * @file dijkstra_shortest_paths.hpp
+ * @brief Single-source shortest paths with non-negative edge weights
+ *
+ * @code
+ *   std::vector<double>   distances(num_vertices(g));
+ *   std::vector<uint32_t> predecessors(num_vertices(g));
+ *   dijkstra_shortest_paths(g, seed, distances, predecessors);  // weights from edge_value(g,uv)
+ *
+ *   dijkstra_shortest_paths(g, seed, distances, predecessors,
+ *                           [&g](const auto& uv) { return edge_value(g, uv).length; },
+ *                           {.target = goal});
+ *
+ *   std::vector<uint64_t> hops(num_vertices(g));                      // integral distances
+ *   dijkstra_shortest_paths<dijkstra_queue::radix_heap>(g, seed, hops, predecessors);
+ * @endcode
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/algorithm/common_shortest_paths.hpp"
+#include "graph/detail/indexed_dary_heap.hpp"
+#include "graph/detail/radix_heap.hpp"
+
+// NOTES
+//  The default queue is an indexed 4-ary heap with decrease-key, so it holds each vertex at most
+//  once and never more than num_vertices(g) entries, however dense the graph. For integer
+//  distances a radix heap can be used instead; it has no decrease-key and skips stale entries,
+//  but push is O(1) and pop only scans vectors, which is usually faster when weights are small
+//  integers. The queue is a template argument, so asking for a radix heap with floating point
+//  distances doesn't compile.
+//
+//  Integral distances saturate at shortest_path_infinite_distance<D>() instead of wrapping
+//  around, so a path too long for D leaves its end vertex unreached.
+//
+//  distances and predecessors are caller-supplied random access ranges indexed by vertex id,
+//  e.g. std::vector, std::span or vertex_property_map. Every element is written: unreached
+//  vertices get shortest_path_infinite_distance<D>() and are their own predecessor.
+
+namespace graph {
+
+/**
+ * @brief Priority queue used by dijkstra_shortest_paths
+ */
+enum class dijkstra_queue {
+  indexed_4ary_heap, ///< Indexed 4-ary heap with decrease-key; any arithmetic distance type
+  radix_heap,        ///< Radix heap; integral distance types only
+};
+
+/**
+ * @brief Options of dijkstra_shortest_paths
+ */
+struct dijkstra_options {
+  /// Stop as soon as the distance of this vertex is final. Vertices further away than the
+  /// target may be left with tentative distances.
+  std::optional<size_t> target = std::nullopt;
+};
+
+namespace detail {
+  template <dijkstra_queue Queue, class G, class VId, class D, class Dist, class Pred, class EVF>
+  size_t dijkstra_impl(G& g, VId seed, Dist dist, Pred pred, EVF& evf, const dijkstra_options& options) {
+    const size_t target  = options.target ? *options.target : std::numeric_limits<size_t>::max();
+    size_t       settled = 0;
+
+    // Relax the edges out of uid, calling update(vid, distance) for each improved distance
+    auto relax = [&](VId uid, D du, auto&& update) {
+      for (auto&& uv : detail::edges_of(g, uid)) {
+        const auto w = evf(uv);
+        if constexpr (std::is_signed_v<std::remove_cvref_t<decltype(w)>>) {
+          if (w < 0)
+            throw graph_error("dijkstra_shortest_paths: negative edge weight");
+        }
+        const VId vid = static_cast<VId>(graph::target_id(g, uv));
+        const D   dv  = extend_path(du, static_cast<D>(w));
+        if (dv < dist[static_cast<std::ptrdiff_t>(vid)]) {
+          dist[static_cast<std::ptrdiff_t>(vid)] = dv;
+          pred[static_cast<std::ptrdiff_t>(vid)] = static_cast<std::iter_value_t<Pred>>(uid);
+          update(vid, dv);
+        }
+      }
+    };
+
+    if constexpr (Queue == dijkstra_queue::radix_heap) {
+      using key_type = std::make_unsigned_t<D>;
+      radix_heap<key_type, VId> queue;
+      queue.push(seed, key_type{0});
+      while (!queue.empty()) {
+        const auto [key, uid] = queue.pop();
+        const D du            = static_cast<D>(key);
+        if (du != dist[static_cast<std::ptrdiff_t>(uid)])
+          continue; // stale entry, uid was reached again with a shorter distance
+        ++settled;
+        if (static_cast<size_t>(uid) == target)
+          break;
+        relax(uid, du, [&](VId vid, D dv) { queue.push(vid, static_cast<key_type>(dv)); });
+      }
+    } else {
+      indexed_dary_heap<D, VId, 4> queue(static_cast<size_t>(graph::num_vertices(g)));
+      queue.push(seed, D{0});
+      while (!queue.empty()) {
+        const auto [du, uid] = queue.pop();
+        ++settled;
+        if (static_cast<size_t>(uid) == target)
+          break;
+        relax(uid, du, [&](VId vid, D dv) { queue.push_or_decrease(vid, dv); });
+      }
+    }
+    return settled;
+  }
+} // namespace detail
+
+/**
+ * @brief Shortest paths from @c seed, with edge weights given by @c evf.
+ *
+ * @tparam Queue       Priority queue; dijkstra_queue::radix_heap needs an integral distance type
+ * @param g            Graph with vertex ids in [0, num_vertices(g))
+ * @param seed         Id of the source vertex
+ * @param distances    Random access range of arithmetic values, indexed by vertex id, with at least
+ *                     num_vertices(g) elements. Receives the length of the shortest path to each vertex.
+ * @param predecessors Random access range of vertex ids, indexed by vertex id, with at least
+ *                     num_vertices(g) elements. Receives the vertex before each vertex on its shortest path.
+ * @param evf          Edge weight function, evf(uv); weights must not be negative
+ * @param options      Early-exit target
+ * @return The number of vertices whose distance is final
+ * @throws graph_error if seed isn't a vertex of g, an output range is too small or an edge weight
+ *         is negative
+ * @note Complexity: O((V + E) log V) with the 4-ary heap
+ */
+template <dijkstra_queue Queue = dijkstra_queue::indexed_4ary_heap,
+          index_descriptor_adjacency_list G,
+          std::ranges::random_access_range Distances,
+          std::ranges::random_access_range Predecessors,
+          class EVF>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Distances>> &&
+         std::integral<std::ranges::range_value_t<Predecessors>> &&
+         std::invocable<EVF&, edge_t<std::remove_reference_t<G>>> &&
+         (Queue != dijkstra_queue::radix_heap || std::integral<std::ranges::range_value_t<Distances>>)
+size_t dijkstra_shortest_paths(G&&                     g,
+                               const vertex_id_t<G>&   seed,
+                               Distances&&             distances,
+                               Predecessors&&          predecessors,
+                               EVF&&                   evf,
+                               const dijkstra_options& options = {}) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  using D   = std::ranges::range_value_t<Distances>;
+  using P   = std::ranges::range_value_t<Predecessors>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(seed) >= n)
+    throw graph_error("dijkstra_shortest_paths: seed isn't a vertex of the graph");
+  if (static_cast<size_t>(std::ranges::size(distances)) < n || static_cast<size_t>(std::ranges::size(predecessors)) < n)
+    throw graph_error("dijkstra_shortest_paths: output range is smaller than num_vertices(g)");
+
+  auto dist = std::ranges::begin(distances);
+  auto pred = std::ranges::begin(predecessors);
+  for (size_t i = 0; i < n; ++i) {
+    dist[static_cast<std::ptrdiff_t>(i)] = shortest_path_infinite_distance<D>();
+    pred[static_cast<std::ptrdiff_t>(i)] = static_cast<P>(i);
+  }
+  dist[static_cast<std::ptrdiff_t>(seed)] = D{0};
+
+  return detail::dijkstra_impl<Queue, std::remove_reference_t<G>, VId, D>(g, static_cast<VId>(seed), dist, pred, evf, options);
+}
+
+/**
+ * @brief Shortest paths from @c seed, with edge_value(g,uv) as the weight of each edge.
+ */
+template <dijkstra_queue Queue = dijkstra_queue::indexed_4ary_heap,
+          index_descriptor_adjacency_list G,
+          std::ranges::random_access_range Distances,
+          std::ranges::random_access_range Predecessors>
+requires requires(G& g, const edge_t<std::remove_reference_t<G>>& uv) {
+  { graph::edge_value(g, uv) } -> std::convertible_to<std::ranges::range_value_t<Distances>>;
+} && (Queue != dijkstra_queue::radix_heap || std::integral<std::ranges::range_value_t<Distances>>)
+size_t dijkstra_shortest_paths(G&&                     g,
+                               const vertex_id_t<G>&   seed,
+                               Distances&&             distances,
+                               Predecessors&&          predecessors,
+                               const dijkstra_options& options = {}) {
+  auto evf = [&g](const auto& uv) { return graph::edge_value(g, uv); };
+  return dijkstra_shortest_paths<Queue>(g, seed, distances, predecessors, evf, options);
+}
+
+} // namespace graph
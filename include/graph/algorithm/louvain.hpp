@@ -0,0 +1,634 @@
+/**
+ * @file louvain.hpp
+ * @brief Community detection by parallel Louvain, with optional Leiden refinement
+ *
+ * @code
+ *   compressed_graph<double, void, void, uint32_t, uint32_t> g(...);  // every edge in both directions
+ *   std::vector<uint32_t> communities(num_vertices(g));
+ *   size_t count = louvain(g, communities);                          // communities[v] in [0, count)
+ *   double q     = modularity(g, communities);
+ *
+ *   louvain(g, communities, {.resolution = 0.5, .leiden = true});   // connected communities
+ *   louvain(h, communities, [](auto&&) { return 1.0; });            // unweighted graph
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/container/compressed_graph.hpp"
+#include "graph/detail/parallel.hpp"
+#include "graph/detail/union_find.hpp"
+
+// NOTES
+//  The graph is undirected: every edge u-v is stored as both u->v and v->u, with the same weight,
+//  and a self-loop is stored once. The weight k(u) of a vertex is the sum of its stored edge
+//  weights and 2m is the sum of k over all vertices. The modularity of a partition, with
+//  resolution r, is
+//
+//    Q = sum over communities C of  in(C) / 2m - r * (tot(C) / 2m)^2
+//
+//  where in(C) sums the weights of the stored edges with both ends in C and tot(C) sums k over C.
+//
+//  Each level moves vertices between communities, then contracts every community into one vertex
+//  of a new compressed_graph whose edge weights are the summed weights between communities (a
+//  community's internal weight becomes a self-loop), and repeats on that graph. The levels stop
+//  when no vertex moves, after max_levels, or when contraction wouldn't shrink the graph.
+//
+//  Local moving is parallel over chunks of vertices, as in Lu, Halappanavar & Kalyanaraman's
+//  Grappolo ("Parallel heuristics for scalable community detection", 2015). Each worker gathers
+//  the weights from a vertex to its neighboring communities in its own open-addressing hash
+//  table, which is cleared in the number of keys it holds, and moves the vertex to the community
+//  of the largest modularity gain. Community weights are updated with atomics and read without
+//  locks, so a pass sees some moves of other workers and not others. Two singletons that would
+//  swap into each other's community only merge into the one with the smaller id. Passes repeat
+//  until one gains less than tolerance in modularity or moves nothing. The moves depend on the
+//  thread schedule, so different runs can give different partitions of similar modularity.
+//
+//  With leiden set, each community is refined before contraction, as in Traag, Waltman & van Eck's
+//  Leiden algorithm ("From Louvain to Leiden: guaranteeing well-connected communities", 2019):
+//  within each community, vertices start as singletons, and a vertex that is still a singleton
+//  and well connected to its community joins the well-connected part, among those it has an edge
+//  to, of the largest gain (greedily rather than at random, so this step is deterministic; the
+//  communities are refined in parallel). The parts are contracted, and each new vertex starts the
+//  next level in the community of its part, so a bad merge can still be undone by moving the part
+//  out. Finally every community is split into its connected components, which can only raise the
+//  modularity, so the communities returned are always connected.
+//
+//  Communities are numbered from 0 in the order of their least vertex id.
+
+namespace graph {
+
+/**
+ * @brief Options of louvain
+ */
+struct louvain_options {
+  /// Resolution r of the modularity; above 1 favors more, smaller communities
+  double resolution = 1.0;
+  /// End a level once a local-moving pass gains less than this in modularity
+  double tolerance = 1e-6;
+  /// Most local-moving passes per level
+  size_t max_passes = 100;
+  /// Most levels of moving and contraction
+  size_t max_levels = 32;
+  /// Refine communities as in Leiden, and return only connected communities
+  bool leiden = false;
+};
+
+namespace detail {
+  // Map from community id to the weight of the edges to it, reused from vertex to vertex: clear()
+  // costs the number of keys added, not the capacity
+  template <class VId>
+  class community_weights {
+  public:
+    // Room for n keys; only while empty
+    void reserve(size_t n) {
+      size_t   capacity = 16;
+      unsigned bits     = 4;
+      while (capacity < 2 * n) {
+        capacity *= 2;
+        ++bits;
+      }
+      if (capacity > keys_.size()) {
+        keys_.assign(capacity, none);
+        values_.assign(capacity, 0.0);
+        shift_ = 64 - bits;
+      }
+    }
+
+    void add(VId key, double w) {
+      const size_t s = find(key);
+      if (keys_[s] == none) {
+        keys_[s]   = key;
+        values_[s] = 0.0;
+        used_.push_back(s);
+      }
+      values_[s] += w;
+    }
+
+    // The weight added for key, or 0
+    [[nodiscard]] double operator[](VId key) const {
+      const size_t s = find(key);
+      return keys_[s] == key ? values_[s] : 0.0;
+    }
+
+    // Calls f(key, weight) in the order the keys were added
+    template <class F>
+    void for_each(F&& f) const {
+      for (const size_t s : used_)
+        f(keys_[s], values_[s]);
+    }
+
+    void clear() {
+      for (const size_t s : used_)
+        keys_[s] = none;
+      used_.clear();
+    }
+
+  private:
+    static constexpr VId none = std::numeric_limits<VId>::max();
+
+    // Slot of key, or the empty slot where it would go (Fibonacci hashing, linear probing)
+    [[nodiscard]] size_t find(VId key) const {
+      const size_t mask = keys_.size() - 1;
+      size_t       s    = static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> shift_);
+      while (keys_[s] != none && keys_[s] != key)
+        s = (s + 1) & mask;
+      return s;
+    }
+
+    std::vector<VId>    keys_;
+    std::vector<double> values_;
+    std::vector<size_t> used_;
+    unsigned            shift_ = 60;
+  };
+
+  // A contracted level: one vertex per community, weighted edges between them
+  template <class VId>
+  using louvain_level_graph = container::compressed_graph<double, void, void, VId, size_t>;
+
+  // Weight of each vertex; returns their sum, 2m
+  template <class G, class WF>
+  double vertex_weights(G& g, size_t n, WF& weight, std::vector<double>& k) {
+    k.assign(n, 0.0);
+    parallel_for(
+          size_t{0}, n,
+          [&](size_t u) {
+            double sum = 0.0;
+            for (auto&& uv : edges_of(g, u)) {
+              const double w = weight(uv);
+              if (w < 0.0)
+                throw graph_error("louvain: negative edge weight");
+              sum += w;
+            }
+            k[u] = sum;
+          },
+          1024);
+    double total = 0.0;
+    for (const double x : k)
+      total += x;
+    return total;
+  }
+
+  // Modularity of a partition of a level given the total weight of each community
+  template <class VId, class G, class WF>
+  double level_modularity(G&                         g,
+                          size_t                     n,
+                          WF&                        weight,
+                          const std::vector<VId>&    comm,
+                          const std::vector<double>& tot,
+                          double                     m2,
+                          double                     resolution) {
+    std::vector<double> inside(hardware_threads(), 0.0);
+    parallel_for_chunks(
+          size_t{0}, n,
+          [&](size_t lo, size_t hi, size_t w) {
+            double sum = 0.0;
+            for (size_t u = lo; u < hi; ++u)
+              for (auto&& uv : edges_of(g, u))
+                if (comm[static_cast<size_t>(graph::target_id(g, uv))] == comm[u])
+                  sum += weight(uv);
+            inside[w] = sum;
+          },
+          1024);
+    double q = 0.0;
+    for (const double x : inside)
+      q += x / m2;
+    for (const double t : tot)
+      q -= resolution * (t / m2) * (t / m2);
+    return q;
+  }
+
+  // Renumber labels from 0 in order of first appearance; labels are < range. Returns the count.
+  template <class VId>
+  size_t renumber(std::vector<VId>& labels, size_t range) {
+    constexpr VId    none = std::numeric_limits<VId>::max();
+    std::vector<VId> dense(range, none);
+    size_t           count = 0;
+    for (VId& c : labels) {
+      VId& d = dense[static_cast<size_t>(c)];
+      if (d == none)
+        d = static_cast<VId>(count++);
+      c = d;
+    }
+    return count;
+  }
+
+  // Vertices grouped by label: members[first[c], first[c+1]) have label c, in increasing id
+  template <class VId>
+  void group_by_label(const std::vector<VId>& labels,
+                      size_t                  count,
+                      std::vector<size_t>&    first,
+                      std::vector<VId>&       members) {
+    first.assign(count + 1, 0);
+    for (const VId c : labels)
+      ++first[static_cast<size_t>(c) + 1];
+    for (size_t c = 0; c < count; ++c)
+      first[c + 1] += first[c];
+    std::vector<size_t> next(first.begin(), first.end() - 1);
+    members.assign(labels.size(), VId{});
+    for (size_t v = 0; v < labels.size(); ++v)
+      members[next[static_cast<size_t>(labels[v])]++] = static_cast<VId>(v);
+  }
+
+  // Calls f(lo, worker) for each of count items, handed out one at a time to the workers
+  template <class F>
+  void for_each_dynamic(size_t count, F&& f) {
+    std::atomic<size_t> next{0};
+    parallel_for_chunks(
+          size_t{0}, hardware_threads(),
+          [&](size_t worker, size_t, size_t) {
+            for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count;
+                 i        = next.fetch_add(1, std::memory_order_relaxed))
+              f(i, worker);
+          },
+          1);
+  }
+
+  // Local moving: passes of parallel moves from comm until the gain drops below tolerance
+  template <class VId, class G, class WF>
+  void move_vertices(G&                                   g,
+                     size_t                               n,
+                     WF&                                  weight,
+                     const std::vector<double>&           k,
+                     double                               m2,
+                     std::vector<VId>&                    comm,
+                     const louvain_options&               options,
+                     std::vector<community_weights<VId>>& acc) {
+    std::vector<double> tot(n);
+    std::vector<size_t> size(n);
+    auto                recount = [&] {
+      std::ranges::fill(tot, 0.0);
+      std::ranges::fill(size, size_t{0});
+      for (size_t v = 0; v < n; ++v) {
+        tot[static_cast<size_t>(comm[v])] += k[v];
+        ++size[static_cast<size_t>(comm[v])];
+      }
+    };
+    auto load = [](auto& x) { return std::atomic_ref(x).load(std::memory_order_relaxed); };
+
+    recount();
+    double q = level_modularity(g, n, weight, comm, tot, m2, options.resolution);
+    for (size_t pass = 0; pass < options.max_passes; ++pass) {
+      std::atomic<size_t> moved{0};
+      parallel_for_chunks(
+            size_t{0}, n,
+            [&](size_t lo, size_t hi, size_t worker) {
+              community_weights<VId>& to    = acc[worker];
+              size_t                  count = 0;
+              for (size_t u = lo; u < hi; ++u) {
+                const VId a = load(comm[u]);
+                to.reserve(degree_of(g, u));
+                for (auto&& uv : edges_of(g, u)) {
+                  const size_t v = static_cast<size_t>(graph::target_id(g, uv));
+                  if (v != u)
+                    to.add(load(comm[v]), weight(uv));
+                }
+
+                // Gain of each community, up to a common term and the factor 1/m
+                const double ku        = k[u];
+                const double scale     = options.resolution * ku / m2;
+                VId          best      = a;
+                double       best_gain = to[a] - scale * (load(tot[static_cast<size_t>(a)]) - ku);
+                to.for_each([&](VId c, double kc) {
+                  if (c == a)
+                    return;
+                  const double gain = kc - scale * load(tot[static_cast<size_t>(c)]);
+                  if (gain > best_gain || (gain == best_gain && best != a && c < best)) {
+                    best      = c;
+                    best_gain = gain;
+                  }
+                });
+                to.clear();
+
+                const size_t from = static_cast<size_t>(a), into = static_cast<size_t>(best);
+                if (best == a || (best > a && load(size[from]) == 1 && load(size[into]) == 1))
+                  continue;
+                std::atomic_ref(tot[from]).fetch_sub(ku, std::memory_order_relaxed);
+                std::atomic_ref(tot[into]).fetch_add(ku, std::memory_order_relaxed);
+                std::atomic_ref(size[from]).fetch_sub(1, std::memory_order_relaxed);
+                std::atomic_ref(size[into]).fetch_add(1, std::memory_order_relaxed);
+                std::atomic_ref(comm[u]).store(best, std::memory_order_relaxed);
+                ++count;
+              }
+              moved.fetch_add(count, std::memory_order_relaxed);
+            },
+            256);
+
+      recount(); // exact sums, without the rounding of the concurrent updates
+      const double next = level_modularity(g, n, weight, comm, tot, m2, options.resolution);
+      const bool   done = moved.load() == 0 || next - q < options.tolerance;
+      q                 = next;
+      if (done)
+        break;
+    }
+  }
+
+  // Leiden refinement of communities [0, count): the part of each vertex, named by one of its
+  // vertices
+  template <class VId, class G, class WF>
+  std::vector<VId> refine_communities(G&                                   g,
+                                      size_t                               n,
+                                      WF&                                  weight,
+                                      const std::vector<double>&           k,
+                                      double                               m2,
+                                      const std::vector<VId>&              comm,
+                                      size_t                               count,
+                                      double                               resolution,
+                                      std::vector<community_weights<VId>>& acc) {
+    std::vector<size_t> first;
+    std::vector<VId>    members;
+    group_by_label(comm, count, first, members);
+    std::vector<double> tot(count, 0.0);
+    for (size_t v = 0; v < n; ++v)
+      tot[static_cast<size_t>(comm[v])] += k[v];
+
+    // Each part starts as a singleton; ext is the weight from a part to the rest of its community
+    std::vector<VId>    part(n);
+    std::vector<double> part_tot(k);
+    std::vector<double> ext(n);
+    std::vector<char>   alone(n, 1);
+    parallel_for(
+          size_t{0}, n,
+          [&](size_t u) {
+            double sum = 0.0;
+            for (auto&& uv : edges_of(g, u)) {
+              const size_t v = static_cast<size_t>(graph::target_id(g, uv));
+              if (v != u && comm[v] == comm[u])
+                sum += weight(uv);
+            }
+            ext[u]  = sum;
+            part[u] = static_cast<VId>(u);
+          },
+          1024);
+
+    // Communities are independent, so each is refined by one worker
+    for_each_dynamic(count, [&](size_t c, size_t worker) {
+      community_weights<VId>& to             = acc[worker];
+      const double            tc             = tot[c];
+      auto                    well_connected = [&](size_t p) {
+        return ext[p] >= resolution * part_tot[p] * (tc - part_tot[p]) / m2;
+      };
+      for (size_t i = first[c]; i < first[c + 1]; ++i) {
+        const size_t v = static_cast<size_t>(members[i]);
+        if (!alone[v] || !well_connected(v))
+          continue;
+        to.reserve(degree_of(g, v));
+        for (auto&& vu : edges_of(g, v)) {
+          const size_t u = static_cast<size_t>(graph::target_id(g, vu));
+          if (u != v && static_cast<size_t>(comm[u]) == c)
+            to.add(part[u], weight(vu));
+        }
+
+        constexpr VId none      = std::numeric_limits<VId>::max();
+        const double  scale     = resolution * k[v] / m2;
+        VId           best      = none;
+        double        best_gain = 0.0;
+        to.for_each([&](VId p, double kp) {
+          if (!well_connected(static_cast<size_t>(p)))
+            return;
+          const double gain = kp - scale * part_tot[static_cast<size_t>(p)];
+          if (gain > best_gain || (gain == best_gain && (best == none || p < best))) {
+            best      = p;
+            best_gain = gain;
+          }
+        });
+        if (best != none) {
+          const size_t p = static_cast<size_t>(best);
+          part_tot[p] += k[v];
+          ext[p] += ext[v] - 2.0 * to[best];
+          part[v]  = best;
+          alone[v] = 0;
+          alone[p] = 0;
+        }
+        to.clear();
+      }
+    });
+    return part;
+  }
+
+  // The graph of parts [0, count): one vertex per part and an edge, or a self-loop, with the
+  // summed weight of the edges between two parts
+  template <class VId, class G, class WF>
+  louvain_level_graph<VId> contract(G&                                   g,
+                                    WF&                                  weight,
+                                    const std::vector<VId>&              part,
+                                    size_t                               count,
+                                    std::vector<community_weights<VId>>& acc) {
+    std::vector<size_t> first;
+    std::vector<VId>    members;
+    group_by_label(part, count, first, members);
+
+    std::vector<std::vector<std::pair<VId, double>>> rows(count);
+    for_each_dynamic(count, [&](size_t p, size_t worker) {
+      community_weights<VId>& to     = acc[worker];
+      size_t                  degree = 0;
+      for (size_t i = first[p]; i < first[p + 1]; ++i)
+        degree += degree_of(g, members[i]);
+      to.reserve(degree);
+      for (size_t i = first[p]; i < first[p + 1]; ++i)
+        for (auto&& uv : edges_of(g, members[i]))
+          to.add(part[static_cast<size_t>(graph::target_id(g, uv))], weight(uv));
+      to.for_each([&](VId q, double w) { rows[p].emplace_back(q, w); });
+      to.clear();
+      std::ranges::sort(rows[p]);
+    });
+
+    size_t edges = 0;
+    for (const auto& row : rows)
+      edges += row.size();
+    std::vector<copyable_edge_t<VId, double>> ee;
+    ee.reserve(edges);
+    for (size_t p = 0; p < count; ++p)
+      for (const auto& [q, w] : rows[p])
+        ee.push_back({static_cast<VId>(p), q, w});
+
+    louvain_level_graph<VId> h;
+    h.load_edges(ee, std::identity(), count);
+    return h;
+  }
+
+  // Split each community into its connected components, labeled by their least vertex
+  template <class VId, class G>
+  void split_communities(G& g, size_t n, std::vector<VId>& label) {
+    union_find<VId> parts(n);
+    parallel_for(
+          size_t{0}, n,
+          [&](size_t u) {
+            for (auto&& uv : edges_of(g, u)) {
+              const VId v = static_cast<VId>(graph::target_id(g, uv));
+              if (label[static_cast<size_t>(v)] == label[u])
+                parts.concurrent_unite(static_cast<VId>(u), v);
+            }
+          },
+          1024);
+    parts.compress();
+    label = parts.parents();
+  }
+
+  // Levels of moving, refinement and contraction; writes the community of each vertex of g
+  template <class VId, class G, class WF>
+  void louvain_levels(G& g, size_t n, WF& weight, std::vector<VId>& label, const louvain_options& options) {
+    std::vector<community_weights<VId>> acc(hardware_threads());
+    std::vector<VId>                    node(n); // vertex of the current level holding each vertex of g
+    std::vector<VId>                    comm(n); // community of each vertex of the current level
+    for (size_t v = 0; v < n; ++v)
+      node[v] = comm[v] = static_cast<VId>(v);
+    louvain_level_graph<VId> h;
+
+    // One level on graph with nodes vertices; false when there's no next level
+    auto level = [&](auto& graph, auto& wf, size_t nodes, bool last) {
+      std::vector<double> k;
+      const double        m2 = vertex_weights(graph, nodes, wf, k);
+      if (m2 <= 0.0)
+        return false;
+      move_vertices(graph, nodes, wf, k, m2, comm, options, acc);
+      const size_t count = renumber(comm, nodes);
+
+      std::vector<VId> part  = comm;
+      size_t           parts = count;
+      if (options.leiden) {
+        part  = refine_communities(graph, nodes, wf, k, m2, comm, count, options.resolution, acc);
+        parts = renumber(part, nodes);
+      }
+      if (last || count == nodes || parts == nodes)
+        return false;
+
+      std::vector<VId> next(parts);
+      for (size_t u = 0; u < nodes; ++u)
+        next[static_cast<size_t>(part[u])] = comm[u];
+      for (VId& x : node)
+        x = part[static_cast<size_t>(x)];
+      h    = contract(graph, wf, part, parts, acc); // graph may be h; it isn't read after this
+      comm = std::move(next);
+      return true;
+    };
+
+    auto level_weight = [&h](auto&& uv) { return graph::edge_value(h, uv); };
+    bool more         = level(g, weight, n, options.max_levels <= 1);
+    for (size_t l = 1; more && l < options.max_levels; ++l)
+      more = level(h, level_weight, static_cast<size_t>(graph::num_vertices(h)), l + 1 == options.max_levels);
+
+    for (size_t v = 0; v < n; ++v)
+      label[v] = comm[static_cast<size_t>(node[v])];
+    if (options.leiden)
+      split_communities(g, n, label);
+  }
+} // namespace detail
+
+/**
+ * @brief Modularity of a partition of an undirected graph.
+ *
+ * @param g           Graph with vertex ids in [0, num_vertices(g)) that stores every edge in both
+ *                    directions, with the same weight
+ * @param communities Random access range of integral values in [0, num_vertices(g)), indexed by
+ *                    vertex id: the community of each vertex
+ * @param weight      Edge weight function, weight(uv), non-negative
+ * @param resolution  Resolution r of the modularity (see NOTES)
+ * @return The modularity, in [-r, 1]; 0 if g has no edges
+ * @throws graph_error if communities is too small or holds a value out of range
+ * @note Complexity: O(V + E)
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Communities, class EVF>
+requires std::integral<std::ranges::range_value_t<Communities>> && std::invocable<EVF&, edge_t<std::remove_reference_t<G>>>
+double modularity(G&& g, const Communities& communities, EVF&& weight, double resolution = 1.0) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(std::ranges::size(communities)) < n)
+    throw graph_error("modularity: communities is smaller than num_vertices(g)");
+  auto             in = std::ranges::begin(communities);
+  std::vector<VId> comm(n);
+  for (size_t v = 0; v < n; ++v) {
+    const auto c = in[static_cast<std::ptrdiff_t>(v)];
+    if (std::cmp_less(c, 0) || std::cmp_greater_equal(c, n))
+      throw graph_error("modularity: community out of range");
+    comm[v] = static_cast<VId>(c);
+  }
+
+  auto                w = [&weight](auto&& uv) { return static_cast<double>(std::invoke(weight, uv)); };
+  std::vector<double> k;
+  const double        m2 = detail::vertex_weights(g, n, w, k);
+  if (m2 <= 0.0)
+    return 0.0;
+  std::vector<double> tot(n, 0.0);
+  for (size_t v = 0; v < n; ++v)
+    tot[static_cast<size_t>(comm[v])] += k[v];
+  return detail::level_modularity(g, n, w, comm, tot, m2, resolution);
+}
+
+/**
+ * @brief Modularity of a partition of an undirected graph with edge_value(g,uv) as the weights.
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Communities>
+requires std::integral<std::ranges::range_value_t<Communities>> && requires(G& g, const edge_t<std::remove_reference_t<G>>& uv) {
+  { graph::edge_value(g, uv) } -> std::convertible_to<double>;
+}
+double modularity(G&& g, const Communities& communities, double resolution = 1.0) {
+  auto evf = [&g](const auto& uv) { return graph::edge_value(g, uv); };
+  return modularity(g, communities, evf, resolution);
+}
+
+/**
+ * @brief Communities of an undirected graph by parallel Louvain, or Leiden with options.leiden.
+ *
+ * @param g           Graph with vertex ids in [0, num_vertices(g)) that stores every edge in both
+ *                    directions, with the same weight
+ * @param communities Random access range of integral values, indexed by vertex id, with at least
+ *                    num_vertices(g) elements. Receives the community of each vertex, numbered from
+ *                    0 in the order of their least vertex id.
+ * @param weight      Edge weight function, weight(uv), non-negative
+ * @param options     Resolution, stopping criteria and whether to refine as in Leiden
+ * @return The number of communities
+ * @throws graph_error if communities is too small or an edge weight is negative
+ * @note Complexity: O(V + E) work per local-moving pass; the contracted levels are usually much
+ *       smaller than g
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Communities, class EVF>
+requires std::integral<std::ranges::range_value_t<Communities>> && std::invocable<EVF&, edge_t<std::remove_reference_t<G>>>
+size_t louvain(G&& g, Communities&& communities, EVF&& weight, const louvain_options& options = {}) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  using C   = std::ranges::range_value_t<Communities>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(std::ranges::size(communities)) < n)
+    throw graph_error("louvain: communities is smaller than num_vertices(g)");
+
+  auto             w = [&weight](auto&& uv) { return static_cast<double>(std::invoke(weight, uv)); };
+  std::vector<VId> label(n);
+  detail::louvain_levels(g, n, w, label, options);
+
+  const size_t count = detail::renumber(label, n);
+
+  auto out = std::ranges::begin(communities);
+  for (size_t v = 0; v < n; ++v)
+    out[static_cast<std::ptrdiff_t>(v)] = static_cast<C>(label[v]);
+  return count;
+}
+
+/**
+ * @brief Communities of an undirected graph with edge_value(g,uv) as the weights.
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Communities>
+requires std::integral<std::ranges::range_value_t<Communities>> && requires(G& g, const edge_t<std::remove_reference_t<G>>& uv) {
+  { graph::edge_value(g, uv) } -> std::convertible_to<double>;
+}
+size_t louvain(G&& g, Communities&& communities, const louvain_options& options = {}) {
+  auto evf = [&g](const auto& uv) { return graph::edge_value(g, uv); };
+  return louvain(g, communities, evf, options);
+}
+
+} // namespace graph
@@ -0,0 +1,426 @@
+/**
+ * @file max_flow.hpp
+ * @brief Maximum flow by push-relabel, highest-label or FIFO, with gap and global relabeling
+ *
+ * @code
+ *   compressed_graph<int, void, void, uint32_t, uint32_t> g(...);  // edge values are capacities
+ *   auto capacity = [&g](auto&& uv) { return edge_value(g, uv); };
+ *   int value = max_flow(g, s, t, capacity);
+ *
+ *   std::vector<int> flows(num_edges);                               // flow of each edge, by edge index
+ *   max_flow(g, s, t, flows, capacity, {.order = max_flow_order::fifo});
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+
+// NOTES
+//  The residual graph is built once, before any push: every edge u->v becomes a forward arc at u
+//  and a reverse arc at v, laid out by vertex in one array like compressed_graph's columns, and
+//  rev[a] is the index of the arc paired with a. A push on arc a adds to the residual capacity of
+//  rev[a], so nothing is ever looked up, hashed or rebuilt, and parallel or antiparallel edges
+//  need no special handling.
+//
+//  Push-relabel (Goldberg & Tarjan) runs in two phases, as in Cherkassky & Goldberg's HIPR. The
+//  first moves as much excess as it can to t, processing the active vertex with the highest label
+//  (or the oldest, with fifo) and discharging it through its current arc. Vertices are kept in a
+//  doubly linked list per label, so when relabeling empties a label k < n, every vertex above k is
+//  cut off from t and lifted to n at once (the gap heuristic). A global relabel, a BFS from t over
+//  the residual arcs that sets every label to the exact distance to t, runs at the start and again
+//  whenever the relabels since the last one have scanned about global_relabel_frequency * (6V + A)
+//  arcs, A being the number of arcs. When no vertex below n is active, the excess at t is the
+//  maximum flow value.
+//
+//  The second phase runs only when the flow of each edge is asked for: the excess that is left is
+//  returned to s, with labels above n given by a BFS from s, which turns the preflow into a flow.
+//
+//  Both phases do O(V^2 sqrt(A)) work with highest-label selection and O(V^3) with fifo, and far
+//  less in practice. Capacities may be floating point, but integral ones avoid rounding.
+
+namespace graph {
+
+/// Order in which max_flow discharges the active vertices
+enum class max_flow_order {
+  highest_label, ///< The active vertex with the highest label first
+  fifo           ///< Active vertices in the order they became active
+};
+
+/**
+ * @brief Options of max_flow
+ */
+struct max_flow_options {
+  /// Which active vertex to discharge next
+  max_flow_order order = max_flow_order::highest_label;
+  /// Relabel globally after the relabels scan about this many times 6V + A arcs; 0 for never after
+  /// the first
+  double global_relabel_frequency = 1.0;
+};
+
+namespace detail {
+  // Residual arcs of g: the arcs at u are [first[u], first[u+1]); forward[e] is the forward arc of
+  // the edge with index e
+  template <class VId, class T>
+  struct residual_graph {
+    std::vector<size_t> first;
+    std::vector<VId>    head;
+    std::vector<T>      resid;
+    std::vector<size_t> rev;
+    std::vector<T>      cap;
+    std::vector<size_t> forward;
+
+    template <class G, class CF>
+    residual_graph(G& g, size_t n, CF& capacity) : first(n + 1, 0) {
+      size_t m = 0;
+      for (size_t u = 0; u < n; ++u)
+        for (auto&& uv : edges_of(g, u)) {
+          ++first[u + 1];
+          ++first[static_cast<size_t>(graph::target_id(g, uv)) + 1];
+          ++m;
+        }
+      for (size_t u = 0; u < n; ++u)
+        first[u + 1] += first[u];
+      head.resize(2 * m);
+      resid.resize(2 * m);
+      rev.resize(2 * m);
+      cap.reserve(m);
+      forward.reserve(m);
+
+      std::vector<size_t> next(first.begin(), first.end() - 1);
+      for (size_t u = 0; u < n; ++u)
+        for (auto&& uv : edges_of(g, u)) {
+          const size_t v = static_cast<size_t>(graph::target_id(g, uv));
+          const T      c = std::invoke(capacity, uv);
+          if (c < T{0})
+            throw graph_error("max_flow: negative capacity");
+          const size_t a = next[u]++, b = next[v]++;
+          head[a]        = static_cast<VId>(v);
+          head[b]        = static_cast<VId>(u);
+          resid[a]       = c;
+          resid[b]       = T{0};
+          rev[a]         = b;
+          rev[b]         = a;
+          cap.push_back(c);
+          forward.push_back(a);
+        }
+    }
+  };
+
+  template <class VId, class T>
+  class push_relabel {
+  public:
+    push_relabel(residual_graph<VId, T>& r, size_t n, size_t s, size_t t, const max_flow_options& options)
+          : r_(r)
+          , n_(n)
+          , s_(s)
+          , t_(t)
+          , fifo_(options.order == max_flow_order::fifo)
+          , relabel_period_(options.global_relabel_frequency * static_cast<double>(6 * n + r.head.size()))
+          , label_(n, 0)
+          , excess_(n, T{0})
+          , current_(r.first.begin(), r.first.end() - 1)
+          , buckets_(2 * n + 1)
+          , label_head_(n, none)
+          , next_(n, none)
+          , prev_(n, none) {}
+
+    // Phase 1: the maximum flow value, as the excess at t
+    T maximum_preflow() {
+      label_[s_] = n_;
+      for (size_t a = r_.first[s_]; a < r_.first[s_ + 1]; ++a) {
+        const T c = r_.resid[a];
+        if (c > T{0} && static_cast<size_t>(r_.head[a]) != s_) {
+          r_.resid[a] -= c;
+          r_.resid[r_.rev[a]] += c;
+          excess_[static_cast<size_t>(r_.head[a])] += c;
+          excess_[s_] -= c;
+        }
+      }
+      run(n_);
+      return excess_[t_];
+    }
+
+    // Phase 2: return the excess left to s
+    void preflow_to_flow() { run(2 * n_); }
+
+  private:
+    static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+    // Discharge active vertices with labels below limit
+    void run(size_t limit) {
+      limit_ = limit;
+      global_relabel();
+      for (size_t v = next_active(); v != none; v = next_active()) {
+        if (label_[v] >= limit_ || excess_[v] <= T{0})
+          continue; // lifted by a gap, or drained
+        discharge(v);
+        if (relabel_period_ > 0.0 && static_cast<double>(work_) >= relabel_period_)
+          global_relabel();
+      }
+    }
+
+    void discharge(size_t v) {
+      while (excess_[v] > T{0}) {
+        if (current_[v] == r_.first[v + 1]) {
+          relabel(v);
+          if (label_[v] >= limit_)
+            return;
+          continue;
+        }
+        const size_t a = current_[v];
+        const size_t w = static_cast<size_t>(r_.head[a]);
+        if (r_.resid[a] > T{0} && label_[v] == label_[w] + 1) {
+          const T delta = std::min(excess_[v], r_.resid[a]);
+          r_.resid[a] -= delta;
+          r_.resid[r_.rev[a]] += delta;
+          excess_[v] -= delta;
+          const bool idle = excess_[w] <= T{0};
+          excess_[w] += delta;
+          if (idle && w != s_ && w != t_)
+            add_active(w);
+          if (excess_[v] <= T{0})
+            return;
+        }
+        ++current_[v];
+      }
+    }
+
+    void relabel(size_t v) {
+      size_t lowest = 2 * n_;
+      for (size_t a = r_.first[v]; a < r_.first[v + 1]; ++a)
+        if (r_.resid[a] > T{0})
+          lowest = std::min(lowest, label_[static_cast<size_t>(r_.head[a])] + 1);
+      work_ += r_.first[v + 1] - r_.first[v] + 12;
+      current_[v] = r_.first[v];
+
+      const size_t old = label_[v];
+      if (old < n_) {
+        unlink(v);
+        if (label_head_[old] == none) {
+          gap(old);
+          label_[v] = n_;
+          return;
+        }
+      }
+      label_[v] = std::min(lowest, 2 * n_);
+      if (label_[v] < n_)
+        link(v);
+    }
+
+    // No vertex is left at label k: everything above it can't reach t
+    void gap(size_t k) {
+      for (size_t j = k + 1; j <= top_label_; ++j) {
+        for (size_t u = label_head_[j]; u != none; u = next_[u])
+          label_[u] = n_;
+        label_head_[j] = none;
+      }
+      top_label_ = k;
+    }
+
+    // Exact labels by BFS over the residual arcs: the distance to t, or n plus the distance to s
+    void global_relabel() {
+      work_ = 0;
+      std::ranges::fill(label_, 2 * n_);
+      std::ranges::fill(label_head_, none);
+      top_label_ = 0;
+      label_[s_] = n_;
+
+      std::vector<size_t> queue;
+      queue.reserve(n_);
+      auto search = [&](size_t root, size_t base) {
+        label_[root] = base;
+        queue.assign(1, root);
+        for (size_t i = 0; i < queue.size(); ++i) {
+          const size_t w = queue[i];
+          for (size_t a = r_.first[w]; a < r_.first[w + 1]; ++a) {
+            const size_t x = static_cast<size_t>(r_.head[a]);
+            if (r_.resid[r_.rev[a]] > T{0} && label_[x] == 2 * n_) {
+              label_[x] = label_[w] + 1;
+              queue.push_back(x);
+            }
+          }
+        }
+      };
+      search(t_, 0);
+      if (limit_ > n_)
+        search(s_, n_);
+
+      for (size_t v = 0; v < n_; ++v) {
+        if (label_[v] == 2 * n_ && limit_ <= n_)
+          label_[v] = n_;
+        current_[v] = r_.first[v];
+        if (label_[v] < n_)
+          link(v);
+      }
+      fifo_queue_.clear();
+      for (auto& bucket : buckets_)
+        bucket.clear();
+      top_active_ = 0;
+      for (size_t v = 0; v < n_; ++v)
+        if (v != s_ && v != t_ && excess_[v] > T{0} && label_[v] < limit_)
+          add_active(v);
+    }
+
+    void add_active(size_t v) {
+      if (fifo_) {
+        fifo_queue_.push_back(static_cast<VId>(v));
+      } else {
+        buckets_[label_[v]].push_back(static_cast<VId>(v));
+        top_active_ = std::max(top_active_, label_[v]);
+      }
+    }
+
+    size_t next_active() {
+      if (fifo_) {
+        if (fifo_queue_.empty())
+          return none;
+        const size_t v = static_cast<size_t>(fifo_queue_.front());
+        fifo_queue_.pop_front();
+        return v;
+      }
+      for (;;) {
+        if (!buckets_[top_active_].empty()) {
+          const size_t v = static_cast<size_t>(buckets_[top_active_].back());
+          buckets_[top_active_].pop_back();
+          return v;
+        }
+        if (top_active_ == 0)
+          return none;
+        --top_active_;
+      }
+    }
+
+    void link(size_t v) {
+      const size_t k = label_[v];
+      prev_[v]       = none;
+      next_[v]       = label_head_[k];
+      if (next_[v] != none)
+        prev_[next_[v]] = v;
+      label_head_[k] = v;
+      top_label_     = std::max(top_label_, k);
+    }
+
+    void unlink(size_t v) {
+      if (prev_[v] != none)
+        next_[prev_[v]] = next_[v];
+      else
+        label_head_[label_[v]] = next_[v];
+      if (next_[v] != none)
+        prev_[next_[v]] = prev_[v];
+    }
+
+    residual_graph<VId, T>&       r_;
+    size_t                        n_, s_, t_;
+    bool                          fifo_;
+    double                        relabel_period_;
+    size_t                        limit_ = 0;
+    size_t                        work_  = 0;
+    std::vector<size_t>           label_;
+    std::vector<T>                excess_;
+    std::vector<size_t>           current_;
+    std::vector<std::vector<VId>> buckets_; // active vertices by label, highest_label
+    size_t                        top_active_ = 0;
+    std::deque<VId>               fifo_queue_;
+    std::vector<size_t>           label_head_; // vertices by label below n, for the gap heuristic
+    std::vector<size_t>           next_, prev_;
+    size_t                        top_label_ = 0;
+  };
+
+  template <class G, class CF>
+  using capacity_t = std::remove_cvref_t<std::invoke_result_t<CF&, edge_t<std::remove_reference_t<G>>>>;
+
+  // Checks s and t, builds the residual graph and runs phase 1, and phase 2 if asked
+  template <class G, class CF, class Done>
+  capacity_t<G, CF> run_max_flow(G& g, size_t s, size_t t, CF& capacity, const max_flow_options& options, Done&& done) {
+    using VId = std::remove_cvref_t<vertex_id_t<G>>;
+    using T   = capacity_t<G, CF>;
+
+    const size_t n = static_cast<size_t>(graph::num_vertices(g));
+    if (s >= n || t >= n)
+      throw graph_error("max_flow: s or t isn't a vertex of g");
+    if (s == t)
+      throw graph_error("max_flow: s and t are the same vertex");
+
+    residual_graph<VId, T> r(g, n, capacity);
+    push_relabel<VId, T>   solver(r, n, s, t, options);
+    const T                value = solver.maximum_preflow();
+    done(solver, r);
+    return value;
+  }
+} // namespace detail
+
+/**
+ * @brief Maximum flow value from s to t, by push-relabel.
+ *
+ * @param g        Directed graph with vertex ids in [0, num_vertices(g))
+ * @param s        Source vertex id
+ * @param t        Sink vertex id
+ * @param capacity Edge capacity function, capacity(uv), arithmetic and non-negative
+ * @param options  Active vertex order and global relabel frequency
+ * @return The value of a maximum flow
+ * @throws graph_error if s or t isn't a vertex of g, s == t, or a capacity is negative
+ * @note Complexity: O(V^2 sqrt(E)) with highest-label order, O(V^3) with fifo
+ */
+template <index_descriptor_adjacency_list G, class CF>
+requires std::invocable<CF&, edge_t<std::remove_reference_t<G>>> &&
+         std::is_arithmetic_v<detail::capacity_t<G, CF>>
+detail::capacity_t<G, CF> max_flow(G&&                     g,
+                                   const vertex_id_t<G>&   s,
+                                   const vertex_id_t<G>&   t,
+                                   CF&&                    capacity,
+                                   const max_flow_options& options = {}) {
+  return detail::run_max_flow(g, static_cast<size_t>(s), static_cast<size_t>(t), capacity, options,
+                              [](auto&, auto&) {});
+}
+
+/**
+ * @brief Maximum flow from s to t by push-relabel, with the flow of each edge.
+ *
+ * @param g        Directed graph with vertex ids in [0, num_vertices(g))
+ * @param s        Source vertex id
+ * @param t        Sink vertex id
+ * @param flows    Random access range of arithmetic values with an element per edge. Receives the
+ *                 flow of each edge by edge index: the position of the edge when the rows of g are
+ *                 laid end to end, edges(g,0) first.
+ * @param capacity Edge capacity function, capacity(uv), arithmetic and non-negative
+ * @param options  Active vertex order and global relabel frequency
+ * @return The value of the flow
+ * @throws graph_error if s or t isn't a vertex of g, s == t, a capacity is negative, or flows is
+ *         too small
+ * @note Complexity: O(V^2 sqrt(E)) with highest-label order, O(V^3) with fifo
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Flows, class CF>
+requires std::invocable<CF&, edge_t<std::remove_reference_t<G>>> &&
+         std::is_arithmetic_v<detail::capacity_t<G, CF>> && std::is_arithmetic_v<std::ranges::range_value_t<Flows>>
+detail::capacity_t<G, CF> max_flow(G&&                     g,
+                                   const vertex_id_t<G>&   s,
+                                   const vertex_id_t<G>&   t,
+                                   Flows&&                 flows,
+                                   CF&&                    capacity,
+                                   const max_flow_options& options = {}) {
+  using F = std::ranges::range_value_t<Flows>;
+  if (static_cast<size_t>(std::ranges::size(flows)) < static_cast<size_t>(graph::num_edges(g)))
+    throw graph_error("max_flow: flows is smaller than the number of edges");
+  return detail::run_max_flow(g, static_cast<size_t>(s), static_cast<size_t>(t), capacity, options,
+                              [&](auto& solver, auto& r) {
+                                const size_t m = r.forward.size();
+                                solver.preflow_to_flow();
+                                auto out = std::ranges::begin(flows);
+                                for (size_t e = 0; e < m; ++e)
+                                  out[static_cast<std::ptrdiff_t>(e)] = static_cast<F>(r.cap[e] - r.resid[r.forward[e]]);
+                              });
+}
+
+} // namespace graph
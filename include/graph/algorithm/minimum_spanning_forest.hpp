@@ -0,0 +1,249 @@
+/**
+ * @file minimum_spanning_forest.hpp
+ * @brief Minimum spanning forest by Kruskal over an edgelist, or by parallel Borůvka over an adjacency list
+ *
+ * @code
+ *   edgelist<uint32_t, double> el = ...;
+ *   std::vector<size_t> forest(el.num_vertices());
+ *   size_t k = minimum_spanning_forest(el, forest);  // forest[0..k) are indices of edges of el
+ *
+ *   compressed_graph<double, void, void, uint32_t, uint32_t> g(...);
+ *   k = minimum_spanning_forest(g, forest);          // forest[0..k) are edge indices of g
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/edgelist.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/detail/parallel.hpp"
+#include "graph/detail/union_find.hpp"
+
+// NOTES
+//  Edges are undirected: u->v and v->u join the same two trees, and an adjacency list may store an
+//  edge in one direction or both. Ties between equal weights are broken by edge index, which makes
+//  the weights distinct, so the forest is unique and both algorithms return the same one.
+//
+//  Kruskal sorts (weight, index) pairs with detail::parallel_sort and adds the edges in that order
+//  with a sequential union_find, stopping once the forest has num_vertices - 1 edges.
+//
+//  Borůvka works in rounds. Every edge between two different trees is offered to both trees, and
+//  each tree keeps the lightest one in a single word, lowered with a compare-and-swap. The two
+//  copies of an edge stored in both directions are offered to both of its trees, so both pick the
+//  same copy (the one with the smaller index). A second scan of the rows then records the source
+//  and target ids of each tree's choice, carrying the source id along, since seeking to an edge
+//  index within its row costs O(degree) on list-based rows. The chosen edges are linked with
+//  union_find::concurrent_unite, which accepts the edge chosen by both of its trees only once, and
+//  the trees are contracted by compress(). Each round at least halves the number of trees that
+//  still have an edge out, so there are O(log V) rounds of O(V + E) work.
+//
+//  The edge index of an adjacency list is the position of the edge when the rows are laid end to
+//  end: edges(g,0), then edges(g,1), and so on. For compressed_graph it's the edge's position in
+//  the graph's column array. The only per-edge storage is one weight (and, for Kruskal, one index)
+//  per edge, allocated once.
+
+namespace graph {
+
+namespace detail {
+  /// Copy the forest edges picked, sorted, to the output range
+  template <class Forest>
+  size_t write_forest(std::vector<size_t>& picked, Forest& forest) {
+    using F = std::ranges::range_value_t<Forest>;
+    std::ranges::sort(picked);
+    auto out = std::ranges::begin(forest);
+    for (size_t i = 0; i < picked.size(); ++i)
+      out[static_cast<std::ptrdiff_t>(i)] = static_cast<F>(picked[i]);
+    return picked.size();
+  }
+} // namespace detail
+
+/**
+ * @brief Minimum spanning forest of an edgelist, by Kruskal's algorithm with a parallel sort.
+ *
+ * @param el     Edges with vertex ids in [0, el.num_vertices())
+ * @param forest Random access range of integral values with at least el.num_vertices() - 1
+ *               elements. Receives the indices of the forest edges in el, in increasing order.
+ * @param weight Edge weight function, weight(e) for an edge of el
+ * @return The number of forest edges: num_vertices minus the number of trees
+ * @throws graph_error if forest is too small or an edge has a vertex id outside the edgelist
+ * @note Complexity: O(E log E) work
+ */
+template <class VId, class EV, class Alloc, std::ranges::random_access_range Forest, class WF>
+requires std::integral<std::ranges::range_value_t<Forest>> &&
+         std::invocable<WF&, const typename edgelist<VId, EV, Alloc>::edge_type&>
+size_t minimum_spanning_forest(const edgelist<VId, EV, Alloc>& el, Forest&& forest, WF&& weight) {
+  using W = std::remove_cvref_t<std::invoke_result_t<WF&, const typename edgelist<VId, EV, Alloc>::edge_type&>>;
+
+  const size_t n = static_cast<size_t>(el.num_vertices());
+  const size_t m = static_cast<size_t>(el.num_edges());
+  if (n > 0 && static_cast<size_t>(std::ranges::size(forest)) < n - 1)
+    throw graph_error("minimum_spanning_forest: forest is smaller than num_vertices - 1");
+
+  auto                              edges = el.begin();
+  std::vector<std::pair<W, size_t>> order(m);
+  detail::parallel_for(
+        size_t{0}, m,
+        [&](size_t i) {
+          const auto& e = edges[static_cast<std::ptrdiff_t>(i)];
+          if (static_cast<size_t>(e.source) >= n || static_cast<size_t>(e.target) >= n)
+            throw graph_error("minimum_spanning_forest: edge has a vertex id outside the edgelist");
+          order[i] = {std::invoke(weight, e), i};
+        },
+        1 << 14);
+  detail::parallel_sort(order.begin(), order.end());
+
+  detail::union_find<VId> trees(n);
+  std::vector<size_t>     picked;
+  picked.reserve(n == 0 ? 0 : n - 1);
+  for (size_t i = 0; i < m && picked.size() + 1 < n; ++i) {
+    const auto& e = edges[static_cast<std::ptrdiff_t>(order[i].second)];
+    if (trees.unite(e.source, e.target))
+      picked.push_back(order[i].second);
+  }
+  return detail::write_forest(picked, forest);
+}
+
+/**
+ * @brief Minimum spanning forest of an edgelist with arithmetic edge values as the weights.
+ */
+template <class VId, class EV, class Alloc, std::ranges::random_access_range Forest>
+requires std::integral<std::ranges::range_value_t<Forest>> && std::is_arithmetic_v<EV>
+size_t minimum_spanning_forest(const edgelist<VId, EV, Alloc>& el, Forest&& forest) {
+  return minimum_spanning_forest(el, forest, [](const auto& e) { return e.value; });
+}
+
+/**
+ * @brief Minimum spanning forest of a graph, by Borůvka's algorithm in parallel.
+ *
+ * @param g      Graph with vertex ids in [0, num_vertices(g)), whose edges are taken as undirected
+ * @param forest Random access range of integral values with at least num_vertices(g) - 1 elements.
+ *               Receives the edge indices of the forest edges (see NOTES), in increasing order.
+ * @param evf    Edge weight function, evf(uv)
+ * @return The number of forest edges: num_vertices(g) minus the number of trees
+ * @throws graph_error if forest is too small
+ * @note Complexity: O((V + E) log V) work
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Forest, class EVF>
+requires std::integral<std::ranges::range_value_t<Forest>> && std::invocable<EVF&, edge_t<std::remove_reference_t<G>>>
+size_t minimum_spanning_forest(G&& g, Forest&& forest, EVF&& evf) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  using W   = std::remove_cvref_t<std::invoke_result_t<EVF&, edge_t<std::remove_reference_t<G>>>>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (n > 0 && static_cast<size_t>(std::ranges::size(forest)) < n - 1)
+    throw graph_error("minimum_spanning_forest: forest is smaller than num_vertices(g) - 1");
+
+  // Edge index offsets of the rows, and the weights by edge index
+  std::vector<size_t> offsets(n + 1, 0);
+  detail::parallel_for(size_t{0}, n, [&](size_t u) { offsets[u + 1] = detail::degree_of(g, u); }, 4096);
+  for (size_t u = 0; u < n; ++u)
+    offsets[u + 1] += offsets[u];
+  std::vector<W> weight(offsets[n]);
+  detail::parallel_for(
+        size_t{0}, n,
+        [&](size_t u) {
+          size_t e = offsets[u];
+          for (auto&& uv : detail::edges_of(g, u))
+            weight[e++] = std::invoke(evf, uv);
+        },
+        1024);
+
+  constexpr size_t none    = std::numeric_limits<size_t>::max();
+  auto             lighter = [&weight](size_t a, size_t b) {
+    return weight[a] < weight[b] || (!(weight[b] < weight[a]) && a < b);
+  };
+  auto offer = [&](std::vector<size_t>& best, VId tree, size_t e) {
+    std::atomic_ref<size_t> slot(best[static_cast<size_t>(tree)]);
+    size_t                  current = slot.load(std::memory_order_relaxed);
+    while ((current == none || lighter(e, current)) && !slot.compare_exchange_weak(current, e, std::memory_order_relaxed)) {
+    }
+  };
+
+  detail::union_find<VId>          trees(n);
+  std::vector<size_t>              best(n);
+  std::vector<std::pair<VId, VId>> ends(n); // source and target ids of best[t]
+  std::vector<size_t>              picked(n == 0 ? 0 : n - 1);
+  std::atomic<size_t>              count{0};
+  for (;;) {
+    // Lightest edge out of each tree
+    std::ranges::fill(best, none);
+    detail::parallel_for_edge_balanced(offsets, [&](size_t lo, size_t hi, size_t) {
+      for (size_t u = lo; u < hi; ++u) {
+        const VId tu = trees.parent(static_cast<VId>(u));
+        size_t    e  = offsets[u];
+        for (auto&& uv : detail::edges_of(g, u)) {
+          const VId tv = trees.parent(static_cast<VId>(graph::target_id(g, uv)));
+          if (tu != tv) {
+            offer(best, tu, e);
+            offer(best, tv, e);
+          }
+          ++e;
+        }
+      }
+    });
+
+    // Ends of the chosen edges, found by walking the rows again: each edge index is seen once, so
+    // each tree's slot is written once
+    detail::parallel_for_edge_balanced(offsets, [&](size_t lo, size_t hi, size_t) {
+      for (size_t u = lo; u < hi; ++u) {
+        const VId tu = trees.parent(static_cast<VId>(u));
+        size_t    e  = offsets[u];
+        for (auto&& uv : detail::edges_of(g, u)) {
+          const VId v  = static_cast<VId>(graph::target_id(g, uv));
+          const VId tv = trees.parent(v);
+          if (best[static_cast<size_t>(tu)] == e)
+            ends[static_cast<size_t>(tu)] = {static_cast<VId>(u), v};
+          if (best[static_cast<size_t>(tv)] == e)
+            ends[static_cast<size_t>(tv)] = {static_cast<VId>(u), v};
+          ++e;
+        }
+      }
+    });
+
+    // Link them; an edge chosen by both of its trees joins them once
+    const size_t before = count.load();
+    detail::parallel_for(
+          size_t{0}, n,
+          [&](size_t t) {
+            const size_t e = best[t];
+            if (e == none)
+              return;
+            const auto [u, v] = ends[t];
+            if (trees.concurrent_unite(u, v))
+              picked[count.fetch_add(1, std::memory_order_relaxed)] = e;
+          },
+          4096);
+    if (count.load() == before)
+      break;
+    trees.compress();
+  }
+
+  picked.resize(count.load());
+  return detail::write_forest(picked, forest);
+}
+
+/**
+ * @brief Minimum spanning forest of a graph with edge_value(g,uv) as the weights, by parallel Borůvka.
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Forest>
+requires std::integral<std::ranges::range_value_t<Forest>> && requires(G& g, const edge_t<std::remove_reference_t<G>>& uv) {
+  { graph::edge_value(g, uv) };
+}
+size_t minimum_spanning_forest(G&& g, Forest&& forest) {
+  auto evf = [&g](const auto& uv) { return graph::edge_value(g, uv); };
+  return minimum_spanning_forest(g, forest, evf);
+}
+
+} // namespace graph
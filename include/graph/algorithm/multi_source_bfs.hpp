@@ -0,0 +1,290 @@
+/**
+ * @file multi_source_bfs.hpp
+ * @brief Many breadth-first searches at once, sharing each adjacency scan through per-vertex bitsets
+ *
+ * @code
+ *   // Hop distance from each of k sources to each vertex
+ *   std::vector<uint32_t> dist(k * num_vertices(g), unreached);
+ *   multi_source_bfs(g, sources, [&](size_t i, uint32_t vid, size_t depth) {
+ *     dist[i * num_vertices(g) + vid] = static_cast<uint32_t>(depth);
+ *   });
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  This is the MS-BFS of Then et al., "The More the Merrier: Efficient Multi-Source Graph
+//  Traversal" (VLDB 2014). The sources are taken in batches of batch_size. Each vertex has three
+//  bitsets of batch_size bits, one bit per source of the batch: seen (the searches that have
+//  reached it), frontier (those that reached it at the current depth) and next. A level is
+//
+//    next[v]     = OR of frontier[u] over the edges u->v, minus seen[v]
+//    seen[v]    |= next[v]
+//    frontier[v] = next[v]
+//
+//  so one scan of an adjacency list advances every search of the batch whose frontier holds the
+//  vertex, instead of one scan per search. The bitsets of a vertex are contiguous words, and the
+//  per-word loops have no dependencies between words, so the compiler can vectorize them.
+//
+//  Like breadth_first_search, a level either pushes, where each frontier vertex ORs its bits into
+//  next of its out-neighbors with atomic fetch_or, or pulls, where each vertex that some search
+//  hasn't reached yet ORs the frontier bits of its in-neighbors into its own next word, with no
+//  atomics. Pulling needs in-edges (in_edges(g,uid), or edges(g,uid) when the graph is symmetric)
+//  and is chosen when the edges out of the frontier exceed num_edges(g) / alpha. Both run in
+//  parallel over chunks of vertices, and so does the update of seen and frontier that follows.
+//
+//  Memory is three words per vertex for each 64 sources of a batch, allocated once for the largest
+//  batch and cleared before each one.
+
+namespace graph {
+
+/**
+ * @brief Options of multi_source_bfs
+ */
+struct multi_source_bfs_options {
+  /// Number of searches run at once, rounded up to a multiple of 64. Uses 24 bytes per vertex for each 64.
+  size_t batch_size = 256;
+  /// Every edge u->v has a matching v->u, so edges(g,v) can be used as the in-edges of v
+  bool symmetric = false;
+  /// Pull a level when the edges out of the frontier exceed num_edges(g) / alpha, if in-edges are available
+  double alpha = 15.0;
+};
+
+namespace detail {
+  using ms_bfs_word = uint64_t;
+  inline constexpr size_t ms_bfs_bits = 64;
+
+  /// The bitsets of every vertex, allocated for the largest batch and shared by all of them
+  struct ms_bfs_bitsets {
+    std::vector<ms_bfs_word> seen, frontier, next;
+
+    ms_bfs_bitsets(size_t n, size_t words) : seen(n * words), frontier(n * words), next(n * words) {}
+
+    // Zeroes the first n * words words, the bitsets of a batch of words words per vertex
+    void clear(size_t n, size_t words) {
+      const auto used = static_cast<std::ptrdiff_t>(n * words);
+      std::fill(seen.begin(), seen.begin() + used, ms_bfs_word{0});
+      std::fill(frontier.begin(), frontier.begin() + used, ms_bfs_word{0});
+      std::fill(next.begin(), next.begin() + used, ms_bfs_word{0});
+    }
+  };
+
+  // The ids of the sources, each checked to be a vertex before it's narrowed to VId
+  template <class VId, class Sources>
+  std::vector<VId> ms_bfs_sources(size_t n, Sources&& sources) {
+    std::vector<VId> ids;
+    for (auto&& s : sources) {
+      if (std::cmp_less(s, 0) || std::cmp_greater_equal(s, n))
+        throw graph_error("multi_source_bfs: a source isn't a vertex of the graph");
+      ids.push_back(static_cast<VId>(s));
+    }
+    return ids;
+  }
+
+  /**
+   * @brief One batch of MS-BFS: the search of bit b starts from batch[b]. Calls
+   *        visit(b, vid, depth) once per search and vertex it reaches, including its source at
+   *        depth 0. Calls for different vertices may run concurrently.
+   *
+   * @return The number of (search, vertex) pairs reached
+   */
+  template <class G, class VId, class Visit>
+  size_t ms_bfs_batch(G&                              g,
+                      const std::vector<VId>&         batch,
+                      ms_bfs_bitsets&                 bitsets,
+                      const multi_source_bfs_options& options,
+                      Visit&                          visit) {
+    using word_type                = ms_bfs_word;
+    constexpr size_t bits_per_word = ms_bfs_bits;
+
+    const size_t n     = static_cast<size_t>(graph::num_vertices(g));
+    const size_t m     = static_cast<size_t>(graph::num_edges(g));
+    const size_t words = (batch.size() + bits_per_word - 1) / bits_per_word;
+
+    const bool use_in_edges = !options.symmetric && in_edges_available(g);
+    const bool can_pull     = use_in_edges || options.symmetric;
+
+    // Calls f(uid) for the source of each in-edge of vid
+    auto for_each_in_neighbor = [&g, use_in_edges](VId vid, auto&& f) {
+      if constexpr (has_in_edges_by_id<G>) {
+        if (use_in_edges) {
+          for (auto&& e : in_edges_of(g, vid))
+            f(static_cast<size_t>(in_edge_source_id(g, e)));
+          return;
+        }
+      }
+      for (auto&& uv : edges_of(g, vid))
+        f(static_cast<size_t>(graph::target_id(g, uv)));
+    };
+
+    bitsets.clear(n, words);
+    std::vector<word_type>& seen     = bitsets.seen;
+    std::vector<word_type>& frontier = bitsets.frontier;
+    std::vector<word_type>& next     = bitsets.next;
+    std::vector<word_type>  all(words, ~word_type{0});
+    if (batch.size() % bits_per_word != 0)
+      all.back() = (word_type{1} << (batch.size() % bits_per_word)) - 1;
+
+    size_t frontier_edges = 0, reached = batch.size();
+    for (size_t b = 0; b < batch.size(); ++b) {
+      const size_t    s    = static_cast<size_t>(batch[b]);
+      const word_type mask = word_type{1} << (b % bits_per_word);
+      frontier_edges += degree_of(g, batch[b]);
+      seen[s * words + b / bits_per_word] |= mask;
+      frontier[s * words + b / bits_per_word] |= mask;
+      visit(b, batch[b], size_t{0});
+    }
+
+    const size_t        workers = hardware_threads();
+    std::vector<size_t> local_count(workers), local_edges(workers);
+    for (size_t depth = 1;; ++depth) {
+      if (can_pull && static_cast<double>(frontier_edges) > static_cast<double>(m) / options.alpha) {
+        parallel_for(
+              size_t{0}, n,
+              [&](size_t v) {
+                word_type*       nv = &next[v * words];
+                const word_type* sv = &seen[v * words];
+                bool             done = true;
+                for (size_t k = 0; k < words; ++k)
+                  done &= sv[k] == all[k];
+                if (done)
+                  return;
+                for_each_in_neighbor(static_cast<VId>(v), [&](size_t u) {
+                  const word_type* fu = &frontier[u * words];
+                  for (size_t k = 0; k < words; ++k)
+                    nv[k] |= fu[k];
+                });
+              },
+              256);
+      } else {
+        parallel_for(
+              size_t{0}, n,
+              [&](size_t u) {
+                const word_type* fu     = &frontier[u * words];
+                word_type        active = 0;
+                for (size_t k = 0; k < words; ++k)
+                  active |= fu[k];
+                if (active == 0)
+                  return;
+                for (auto&& uv : edges_of(g, static_cast<VId>(u))) {
+                  const size_t     v  = static_cast<size_t>(graph::target_id(g, uv));
+                  const word_type* sv = &seen[v * words];
+                  for (size_t k = 0; k < words; ++k) {
+                    const word_type d = fu[k] & ~sv[k];
+                    if (d == 0)
+                      continue;
+                    std::atomic_ref<word_type> nv(next[v * words + k]);
+                    if ((nv.load(std::memory_order_relaxed) & d) != d)
+                      nv.fetch_or(d, std::memory_order_relaxed);
+                  }
+                }
+              },
+              256);
+      }
+
+      // next becomes the frontier of the searches that reached each vertex for the first time
+      std::ranges::fill(local_count, size_t{0});
+      std::ranges::fill(local_edges, size_t{0});
+      const size_t used = parallel_for_chunks(
+            size_t{0}, n,
+            [&](size_t lo, size_t hi, size_t w) {
+              size_t count = 0, degrees = 0;
+              for (size_t v = lo; v < hi; ++v) {
+                word_type* nv     = &next[v * words];
+                word_type* sv     = &seen[v * words];
+                word_type* fv     = &frontier[v * words];
+                word_type  active = 0;
+                for (size_t k = 0; k < words; ++k) {
+                  const word_type d = nv[k] & ~sv[k];
+                  sv[k] |= d;
+                  fv[k]  = d;
+                  nv[k]  = 0;
+                  active |= d;
+                }
+                if (active == 0)
+                  continue;
+                degrees += degree_of(g, static_cast<VId>(v));
+                for (size_t k = 0; k < words; ++k)
+                  for (word_type bits = fv[k]; bits != 0; bits &= bits - 1) {
+                    visit(k * bits_per_word + static_cast<size_t>(std::countr_zero(bits)), static_cast<VId>(v), depth);
+                    ++count;
+                  }
+              }
+              local_count[w] = count;
+              local_edges[w] = degrees;
+            },
+            256);
+
+      const auto   last  = static_cast<std::ptrdiff_t>(used);
+      const size_t found = std::reduce(local_count.begin(), local_count.begin() + last, size_t{0});
+      if (found == 0)
+        return reached;
+      reached += found;
+      frontier_edges = std::reduce(local_edges.begin(), local_edges.begin() + last, size_t{0});
+    }
+  }
+} // namespace detail
+
+/**
+ * @brief Breadth-first searches from each of @c sources, run in batches that share their
+ *        adjacency scans.
+ *
+ * visit(i, vid, depth) is called once for each source index i and each vertex vid reachable from
+ * sources[i], with the distance in edges (0 for the source itself). Within a search, a vertex is
+ * visited after every vertex closer to the source. A source that appears more than once is
+ * searched once per appearance.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g))
+ * @param sources Range of integral source vertex ids, checked before they are narrowed to vertex_id_t<G>
+ * @param visit   Callable as visit(size_t i, vertex_id_t<G> vid, size_t depth). Calls for different
+ *                vertices may run concurrently, including calls for the same source.
+ * @param options Batch size and direction options; set @c symmetric for undirected graphs without in-edges
+ * @return The number of (source, vertex) pairs reached
+ * @throws graph_error if a source isn't a vertex of g
+ * @note Complexity: O(k/w (V + E) D) work for k sources in words of w bits and a depth of D,
+ *       split across hardware threads
+ */
+template <index_descriptor_adjacency_list G, std::ranges::input_range Sources, class Visit>
+requires std::integral<std::ranges::range_value_t<Sources>> &&
+         std::invocable<Visit&, size_t, vertex_id_t<G>, size_t>
+size_t multi_source_bfs(G&& g, Sources&& sources, Visit&& visit, const multi_source_bfs_options& options = {}) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+
+  const size_t           n   = static_cast<size_t>(graph::num_vertices(g));
+  const std::vector<VId> ids = detail::ms_bfs_sources<VId>(n, sources);
+
+  constexpr size_t bits       = detail::ms_bfs_bits;
+  const size_t     batch_size = std::max(size_t{1}, (options.batch_size + bits - 1) / bits) * bits;
+  const size_t     words      = (std::min(batch_size, ids.size()) + bits - 1) / bits;
+
+  detail::ms_bfs_bitsets bitsets(n, words);
+  std::vector<VId>       batch;
+  size_t                 reached = 0;
+  for (size_t first = 0; first < ids.size(); first += batch_size) {
+    batch.assign(ids.begin() + static_cast<std::ptrdiff_t>(first),
+                 ids.begin() + static_cast<std::ptrdiff_t>(std::min(first + batch_size, ids.size())));
+    auto batch_visit = [&visit, first](size_t b, VId vid, size_t depth) { std::invoke(visit, first + b, vid, depth); };
+    reached += detail::ms_bfs_batch(g, batch, bitsets, options, batch_visit);
+  }
+  return reached;
+}
+
+} // namespace graph
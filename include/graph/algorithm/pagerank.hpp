@@ -0,0 +1,183 @@
+/**
+ * @file pagerank.hpp
+ * @brief Parallel pull-based PageRank
+ *
+ * @code
+ *   std::vector<double> ranks(num_vertices(g));
+ *   g.build_in_edges();                                                    // compressed_graph only
+ *   size_t iterations = pagerank(g, ranks);                                // damping 0.85, tolerance 1e-4
+ *   pagerank(g, ranks, {.damping = 0.9, .tolerance = 1e-6, .max_iterations = 50});
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  Each iteration pulls: the new rank of v is the sum of contrib[u] = rank[u] / out_degree(u) over
+//  the in-neighbors u of v, so every vertex is written by one thread and no atomics are needed.
+//
+//    rank'[v] = (1 - damping) / n + damping * (sum of contrib[u] over in-edges u->v + dangling / n)
+//
+//  where dangling is the rank of the vertices with no out-edges, spread over all vertices so the
+//  ranks keep summing to 1. Iteration stops when the L1 norm of the change is below tolerance.
+//
+//  The in-neighbors are read in place: from in_edges(g,uid) when the graph has them (dynamic_graph
+//  with an in_edges_type, or compressed_graph once build_in_edges() has been called), or from
+//  edges(g,uid) when the caller says the graph is symmetric. A directed graph without in-edges is
+//  rejected rather than transposed behind the caller's back. The gather is split into chunks with
+//  about the same number of in-edges rather than the same number of vertices, so a few high
+//  in-degree vertices don't leave the other workers idle.
+//
+//  Ranks are computed in the value type of the output range, float or double; the convergence
+//  test is accumulated in double.
+
+namespace graph {
+
+/**
+ * @brief Options of pagerank
+ */
+struct pagerank_options {
+  /// Probability of following an edge rather than jumping to a random vertex
+  double damping = 0.85;
+  /// Stop when the sum of the absolute rank changes of an iteration is below this
+  double tolerance = 1e-4;
+  /// Stop after this many iterations even if the ranks haven't converged
+  size_t max_iterations = 100;
+  /// Every edge u->v has a matching v->u, so edges(g,v) can be used as the in-edges of v
+  bool symmetric = false;
+};
+
+/**
+ * @brief PageRank of every vertex, computed in parallel by pulling from the in-neighbors.
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g)), and with in_edges(g,uid) unless it's
+ *                symmetric
+ * @param ranks   Random access range of float or double, indexed by vertex id, with at least
+ *                num_vertices(g) elements. Receives the rank of each vertex; the ranks sum to 1.
+ * @param options Damping factor, convergence tolerance, iteration limit and whether g is symmetric
+ * @return The number of iterations performed
+ * @throws graph_error if ranks is too small, damping isn't in [0,1], tolerance is negative, or g
+ *         is directed (not symmetric) and in_edges(g,uid) isn't available
+ * @note Complexity: O(V + E) per iteration
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Ranks>
+requires std::floating_point<std::ranges::range_value_t<Ranks>>
+size_t pagerank(G&& g, Ranks&& ranks, const pagerank_options& options = {}) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  using T   = std::ranges::range_value_t<Ranks>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(std::ranges::size(ranks)) < n)
+    throw graph_error("pagerank: ranks is smaller than num_vertices(g)");
+  if (!(options.damping >= 0 && options.damping <= 1))
+    throw graph_error("pagerank: damping isn't in [0,1]");
+  if (!(options.tolerance >= 0))
+    throw graph_error("pagerank: tolerance is negative");
+  if (n == 0)
+    return 0;
+
+  const bool use_in_edges = !options.symmetric && detail::in_edges_available(g);
+  if (!options.symmetric && !use_in_edges)
+    throw graph_error("pagerank: g has no in_edges(g,uid); build them or set symmetric");
+
+  // Calls f(uid) for the source of each in-edge of vid
+  auto for_each_in_neighbor = [&g, use_in_edges](VId vid, auto&& f) {
+    if constexpr (detail::has_in_edges_by_id<std::remove_reference_t<G>>) {
+      if (use_in_edges) {
+        for (auto&& e : detail::in_edges_of(g, vid))
+          f(detail::in_edge_source_id(g, e));
+        return;
+      }
+    }
+    for (auto&& uv : detail::edges_of(g, vid))
+      f(static_cast<VId>(graph::target_id(g, uv)));
+  };
+
+  // 1 / out-degree, or 0 for vertices without out-edges, and the prefix sum of the in-degrees
+  // to balance the gather
+  std::vector<T>      inv_degree(n);
+  std::vector<size_t> in_offsets(n + 1, 0);
+  detail::parallel_for(
+        size_t{0}, n,
+        [&](size_t u) {
+          const size_t d = detail::degree_of(g, u);
+          inv_degree[u]  = d == 0 ? T{0} : T{1} / static_cast<T>(d);
+          size_t in_d    = 0;
+          for_each_in_neighbor(static_cast<VId>(u), [&in_d](VId) { ++in_d; });
+          in_offsets[u + 1] = in_d;
+        },
+        4096);
+  for (size_t v = 0; v < n; ++v)
+    in_offsets[v + 1] += in_offsets[v];
+
+  const T             damping = static_cast<T>(options.damping);
+  const T             base    = (T{1} - damping) / static_cast<T>(n);
+  std::vector<T>      rank(n, T{1} / static_cast<T>(n));
+  std::vector<T>      contrib(n);
+  std::vector<double> local(detail::hardware_threads() * 8); // per-chunk dangling rank, then per-part error
+
+  size_t iteration = 0;
+  while (iteration < options.max_iterations) {
+    ++iteration;
+
+    // contrib = rank * inv_degree, and the rank of the dangling vertices
+    std::ranges::fill(local, 0.0);
+    detail::parallel_for_chunks(
+          size_t{0}, n,
+          [&](size_t lo, size_t hi, size_t w) {
+            const T* r       = rank.data();
+            const T* inv     = inv_degree.data();
+            T*       c       = contrib.data();
+            double   dangled = 0;
+            for (size_t u = lo; u < hi; ++u) {
+              c[u] = r[u] * inv[u];
+              dangled += inv[u] == T{0} ? static_cast<double>(r[u]) : 0.0;
+            }
+            local[w] = dangled;
+          },
+          1 << 14);
+    double dangling = 0;
+    for (double x : local)
+      dangling += x;
+    const T teleport = base + damping * static_cast<T>(dangling / static_cast<double>(n));
+
+    // Gather the contributions of the in-neighbors; rank is updated in place, since it's only
+    // read through contrib
+    std::ranges::fill(local, 0.0);
+    detail::parallel_for_edge_balanced(in_offsets, [&](size_t lo, size_t hi, size_t part) {
+      const T* c     = contrib.data();
+      double   error = 0;
+      for (size_t v = lo; v < hi; ++v) {
+        T sum = 0;
+        for_each_in_neighbor(static_cast<VId>(v), [&sum, c](VId uid) { sum += c[static_cast<size_t>(uid)]; });
+        const T next = teleport + damping * sum;
+        error += std::abs(static_cast<double>(next) - static_cast<double>(rank[v]));
+        rank[v] = next;
+      }
+      local[part] = error;
+    });
+    double error = 0;
+    for (double x : local)
+      error += x;
+    if (error < options.tolerance)
+      break;
+  }
+
+  auto out = std::ranges::begin(ranks);
+  detail::parallel_for(size_t{0}, n, [&](size_t v) { out[static_cast<std::ptrdiff_t>(v)] = rank[v]; }, 1 << 14);
+  return iteration;
+}
+
+} // namespace graph
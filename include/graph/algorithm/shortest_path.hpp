@@ -0,0 +1,378 @@
+/**
+ * @file shortest_path.hpp
+ * @brief Point-to-point shortest paths by bidirectional Dijkstra and A*, with reusable search state
+ *
+ * @code
+ *   shortest_path_state<double> state(num_vertices(g));  // reused by every query
+ *   double d = shortest_path(g, s, t, state);            // needs in_edges(g,u), or {.symmetric = true}
+ *   for (uint32_t vid : state.path()) ...                // s, ..., t; empty when t isn't reached
+ *
+ *   double e = astar_shortest_path(g, s, t, state, [&](uint32_t vid) { return straight_line(vid, t); });
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/algorithm/common_shortest_paths.hpp"
+#include "graph/detail/indexed_dary_heap.hpp"
+
+// NOTES
+//  A query settles the vertices around s (and around t for the bidirectional search) rather than
+//  the whole graph, so it shouldn't pay O(V) to start. shortest_path_state keeps the distances,
+//  predecessors and queues between queries, and each distance carries the number of the query that
+//  wrote it: starting a query bumps the number, which invalidates every distance at once, and only
+//  the entries left in the queues are cleared. The arrays are O(V) only when the state grows for a
+//  larger graph than it has seen, and every 2^32 queries, when the number wraps around; a smaller
+//  graph uses a prefix of them.
+//
+//  The bidirectional search alternates between a forward Dijkstra from s over the out-edges and a
+//  backward one from t over the in-edges, taking the side whose next vertex is closer. Each time an
+//  edge reaches a vertex the other side has reached, the path through it is a candidate. It stops
+//  when the two closest queued distances add up to the best candidate, since no path left can be
+//  shorter. in_edges(g,v) gives the sources u of the edges into v but not the edges themselves, so
+//  the backward side finds the weights of u->v among the out-edges of u; for graphs of small degree,
+//  like road networks, that's a few extra reads per edge. When the graph is symmetric the backward
+//  side uses the out-edges of v instead, and needs no in-edges.
+//
+//  A* is a forward Dijkstra ordered by distance + heuristic(v), stopping when t is settled. The
+//  heuristic must not overestimate the distance to t. If it's also consistent (h(u) <= w(u,v) + h(v))
+//  no vertex is settled twice; otherwise vertices may be queued again, and the result is still exact.
+
+namespace graph {
+
+/**
+ * @brief Options of shortest_path
+ */
+struct shortest_path_options {
+  /// Every edge u->v has a matching v->u of the same weight, so edges(g,v) can be used as the
+  /// in-edges of v
+  bool symmetric = false;
+};
+
+namespace detail {
+  struct shortest_path_access;
+
+  // Distances, predecessors and queue of one search direction
+  template <class D, class VId>
+  struct search_side {
+    std::vector<D>               dist;
+    std::vector<VId>             pred;
+    std::vector<uint32_t>        stamp; // query that wrote dist and pred
+    indexed_dary_heap<D, VId, 4> queue;
+
+    // Stamps already written are kept: they're older than any query to come
+    void grow(size_t n) {
+      dist.resize(n);
+      pred.resize(n);
+      stamp.resize(n, 0);
+      queue.reset(n);
+    }
+
+    [[nodiscard]] bool reached(VId v, uint32_t query) const noexcept { return stamp[static_cast<size_t>(v)] == query; }
+    [[nodiscard]] D    distance(VId v, uint32_t query) const noexcept {
+      return reached(v, query) ? dist[static_cast<size_t>(v)] : shortest_path_infinite_distance<D>();
+    }
+
+    void reach(VId v, D d, VId from, uint32_t query) noexcept {
+      dist[static_cast<size_t>(v)]  = d;
+      pred[static_cast<size_t>(v)]  = from;
+      stamp[static_cast<size_t>(v)] = query;
+    }
+  };
+} // namespace detail
+
+/**
+ * @brief Search state of shortest_path and astar_shortest_path, reused across queries so that
+ *        a query costs what it touches rather than O(V).
+ *
+ * Holds the result of the last query. A state can be used with different graphs; it grows to the
+ * number of vertices of the largest graph it's used with, and never shrinks.
+ *
+ * @tparam D   Distance type
+ * @tparam VId Vertex id type
+ */
+template <class D, class VId = uint32_t>
+class shortest_path_state {
+public:
+  using distance_type  = D;
+  using vertex_id_type = VId;
+
+  shortest_path_state() = default;
+  /// Allocates for graphs of n vertices
+  explicit shortest_path_state(size_t n) { grow(n); }
+
+  /// Length of the shortest path found by the last query, or shortest_path_infinite_distance<D>()
+  [[nodiscard]] D distance() const noexcept { return distance_; }
+  /// Vertices of the shortest path found by the last query, from s to t; empty if t wasn't reached
+  [[nodiscard]] const std::vector<VId>& path() const noexcept { return path_; }
+  /// Number of vertices the last query settled, on both sides
+  [[nodiscard]] size_t settled() const noexcept { return settled_; }
+
+private:
+  friend struct detail::shortest_path_access;
+
+  void grow(size_t n) {
+    forward_.grow(n);
+    backward_.grow(n);
+  }
+
+  // Invalidates the previous query's distances; O(entries left in the queues)
+  void start(size_t n) {
+    if (forward_.dist.size() < n)
+      grow(n);
+    if (++query_ == 0) {
+      std::ranges::fill(forward_.stamp, uint32_t{0});
+      std::ranges::fill(backward_.stamp, uint32_t{0});
+      query_ = 1;
+    }
+    forward_.queue.clear();
+    backward_.queue.clear();
+    distance_ = shortest_path_infinite_distance<D>();
+    path_.clear();
+    settled_ = 0;
+  }
+
+  detail::search_side<D, VId> forward_, backward_;
+  uint32_t                    query_    = 0;
+  D                           distance_ = shortest_path_infinite_distance<D>();
+  std::vector<VId>            path_;
+  size_t                      settled_ = 0;
+};
+
+namespace detail {
+  struct shortest_path_access {
+    template <class G, class D, class VId>
+    static void start(G& g, shortest_path_state<D, VId>& state, VId s, VId t, const char* name) {
+      const size_t n = static_cast<size_t>(graph::num_vertices(g));
+      if (static_cast<size_t>(s) >= n || static_cast<size_t>(t) >= n)
+        throw graph_error(std::string(name) + ": s or t isn't a vertex of the graph");
+      state.start(n);
+    }
+
+    // Weight of uv as a distance; throws if it's negative
+    template <class D, class EVF, class E>
+    static D weight(EVF& evf, const E& uv, const char* name) {
+      const auto w = evf(uv);
+      if constexpr (std::is_signed_v<std::remove_cvref_t<decltype(w)>>) {
+        if (w < 0)
+          throw graph_error(std::string(name) + ": negative edge weight");
+      }
+      return static_cast<D>(w);
+    }
+
+    // Path from s to meet by the forward predecessors, then to t by the backward ones
+    template <class D, class VId>
+    static void set_path(shortest_path_state<D, VId>& state, VId s, VId t, VId meet, D distance) {
+      state.distance_ = distance;
+      for (VId v = meet; v != s; v = state.forward_.pred[static_cast<size_t>(v)])
+        state.path_.push_back(v);
+      state.path_.push_back(s);
+      std::ranges::reverse(state.path_);
+      for (VId v = meet; v != t;) {
+        v = state.backward_.pred[static_cast<size_t>(v)];
+        state.path_.push_back(v);
+      }
+    }
+
+    template <class G, class D, class VId, class EVF>
+    static D bidirectional(G& g, VId s, VId t, shortest_path_state<D, VId>& state, EVF& evf, bool symmetric) {
+      constexpr D    infinite = shortest_path_infinite_distance<D>();
+      const uint32_t query    = state.query_;
+      auto&          fwd      = state.forward_;
+      auto&          bwd      = state.backward_;
+
+      fwd.reach(s, D{0}, s, query);
+      bwd.reach(t, D{0}, t, query);
+      fwd.queue.push(s, D{0});
+      bwd.queue.push(t, D{0});
+      D    best   = s == t ? D{0} : infinite;
+      VId  meet   = s;
+      auto length = [&evf](const auto& uv) { return weight<D>(evf, uv, "shortest_path"); };
+
+      // Reach v from u at distance dv on side `side`, and see if it closes a shorter path
+      auto relax = [&](search_side<D, VId>& side, const search_side<D, VId>& other, VId u, VId v, D dv) {
+        if (dv >= side.distance(v, query))
+          return;
+        side.reach(v, dv, u, query);
+        side.queue.push_or_decrease(v, dv);
+        if (other.reached(v, query)) {
+          const D through = extend_path(dv, other.dist[static_cast<size_t>(v)]);
+          if (through < best) {
+            best = through;
+            meet = v;
+          }
+        }
+      };
+
+      while (!fwd.queue.empty() && !bwd.queue.empty()) {
+        const D df = fwd.queue.top().key, db = bwd.queue.top().key;
+        if (extend_path(df, db) >= best)
+          break;
+        ++state.settled_;
+        if (df <= db) {
+          const auto [du, u] = fwd.queue.pop();
+          for (auto&& uv : edges_of(g, u))
+            relax(fwd, bwd, u, static_cast<VId>(graph::target_id(g, uv)), extend_path(du, length(uv)));
+        } else {
+          const auto [du, u] = bwd.queue.pop();
+          if (symmetric) {
+            for (auto&& uv : edges_of(g, u))
+              relax(bwd, fwd, u, static_cast<VId>(graph::target_id(g, uv)), extend_path(du, length(uv)));
+          } else if constexpr (has_in_edges_by_id<G>) {
+            for (auto&& e : in_edges_of(g, u)) {
+              const VId v = static_cast<VId>(in_edge_source_id(g, e));
+              for (auto&& vu : edges_of(g, v))
+                if (static_cast<VId>(graph::target_id(g, vu)) == u)
+                  relax(bwd, fwd, u, v, extend_path(du, length(vu)));
+            }
+          }
+        }
+      }
+
+      if (best != infinite)
+        set_path(state, s, t, meet, best);
+      return best;
+    }
+
+    template <class G, class D, class VId, class EVF, class Heuristic>
+    static D astar(G& g, VId s, VId t, shortest_path_state<D, VId>& state, EVF& evf, Heuristic& heuristic) {
+      const uint32_t query = state.query_;
+      auto&          fwd   = state.forward_;
+      auto           h     = [&heuristic](VId v) { return static_cast<D>(std::invoke(heuristic, v)); };
+
+      fwd.reach(s, D{0}, s, query);
+      fwd.queue.push(s, h(s));
+      while (!fwd.queue.empty()) {
+        const VId u = fwd.queue.pop().id;
+        ++state.settled_;
+        if (u == t) {
+          set_path(state, s, t, t, fwd.dist[static_cast<size_t>(t)]);
+          break;
+        }
+        const D du = fwd.dist[static_cast<size_t>(u)];
+        for (auto&& uv : edges_of(g, u)) {
+          const VId v  = static_cast<VId>(graph::target_id(g, uv));
+          const D   dv = extend_path(du, weight<D>(evf, uv, "astar_shortest_path"));
+          if (dv >= fwd.distance(v, query))
+            continue;
+          fwd.reach(v, dv, u, query);
+          fwd.queue.push_or_decrease(v, extend_path(dv, h(v)));
+        }
+      }
+      return state.distance_;
+    }
+  };
+} // namespace detail
+
+/**
+ * @brief Length of the shortest path from @c s to @c t, by bidirectional Dijkstra.
+ *
+ * The path itself is left in state.path().
+ *
+ * @param g       Graph with vertex ids in [0, num_vertices(g)). Needs in_edges(g,u) (dynamic_graph with
+ *                an in_edges_type, or compressed_graph after build_in_edges()) unless options.symmetric.
+ * @param s       Id of the source vertex
+ * @param t       Id of the target vertex
+ * @param state   Search state, reused across queries
+ * @param evf     Edge weight function, evf(uv); weights must not be negative
+ * @param options Set @c symmetric for undirected graphs without in-edges
+ * @return The length of the shortest path, or shortest_path_infinite_distance<D>() if t isn't reached
+ * @throws graph_error if s or t isn't a vertex of g, g has no in-edges and isn't symmetric, or an
+ *         edge weight is negative
+ * @note Complexity: O((V' + E') log V') for the V' vertices and E' edges the search touches; the
+ *       backward side also reads the out-edges of each in-neighbor
+ */
+template <index_descriptor_adjacency_list G, class D, class VId, class EVF>
+requires std::is_arithmetic_v<D> && std::invocable<EVF&, edge_t<std::remove_reference_t<G>>>
+D shortest_path(G&&                          g,
+                const vertex_id_t<G>&        s,
+                const vertex_id_t<G>&        t,
+                shortest_path_state<D, VId>& state,
+                EVF&&                        evf,
+                const shortest_path_options& options = {}) {
+  if (!options.symmetric && !detail::in_edges_available(g))
+    throw graph_error("shortest_path: g has no in-edges; build them or set options.symmetric");
+  detail::shortest_path_access::start(g, state, static_cast<VId>(s), static_cast<VId>(t), "shortest_path");
+  return detail::shortest_path_access::bidirectional(g, static_cast<VId>(s), static_cast<VId>(t), state, evf,
+                                                     options.symmetric);
+}
+
+/**
+ * @brief Length of the shortest path from @c s to @c t by bidirectional Dijkstra, with
+ *        edge_value(g,uv) as the weight of each edge.
+ */
+template <index_descriptor_adjacency_list G, class D, class VId>
+requires std::is_arithmetic_v<D> && requires(G& g, const edge_t<std::remove_reference_t<G>>& uv) {
+  { graph::edge_value(g, uv) } -> std::convertible_to<D>;
+}
+D shortest_path(G&&                          g,
+                const vertex_id_t<G>&        s,
+                const vertex_id_t<G>&        t,
+                shortest_path_state<D, VId>& state,
+                const shortest_path_options& options = {}) {
+  auto evf = [&g](const auto& uv) { return graph::edge_value(g, uv); };
+  return shortest_path(g, s, t, state, evf, options);
+}
+
+/**
+ * @brief Length of the shortest path from @c s to @c t, by A* search.
+ *
+ * The path itself is left in state.path().
+ *
+ * @param g         Graph with vertex ids in [0, num_vertices(g))
+ * @param s         Id of the source vertex
+ * @param t         Id of the target vertex
+ * @param state     Search state, reused across queries
+ * @param heuristic Estimate of the distance from a vertex to t, heuristic(vid). It must not
+ *                  overestimate; heuristic(t) is 0.
+ * @param evf       Edge weight function, evf(uv); weights must not be negative
+ * @return The length of the shortest path, or shortest_path_infinite_distance<D>() if t isn't reached
+ * @throws graph_error if s or t isn't a vertex of g, or an edge weight is negative
+ * @note Complexity: O((V' + E') log V') for the V' vertices and E' edges the search touches, with a
+ *       consistent heuristic
+ */
+template <index_descriptor_adjacency_list G, class D, class VId, class Heuristic, class EVF>
+requires std::is_arithmetic_v<D> && std::invocable<EVF&, edge_t<std::remove_reference_t<G>>> &&
+         std::invocable<Heuristic&, VId>
+D astar_shortest_path(G&&                          g,
+                      const vertex_id_t<G>&        s,
+                      const vertex_id_t<G>&        t,
+                      shortest_path_state<D, VId>& state,
+                      Heuristic&&                  heuristic,
+                      EVF&&                        evf) {
+  detail::shortest_path_access::start(g, state, static_cast<VId>(s), static_cast<VId>(t), "astar_shortest_path");
+  return detail::shortest_path_access::astar(g, static_cast<VId>(s), static_cast<VId>(t), state, evf, heuristic);
+}
+
+/**
+ * @brief Length of the shortest path from @c s to @c t by A* search, with edge_value(g,uv) as the
+ *        weight of each edge.
+ */
+template <index_descriptor_adjacency_list G, class D, class VId, class Heuristic>
+requires std::is_arithmetic_v<D> && std::invocable<Heuristic&, VId> &&
+         requires(G& g, const edge_t<std::remove_reference_t<G>>& uv) {
+           { graph::edge_value(g, uv) } -> std::convertible_to<D>;
+         }
+D astar_shortest_path(G&&                          g,
+                      const vertex_id_t<G>&        s,
+                      const vertex_id_t<G>&        t,
+                      shortest_path_state<D, VId>& state,
+                      Heuristic&&                  heuristic) {
+  auto evf = [&g](const auto& uv) { return graph::edge_value(g, uv); };
+  return astar_shortest_path(g, s, t, state, heuristic, evf);
+}
+
+} // namespace graph
@@ -0,0 +1,353 @@
+/**
+ * @file strongly_connected_components.hpp
+ * @brief Strongly connected components by iterative Tarjan, or in parallel by trimming,
+ *        forward-backward search and coloring
+ *
+ * @code
+ *   std::vector<uint32_t> comp(num_vertices(g));
+ *   size_t count = strongly_connected_components(g, comp);  // comp[v] = least vertex id in v's component
+ *
+ *   g.build_in_edges();                                      // compressed_graph only
+ *   strongly_connected_components(g, comp, {.parallel = true});
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/detail/bitmap.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  Sequentially this is Tarjan's algorithm with an explicit stack of (vertex, edge iterator)
+//  frames instead of recursion, so a path of millions of vertices doesn't overflow the call stack.
+//  It's O(V + E).
+//
+//  The parallel variant follows Slota, Rajamanickam & Madduri's Multistep method ("BFS and
+//  Coloring-based Parallel Algorithms for Strongly Connected Components", IPDPS'14), and needs the
+//  in-edges of each vertex:
+//
+//    1. Trim: a vertex with no in-edges or no out-edges (ignoring self-loops) from the vertices
+//       that are left is an SCC of its own. Removing it can trim its neighbors in turn; the
+//       counters are atomic and the trimming runs level by level, O(V + E) in all.
+//    2. Forward-backward: the SCC of a pivot is the intersection of the vertices it reaches and
+//       the vertices that reach it, both found by parallel BFS. The pivot has the largest product
+//       of in- and out-degree, so it's most likely in the giant SCC, which this removes at once.
+//    3. Coloring, until no vertex is left: each vertex takes the least id of the vertices that
+//       reach it, by propagating ids along the out-edges. A vertex whose color is its own id is the
+//       root of an SCC, made of the vertices of its color that reach it: a backward BFS within the
+//       color finds them. Each round settles at least the SCC of the least vertex left.
+//
+//  Either way each vertex is labeled with the least vertex id of its component, so the labels don't
+//  depend on the algorithm or the thread schedule.
+
+namespace graph {
+
+/**
+ * @brief Options of strongly_connected_components
+ */
+struct strongly_connected_components_options {
+  /// Use the parallel trim, forward-backward and coloring algorithm; needs in_edges(g,uid)
+  bool parallel = false;
+};
+
+namespace detail {
+  // Iterative Tarjan; labels each component with the least vertex id in it
+  template <class VId, class G>
+  void tarjan_scc(G& g, size_t n, std::vector<VId>& comp) {
+    using edge_range    = decltype(edges_of(g, VId{}));
+    using edge_iterator = std::ranges::iterator_t<edge_range>;
+    using edge_sentinel = std::ranges::sentinel_t<edge_range>;
+    struct frame {
+      VId           v;
+      edge_iterator it;
+      edge_sentinel last;
+    };
+    constexpr size_t unvisited = std::numeric_limits<size_t>::max();
+    constexpr VId    none      = std::numeric_limits<VId>::max();
+
+    std::vector<size_t> index(n, unvisited);
+    std::vector<size_t> low(n);
+    std::vector<VId>    stack; // vertices visited but not yet in a component
+    std::vector<frame>  frames;
+    size_t              next_index = 0;
+
+    auto push = [&](VId v) {
+      index[static_cast<size_t>(v)] = low[static_cast<size_t>(v)] = next_index++;
+      stack.push_back(v);
+      auto&& r = edges_of(g, v);
+      frames.push_back(frame{v, std::ranges::begin(r), std::ranges::end(r)});
+    };
+
+    for (size_t root = 0; root < n; ++root) {
+      if (index[root] != unvisited)
+        continue;
+      push(static_cast<VId>(root));
+      while (!frames.empty()) {
+        frame&       top = frames.back();
+        const size_t v   = static_cast<size_t>(top.v);
+        if (top.it != top.last) {
+          const size_t w = static_cast<size_t>(graph::target_id(g, *top.it));
+          ++top.it;
+          if (index[w] == unvisited)
+            push(static_cast<VId>(w)); // may reallocate frames, invalidating top
+          else if (comp[w] == none)
+            low[v] = std::min(low[v], index[w]);
+          continue;
+        }
+
+        frames.pop_back();
+        if (!frames.empty()) {
+          const size_t parent = static_cast<size_t>(frames.back().v);
+          low[parent]         = std::min(low[parent], low[v]);
+        }
+        if (low[v] == index[v]) {
+          auto first = stack.end();
+          do
+            --first;
+          while (static_cast<size_t>(*first) != v);
+          const VId least = *std::min_element(first, stack.end());
+          for (auto it = first; it != stack.end(); ++it)
+            comp[static_cast<size_t>(*it)] = least;
+          stack.erase(first, stack.end());
+        }
+      }
+    }
+  }
+
+  // Level-synchronous parallel traversal from the vertices of frontier: expand(v, visit) is called
+  // for each vertex of a level, and visit(w) puts w in the next one
+  template <class VId, class Expand>
+  void expand_levels(std::vector<VId> frontier, Expand&& expand) {
+    std::vector<std::vector<VId>> found(hardware_threads());
+    while (!frontier.empty()) {
+      parallel_for_chunks(
+            size_t{0}, frontier.size(),
+            [&](size_t lo, size_t hi, size_t w) {
+              auto visit = [&found, w](VId x) { found[w].push_back(x); };
+              for (size_t i = lo; i < hi; ++i)
+                expand(frontier[i], visit);
+            },
+            256);
+      frontier.clear();
+      for (auto& f : found) {
+        frontier.insert(frontier.end(), f.begin(), f.end());
+        f.clear();
+      }
+    }
+  }
+
+  // Vertices v with keep(v), found in parallel
+  template <class VId, class Keep>
+  std::vector<VId> select_vertices(size_t n, Keep&& keep) {
+    std::vector<std::vector<VId>> found(hardware_threads());
+    parallel_for_chunks(
+          size_t{0}, n,
+          [&](size_t lo, size_t hi, size_t w) {
+            for (size_t v = lo; v < hi; ++v)
+              if (keep(v))
+                found[w].push_back(static_cast<VId>(v));
+          },
+          1 << 14);
+    std::vector<VId> all;
+    for (auto& f : found)
+      all.insert(all.end(), f.begin(), f.end());
+    return all;
+  }
+
+  // Trim, forward-backward from one pivot, then coloring; labels each component with the least
+  // vertex id in it
+  template <class VId, class G>
+  void parallel_scc(G& g, size_t n, std::vector<VId>& comp) {
+    constexpr VId none = std::numeric_limits<VId>::max();
+
+    auto label = [&comp](size_t v) { return std::atomic_ref<VId>(comp[v]).load(std::memory_order_relaxed); };
+    auto claim = [&comp](size_t v, VId c) {
+      VId expected = none;
+      return std::atomic_ref<VId>(comp[v]).compare_exchange_strong(expected, c, std::memory_order_relaxed);
+    };
+    auto for_each_out = [&g](VId v, auto&& f) {
+      for (auto&& uv : edges_of(g, v))
+        f(static_cast<VId>(graph::target_id(g, uv)));
+    };
+    auto for_each_in = [&g](VId v, auto&& f) {
+      for (auto&& e : in_edges_of(g, v))
+        f(in_edge_source_id(g, e));
+    };
+
+    // 1. Trim
+    std::vector<size_t> out_degree(n), in_degree(n);
+    parallel_for(
+          size_t{0}, n,
+          [&](size_t i) {
+            const VId v   = static_cast<VId>(i);
+            size_t    out = 0, in = 0;
+            for_each_out(v, [&](VId w) { out += w != v; });
+            for_each_in(v, [&](VId u) { in += u != v; });
+            out_degree[i] = out;
+            in_degree[i]  = in;
+          },
+          1024);
+    auto drop = [&](std::vector<size_t>& degree, size_t x) {
+      return label(x) == none && std::atomic_ref<size_t>(degree[x]).fetch_sub(1, std::memory_order_relaxed) == 1 &&
+             claim(x, static_cast<VId>(x));
+    };
+    auto trimmed = select_vertices<VId>(
+          n, [&](size_t v) { return (out_degree[v] == 0 || in_degree[v] == 0) && claim(v, static_cast<VId>(v)); });
+    expand_levels(std::move(trimmed), [&](VId v, auto&& visit) {
+      for_each_out(v, [&](VId w) {
+        if (w != v && drop(in_degree, static_cast<size_t>(w)))
+          visit(w);
+      });
+      for_each_in(v, [&](VId u) {
+        if (u != v && drop(out_degree, static_cast<size_t>(u)))
+          visit(u);
+      });
+    });
+
+    // 2. Forward-backward from the vertex left with the largest in-degree * out-degree
+    std::vector<std::pair<size_t, size_t>> best(hardware_threads(), {0, n}); // (score, vertex), n for none
+    parallel_for_chunks(
+          size_t{0}, n,
+          [&](size_t lo, size_t hi, size_t w) {
+            for (size_t v = lo; v < hi; ++v) {
+              const size_t score = in_degree[v] * out_degree[v];
+              if (comp[v] == none && (best[w].second == n || score > best[w].first))
+                best[w] = {score, v};
+            }
+          },
+          1 << 14);
+    size_t pivot = n;
+    size_t most  = 0;
+    for (auto [score, v] : best)
+      if (v != n && (pivot == n || score > most)) {
+        pivot = v;
+        most  = score;
+      }
+    if (pivot != n) {
+      bitmap forward(n), backward(n);
+      forward.set(pivot);
+      backward.set(pivot);
+      const std::vector<VId> seed{static_cast<VId>(pivot)};
+      expand_levels(seed, [&](VId v, auto&& visit) {
+        for_each_out(v, [&](VId w) {
+          if (comp[static_cast<size_t>(w)] == none && forward.atomic_test_and_set(static_cast<size_t>(w)))
+            visit(w);
+        });
+      });
+      expand_levels(seed, [&](VId v, auto&& visit) {
+        for_each_in(v, [&](VId u) {
+          if (comp[static_cast<size_t>(u)] == none && backward.atomic_test_and_set(static_cast<size_t>(u)))
+            visit(u);
+        });
+      });
+      parallel_for(
+            size_t{0}, n,
+            [&](size_t v) {
+              if (forward.test(v) && backward.test(v))
+                comp[v] = static_cast<VId>(pivot);
+            },
+            1 << 14);
+    }
+
+    // 3. Coloring
+    std::vector<VId> color(n);
+    for (;;) {
+      const std::vector<VId> left = select_vertices<VId>(n, [&](size_t v) { return comp[v] == none; });
+      if (left.empty())
+        break;
+      parallel_for(size_t{0}, left.size(), [&](size_t i) { color[static_cast<size_t>(left[i])] = left[i]; }, 1 << 14);
+
+      // Each vertex takes the least id that reaches it
+      expand_levels(left, [&](VId v, auto&& visit) {
+        const VId c = std::atomic_ref<VId>(color[static_cast<size_t>(v)]).load(std::memory_order_relaxed);
+        for_each_out(v, [&](VId w) {
+          if (comp[static_cast<size_t>(w)] == none && atomic_fetch_min(color[static_cast<size_t>(w)], c))
+            visit(w);
+        });
+      });
+
+      // The vertices of a root's color that reach it are its SCC
+      std::vector<VId> roots;
+      for (const VId v : left)
+        if (color[static_cast<size_t>(v)] == v) {
+          comp[static_cast<size_t>(v)] = v;
+          roots.push_back(v);
+        }
+      expand_levels(std::move(roots), [&](VId v, auto&& visit) {
+        const VId c = color[static_cast<size_t>(v)];
+        for_each_in(v, [&](VId u) {
+          if (color[static_cast<size_t>(u)] == c && claim(static_cast<size_t>(u), c))
+            visit(u);
+        });
+      });
+    }
+
+    // Label each component with its least vertex id
+    std::vector<VId> least(n, none);
+    parallel_for(
+          size_t{0}, n, [&](size_t v) { atomic_fetch_min(least[static_cast<size_t>(comp[v])], static_cast<VId>(v)); },
+          1 << 14);
+    parallel_for(size_t{0}, n, [&](size_t v) { comp[v] = least[static_cast<size_t>(comp[v])]; }, 1 << 14);
+  }
+} // namespace detail
+
+/**
+ * @brief Label each vertex with its strongly connected component.
+ *
+ * @param g          Graph with vertex ids in [0, num_vertices(g)), and with in_edges(g,uid) for the
+ *                   parallel variant
+ * @param components Random access range of integral values, indexed by vertex id, with at least
+ *                   num_vertices(g) elements. Receives the least vertex id of each vertex's component.
+ * @param options    Whether to run the parallel variant
+ * @return The number of strongly connected components
+ * @throws graph_error if components is too small, or the parallel variant is asked for and
+ *         in_edges(g,uid) isn't available
+ * @note Complexity: O(V + E) sequentially. In parallel, O(V + E) work for trimming and the
+ *       forward-backward step, then O(V + E) work per coloring round.
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Components>
+requires std::integral<std::ranges::range_value_t<Components>>
+size_t strongly_connected_components(G&&                                         g,
+                                     Components&&                                components,
+                                     const strongly_connected_components_options& options = {}) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  using C   = std::ranges::range_value_t<Components>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(std::ranges::size(components)) < n)
+    throw graph_error("strongly_connected_components: components is smaller than num_vertices(g)");
+  if (options.parallel && !detail::in_edges_available(g))
+    throw graph_error("strongly_connected_components: the parallel variant needs in_edges(g,uid); build them");
+
+  std::vector<VId> comp(n, std::numeric_limits<VId>::max());
+  if constexpr (detail::has_in_edges_by_id<std::remove_reference_t<G>>) {
+    if (options.parallel)
+      detail::parallel_scc<VId>(g, n, comp);
+    else
+      detail::tarjan_scc<VId>(g, n, comp);
+  } else {
+    detail::tarjan_scc<VId>(g, n, comp);
+  }
+
+  auto   out   = std::ranges::begin(components);
+  size_t count = 0;
+  for (size_t v = 0; v < n; ++v) {
+    out[static_cast<std::ptrdiff_t>(v)] = static_cast<C>(comp[v]);
+    count += static_cast<size_t>(comp[v]) == v;
+  }
+  return count;
+}
+
+} // namespace graph
@@ -0,0 +1,172 @@
+/**
+ * @file topological_sort.hpp
+ * @brief Parallel topological sort and DAG levels by Kahn's algorithm
+ *
+ * @code
+ *   std::vector<uint32_t> order(num_vertices(g));
+ *   topological_sort(g, order);               // every edge u->v has u before v in order
+ *
+ *   std::vector<uint32_t> levels(num_vertices(g));
+ *   size_t depth = dag_levels(g, levels);     // levels[v] = edges on the longest path ending at v
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  Kahn's algorithm, one level at a time. Level 0 is the vertices with no in-edges. Processing a
+//  level decrements the in-degree of the targets of its out-edges, and the vertices whose in-degree
+//  drops to zero form the next level. The edges of a level are split across workers; the in-degree
+//  counters are atomic, and the worker whose decrement reaches zero owns the vertex.
+//
+//  A vertex joins a level once all of its predecessors have been processed, so its level is the
+//  length of the longest path from a source to it. Each level is sorted by id before it's used:
+//  the order and the levels don't depend on the thread schedule.
+//
+//  A cycle leaves the in-degrees of its vertices above zero forever, so the levels run out before
+//  every vertex is reached. That's reported with graph_error rather than by looping.
+
+namespace graph {
+
+namespace detail {
+  /**
+   * @brief Call visit(level_vertices, level) for each level of g, in order.
+   *
+   * @return The number of vertices visited; less than n if g has a cycle
+   */
+  template <class VId, class G, class Visit>
+  size_t for_each_dag_level(G& g, size_t n, Visit&& visit) {
+    std::vector<size_t> in_degree(n, 0);
+    parallel_for(
+          size_t{0}, n,
+          [&](size_t u) {
+            for (auto&& uv : edges_of(g, u))
+              std::atomic_ref<size_t>(in_degree[static_cast<size_t>(graph::target_id(g, uv))])
+                    .fetch_add(1, std::memory_order_relaxed);
+          },
+          1024);
+
+    // Vertices found by each worker, gathered into the next level
+    std::vector<std::vector<VId>> found(hardware_threads());
+    std::vector<VId>              level_vertices;
+    auto                          gather = [&] {
+      level_vertices.clear();
+      for (auto& f : found) {
+        level_vertices.insert(level_vertices.end(), f.begin(), f.end());
+        f.clear();
+      }
+      std::ranges::sort(level_vertices);
+    };
+
+    parallel_for_chunks(
+          size_t{0}, n,
+          [&](size_t lo, size_t hi, size_t w) {
+            for (size_t u = lo; u < hi; ++u)
+              if (in_degree[u] == 0)
+                found[w].push_back(static_cast<VId>(u));
+          },
+          1 << 14);
+    gather();
+
+    size_t visited = 0;
+    for (size_t level = 0; !level_vertices.empty(); ++level) {
+      visit(std::span<const VId>(level_vertices), level);
+      visited += level_vertices.size();
+      parallel_for_chunks(
+            size_t{0}, level_vertices.size(),
+            [&](size_t lo, size_t hi, size_t w) {
+              for (size_t i = lo; i < hi; ++i)
+                for (auto&& uv : edges_of(g, level_vertices[i])) {
+                  const VId vid = static_cast<VId>(graph::target_id(g, uv));
+                  if (std::atomic_ref<size_t>(in_degree[static_cast<size_t>(vid)]).fetch_sub(1, std::memory_order_relaxed) == 1)
+                    found[w].push_back(vid);
+                }
+            },
+            256);
+      gather();
+    }
+    return visited;
+  }
+} // namespace detail
+
+/**
+ * @brief Order the vertices of a directed acyclic graph so every edge goes forward, in parallel.
+ *
+ * Vertices are ordered by level (see dag_levels), and by id within a level.
+ *
+ * @param g     Graph with vertex ids in [0, num_vertices(g))
+ * @param order Random access range of integral values with at least num_vertices(g) elements.
+ *              Receives the vertex ids in topological order.
+ * @throws graph_error if order is too small, or g has a cycle (a self-loop is one). order is left
+ *         partially written.
+ * @note Complexity: O(V + E) work, plus O(V log V) to sort the levels
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Order>
+requires std::integral<std::ranges::range_value_t<Order>>
+void topological_sort(G&& g, Order&& order) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  using O   = std::ranges::range_value_t<Order>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(std::ranges::size(order)) < n)
+    throw graph_error("topological_sort: order is smaller than num_vertices(g)");
+
+  auto         out      = std::ranges::begin(order);
+  size_t       position = 0;
+  const size_t visited  = detail::for_each_dag_level<VId>(g, n, [&](std::span<const VId> vertices, size_t) {
+    for (const VId uid : vertices)
+      out[static_cast<std::ptrdiff_t>(position++)] = static_cast<O>(uid);
+  });
+  if (visited < n)
+    throw graph_error("topological_sort: g has a cycle");
+}
+
+/**
+ * @brief Level of each vertex of a directed acyclic graph: the number of edges on the longest path
+ *        from a vertex without in-edges to it. Computed in parallel.
+ *
+ * @param g      Graph with vertex ids in [0, num_vertices(g))
+ * @param levels Random access range of integral values, indexed by vertex id, with at least
+ *               num_vertices(g) elements. Receives the level of each vertex.
+ * @return The number of levels: one more than the longest path, or 0 for an empty graph
+ * @throws graph_error if levels is too small, or g has a cycle (a self-loop is one). levels is left
+ *         partially written.
+ * @note Complexity: O(V + E) work, plus O(V log V) to sort the levels
+ */
+template <index_descriptor_adjacency_list G, std::ranges::random_access_range Levels>
+requires std::integral<std::ranges::range_value_t<Levels>>
+size_t dag_levels(G&& g, Levels&& levels) {
+  using VId = std::remove_cvref_t<vertex_id_t<G>>;
+  using L   = std::ranges::range_value_t<Levels>;
+
+  const size_t n = static_cast<size_t>(graph::num_vertices(g));
+  if (static_cast<size_t>(std::ranges::size(levels)) < n)
+    throw graph_error("dag_levels: levels is smaller than num_vertices(g)");
+
+  auto         out   = std::ranges::begin(levels);
+  size_t       count = 0;
+  const size_t visited = detail::for_each_dag_level<VId>(g, n, [&](std::span<const VId> vertices, size_t level) {
+    detail::parallel_for(
+          size_t{0}, vertices.size(),
+          [&](size_t i) { out[static_cast<std::ptrdiff_t>(vertices[i])] = static_cast<L>(level); }, 1 << 14);
+    count = level + 1;
+  });
+  if (visited < n)
+    throw graph_error("dag_levels: g has a cycle");
+  return count;
+}
+
+} // namespace graph
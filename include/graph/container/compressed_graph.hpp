@@ -6,6 +6,7 @@
 #include <functional>
 #include <algorithm>
 #include <ranges>
+#include <span>
 #include <cstdint>
 #include <cassert>
 #include <format>
@@ -16,6 +17,7 @@
 #include "graph/descriptor_traits.hpp"
 #include "graph/vertex_descriptor_view.hpp"
 #include "graph/edge_descriptor_view.hpp"
+#include "memory_usage.hpp"
 
 // NOTES
 //  have public load_edges(...), load_vertices(...), and load()
@@ -334,7 +336,7 @@ public:
 public: // Properties
   [[nodiscard]] constexpr size_type size() const noexcept { return static_cast<size_type>(v_.size()); }
   [[nodiscard]] constexpr bool      empty() const noexcept { return v_.empty(); }
-  [[nodiscard]] constexpr size_type capacity() const noexcept { return static_cast<size_type>(v_.size()); }
+  [[nodiscard]] constexpr size_type capacity() const noexcept { return static_cast<size_type>(v_.capacity()); }
 
 public: // Operations
   constexpr void reserve(size_type new_cap) { v_.reserve(new_cap); }
@@ -420,6 +422,11 @@ class compressed_graph_base
   using col_allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<col_type>;
   using col_index_vector   = std::vector<col_type, col_allocator_type>;
 
+  using in_row_allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<EIndex>;
+  using in_row_index_vector   = std::vector<EIndex, in_row_allocator_type>; // index into in_col_index_
+  using in_col_allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<VId>;
+  using in_col_index_vector   = std::vector<VId, in_col_allocator_type>; // source_id
+
 public: // Types
   using graph_type = compressed_graph_base<EV, VV, GV, VId, EIndex, Alloc>;
 
@@ -505,6 +512,8 @@ public: // Properties - resolve ambiguity from multiple inheritance
   constexpr void clear() noexcept { 
     row_index_.clear();
     col_index_.clear();
+    in_row_index_.clear();
+    in_col_index_.clear();
     row_values_base::clear();
     col_values_base::clear();
     partition_.clear();
@@ -615,6 +624,41 @@ public: // Operations
     static_cast<col_values_base&>(*this).reserve(edge_count);
   }
 
+  /**
+   * @brief Build the in-edge index so that in_edges(g,u) and in_degree(g,u) can be used.
+   * 
+   * The index is the transpose of the CSR (a CSC): the source ids of the incoming edges of each
+   * vertex, in increasing order. It takes O(V + E) time and E vertex ids plus V+1 edge indexes of
+   * memory, and it's kept until clear(). Until it's built in_edges(g,u) and in_degree(g,u) throw
+   * graph_error; use has_in_edges() to check first.
+   * 
+   * Call it after the edges have been loaded.
+  */
+  void build_in_edges() {
+    const size_t n = size();
+    in_row_index_  = in_row_index_vector(n + 1, edge_index_type{0}, in_row_allocator_type(row_index_.get_allocator()));
+    in_col_index_  = in_col_index_vector(col_index_.size(), vertex_id_type{0}, in_col_allocator_type(row_index_.get_allocator()));
+
+    // Counting sort of the edges by target; visiting the sources in order keeps each list sorted
+    for (const col_type& col : col_index_)
+      ++in_row_index_[static_cast<size_t>(col.index) + 1];
+    for (size_t v = 0; v < n; ++v)
+      in_row_index_[v + 1] = static_cast<edge_index_type>(in_row_index_[v + 1] + in_row_index_[v]);
+    in_row_index_vector next(in_row_index_.begin(), in_row_index_.end() - 1, in_row_index_.get_allocator());
+    for (size_t u = 0; u < n; ++u) {
+      for (size_t e = static_cast<size_t>(row_index_[u].index); e < static_cast<size_t>(row_index_[u + 1].index); ++e) {
+        edge_index_type& pos = next[static_cast<size_t>(col_index_[e].index)];
+        in_col_index_[static_cast<size_t>(pos)] = static_cast<vertex_id_type>(u);
+        ++pos;
+      }
+    }
+  }
+
+  /**
+   * @brief Whether build_in_edges() has been called since the graph was last cleared.
+  */
+  [[nodiscard]] constexpr bool has_in_edges() const noexcept { return !in_row_index_.empty(); }
+
   /**
    * @brief Load vertex values, callable either before or after @c load_edges(erng,eproj).
    *
@@ -1067,6 +1111,18 @@ private:                       // Member variables
   col_index_vector col_index_; // col_index_[n] holds the column index (aka target)
   partition_vector partition_; // partition_[n] holds the first vertex id for each partition n
                                // holds +1 extra terminating partition
+  in_row_index_vector in_row_index_; // starting index into in_col_index_; empty until build_in_edges()
+  in_col_index_vector in_col_index_; // in_col_index_[n] holds the source id of an incoming edge
+
+  // Source ids of the incoming edges of vertex vid; throws if the in-edge index hasn't been built
+  [[nodiscard]] std::span<const vertex_id_type> in_edge_sources(size_t vid) const {
+    if (in_row_index_.empty())
+      throw graph_error("compressed_graph: in_edges(g,u) needs build_in_edges() first");
+    if (vid >= size())
+      return {};
+    const auto first = static_cast<size_t>(in_row_index_[vid]);
+    return std::span<const vertex_id_type>(in_col_index_.data() + first, static_cast<size_t>(in_row_index_[vid + 1]) - first);
+  }
 
 private:
   friend row_values_base;
@@ -1271,6 +1327,36 @@ public: // Friend functions
     return edge_desc_view(start_idx, end_idx, source_vd);
   }
 
+  /**
+   * @brief Get the source ids of the incoming edges of a vertex.
+   * 
+   * The in-edge index must have been built with build_in_edges().
+   * 
+   * @param g The graph
+   * @param u The vertex descriptor
+   * @return A contiguous range with the source id of each edge that has u as its target, in
+   *         increasing order
+   * @throws graph_error if build_in_edges() hasn't been called
+   * @note Complexity: O(1)
+   * @note This is the ADL customization point for the in_edges(g, u) and in_degree(g, u) CPOs
+  */
+  template<typename G, vertex_descriptor_type VertexDesc>
+    requires std::derived_from<std::remove_cvref_t<G>, compressed_graph_base>
+  [[nodiscard]] friend constexpr auto in_edges(G&& g, const VertexDesc& u) {
+    return g.in_edge_sources(static_cast<size_t>(u.vertex_id()));
+  }
+
+  /**
+   * @brief Get the source ids of the incoming edges of the vertex with id @c uid.
+   * 
+   * See in_edges(g,u). An id that isn't a vertex of the graph has no in-edges.
+  */
+  template<typename G, std::integral VId2>
+    requires std::derived_from<std::remove_cvref_t<G>, compressed_graph_base>
+  [[nodiscard]] friend constexpr auto in_edges(G&& g, const VId2& uid) {
+    return g.in_edge_sources(static_cast<size_t>(uid));
+  }
+
   /**
    * @brief Get the target vertex ID from an edge descriptor
    * 
@@ -1310,6 +1396,39 @@ public: // Friend functions
     return static_cast<size_type>(g.col_index_.size());
   }
 
+  /**
+   * @brief Get the heap memory held by the graph, split by use (see graph_memory_usage)
+   * 
+   * The row index (including its terminating row) is reported as vertices and the column index
+   * as edges, together with the in-edge index when it has been built.
+   * 
+   * @param g The graph
+   * @return The bytes held by each part of the graph
+   * @note Complexity: O(1). Nothing is allocated.
+  */
+  [[nodiscard]] friend graph_memory_usage memory_usage(const compressed_graph_base& g) noexcept {
+    using detail::container_memory;
+    graph_memory_usage mu;
+    const auto rb = container_memory(g.row_index_, g.row_index_.size());
+    const auto cb = container_memory(g.col_index_, g.col_index_.size());
+    const auto pb = container_memory(g.partition_, g.partition_.size());
+    const auto ir = container_memory(g.in_row_index_, g.in_row_index_.size());
+    const auto ic = container_memory(g.in_col_index_, g.in_col_index_.size());
+    mu.vertices   = rb.held - rb.slack;
+    mu.edges      = cb.held - cb.slack + ir.held - ir.slack + ic.held - ic.slack;
+    mu.partitions = pb.held - pb.slack;
+    mu.slack      = rb.slack + cb.slack + pb.slack + ir.slack + ic.slack;
+    if constexpr (!std::is_void_v<VV>) {
+      mu.vertex_values = g.row_values_base::size() * sizeof(VV);
+      mu.slack += (g.row_values_base::capacity() - g.row_values_base::size()) * sizeof(VV);
+    }
+    if constexpr (!std::is_void_v<EV>) {
+      mu.edge_values = g.col_values_base::size() * sizeof(EV);
+      mu.slack += (g.col_values_base::capacity() - g.col_values_base::size()) * sizeof(EV);
+    }
+    return mu;
+  }
+
   /**
    * @brief Get the number of outgoing edges from a specific vertex
    * 
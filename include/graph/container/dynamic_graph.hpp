@@ -4,11 +4,15 @@
 #include <concepts>
 #include <algorithm>
 #include <limits>
+#include <optional>
+#include <unordered_map>
 #include <stdexcept>
 #include <cassert>
 #include "graph/graph.hpp"
 #include "graph/vertex_descriptor_view.hpp"
 #include "container_utility.hpp"
+#include "memory_usage.hpp"
+#include "graph/detail/parallel.hpp"
 
 // load_vertices(vrng, vvalue_fnc) -> [uid,vval]
 //
@@ -37,6 +41,8 @@ namespace graph::container {
 //   #include <graph/container/traits/vofl_graph_traits.hpp>  // vector + forward_list
 //   #include <graph/container/traits/vol_graph_traits.hpp>   // vector + list
 //   #include <graph/container/traits/vov_graph_traits.hpp>   // vector + vector
+//   #include <graph/container/traits/vov_bidirectional_graph_traits.hpp> // vector + vector, with in-edges
+//   #include <graph/container/traits/vob_graph_traits.hpp>   // vector + pooled edge blocks
 //   #include <graph/container/traits/vod_graph_traits.hpp>   // vector + deque
 //   #include <graph/container/traits/dofl_graph_traits.hpp>  // deque + forward_list
 //   #include <graph/container/traits/dol_graph_traits.hpp>   // deque + list
@@ -51,10 +57,10 @@ struct vofl_graph_traits;
 template <class EV, class VV, class GV, class VId, bool Sourced>
 struct vol_graph_traits;
 
-template <class EV, class VV, class GV, class VId, bool Sourced>
+template <class EV, class VV, class GV, class VId, bool Sourced, bool Tombstones, size_t EdgeIndexThreshold>
 struct vov_graph_traits;
 
-template <class EV, class VV, class GV, class VId, bool Sourced>
+template <class EV, class VV, class GV, class VId, bool Sourced, bool Tombstones>
 struct vod_graph_traits;
 
 template <class EV, class VV, class GV, class VId, bool Sourced>
@@ -63,13 +69,13 @@ struct dofl_graph_traits;
 template <class EV, class VV, class GV, class VId, bool Sourced>
 struct dol_graph_traits;
 
-template <class EV, class VV, class GV, class VId, bool Sourced>
+template <class EV, class VV, class GV, class VId, bool Sourced, bool Tombstones, size_t EdgeIndexThreshold>
 struct dov_graph_traits;
 
-template <class EV, class VV, class GV, class VId, bool Sourced>
+template <class EV, class VV, class GV, class VId, bool Sourced, bool Tombstones>
 struct dod_graph_traits;
 
-template <class EV, class VV, class GV, class VId, bool Sourced>
+template <class EV, class VV, class GV, class VId, bool Sourced, bool Ordinals>
 struct mofl_graph_traits;
 
 
@@ -91,6 +97,61 @@ template <class EV     = void,
           class Traits = vofl_graph_traits<EV, VV, GV, VId, Sourced>>
 class dynamic_graph;
 
+//--------------------------------------------------------------------------------------------------
+// dynamic_graph trait options
+//
+// Options are enabled by declaring an extra member in the Traits struct. Traits that don't declare
+// it are unaffected and pay nothing for it.
+//
+//   in_edges_type  A container of vertex ids (e.g. std::vector<VId>) that holds the source ids of the
+//                  incoming edges of each vertex. It's maintained by load_edges() and the other
+//                  edge-modifying operations and is exposed through in_edges(g,u) & in_degree(g,u).
+//
+//   tombstone_edges  A static constexpr bool. When true, erase_edge() marks an edge dead rather than
+//                  removing it from the edge container, so iterators, indices and edge descriptors
+//                  held by readers stay valid. edges(g,u) skips dead edges and compact(g) reclaims
+//                  them. It requires a random access edge container (vector or deque).
+//
+//   edge_index_threshold  A static constexpr size_t. When non-zero, each vertex whose degree reaches
+//                  it keeps a hash index from target id to the position of its first edge to that
+//                  target. The graph's contains_edge() and find_vertex_edge() members use it, which
+//                  the CPOs prefer over their linear scan. It requires a random access edge container.
+//
+//   vertex_ordinals A static constexpr bool. When true, each vertex of a map or unordered_map vertex
+//                  container keeps a dense ordinal 0..N-1 in vertices(g) order, which vertex
+//                  descriptors return from ordinal() in O(1) (see vertex_property_map).
+//
+
+/**
+ * @brief Does the Traits type request a reverse (incoming) adjacency on each vertex?
+ */
+template <class Traits>
+concept has_in_edges_type = requires { typename Traits::in_edges_type; };
+
+/**
+ * @brief Does the Traits type request that erased edges are marked dead rather than removed?
+ */
+template <class Traits>
+concept has_tombstone_edges = requires {
+  { Traits::tombstone_edges } -> std::convertible_to<bool>;
+} && Traits::tombstone_edges;
+
+/**
+ * @brief Does the Traits type request a hash index of the targets of high-degree vertices?
+ */
+template <class Traits>
+concept has_edge_index = requires {
+  { Traits::edge_index_threshold } -> std::convertible_to<size_t>;
+} && (Traits::edge_index_threshold > 0);
+
+/**
+ * @brief Does the Traits type request a dense ordinal on each vertex of an associative vertex container?
+ */
+template <class Traits>
+concept has_vertex_ordinals = requires {
+  { Traits::vertex_ordinals } -> std::convertible_to<bool>;
+} && Traits::vertex_ordinals;
+
 //--------------------------------------------------------------------------------------------------
 
 //--------------------------------------------------------------------------------------------------
@@ -101,6 +162,8 @@ class dynamic_graph;
 //   #include <graph/container/traits/vofl_graph_traits.hpp>  // vector + forward_list
 //   #include <graph/container/traits/vol_graph_traits.hpp>   // vector + list
 //   #include <graph/container/traits/vov_graph_traits.hpp>   // vector + vector
+//   #include <graph/container/traits/vov_bidirectional_graph_traits.hpp> // vector + vector, with in-edges
+//   #include <graph/container/traits/vob_graph_traits.hpp>   // vector + pooled edge blocks
 //   #include <graph/container/traits/vod_graph_traits.hpp>   // vector + deque
 //   #include <graph/container/traits/dofl_graph_traits.hpp>  // deque + forward_list
 //   #include <graph/container/traits/dol_graph_traits.hpp>   // deque + list
@@ -625,6 +688,268 @@ public:
 // dynamic_vertex
 //
 
+/**
+ * @ingroup graph_containers
+ * @brief Implementation of the reverse (incoming) adjacency of a vertex in a @c dynamic_graph.
+ *
+ * It's a composable class of dynamic_vertex_base that holds the source ids of the edges that have
+ * the vertex as their target. It's only present when @c Traits defines @c in_edges_type; the
+ * specialization for @c false is empty so no space is used otherwise.
+ *
+ * The container is owned by the graph and is kept in sync with the outgoing edges by load_edges()
+ * and the other edge-modifying operations. It isn't meant to be modified directly.
+ *
+ * @tparam EV      The edge value type.
+ * @tparam VV      The vertex value type.
+ * @tparam GV      The graph value type.
+ * @tparam VId     Vertex id type
+ * @tparam Sourced Is a source vertex id stored on the edge?
+ * @tparam Traits  Defines the types for vertex and edge containers, including @c in_edges_type.
+*/
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits, bool = has_in_edges_type<Traits>>
+class dynamic_vertex_in_edges {
+public:
+  using vertex_id_type = VId;
+  using in_edges_type  = typename Traits::in_edges_type;
+  using allocator_type = typename in_edges_type::allocator_type;
+
+  static_assert(std::convertible_to<typename in_edges_type::value_type, VId>,
+                "Traits::in_edges_type must hold vertex ids");
+
+public:
+  constexpr dynamic_vertex_in_edges()                                = default;
+  constexpr dynamic_vertex_in_edges(const dynamic_vertex_in_edges&) = default;
+  constexpr dynamic_vertex_in_edges(dynamic_vertex_in_edges&&)      = default;
+  constexpr ~dynamic_vertex_in_edges()                               = default;
+
+  constexpr dynamic_vertex_in_edges& operator=(const dynamic_vertex_in_edges&) = default;
+  constexpr dynamic_vertex_in_edges& operator=(dynamic_vertex_in_edges&&)      = default;
+
+  template <class Alloc>
+  constexpr dynamic_vertex_in_edges(const Alloc& alloc) : in_edges_(allocator_type(alloc)) {}
+
+public:
+  constexpr in_edges_type&       in_edges() noexcept { return in_edges_; }
+  constexpr const in_edges_type& in_edges() const noexcept { return in_edges_; }
+
+private:
+  in_edges_type in_edges_;
+};
+
+/**
+ * @ingroup graph_containers
+ * @brief Implementation of the reverse adjacency of a vertex when @c Traits doesn't define
+ * @c in_edges_type. No space is used and @c in_edges(g,u) will generate a compile error.
+*/
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
+class dynamic_vertex_in_edges<EV, VV, GV, VId, Sourced, Traits, false> {
+public:
+  constexpr dynamic_vertex_in_edges() = default;
+
+  template <class Alloc>
+  constexpr dynamic_vertex_in_edges(const Alloc&) {}
+};
+
+/**
+ * @ingroup graph_containers
+ * @brief Implementation of the tombstones (dead edge marks) of a vertex in a @c dynamic_graph.
+ *
+ * It's a composable class of dynamic_vertex_base that's only present when @c Traits::tombstone_edges
+ * is true; the specialization for @c false is empty so no space is used otherwise.
+ *
+ * Edge @c i of the vertex is dead when @c i < dead_.size() and @c dead_[i] is set. The mask is only
+ * allocated on the first erase and is never longer than the edge container, so edges appended after
+ * an erase are live without touching the mask.
+ *
+ * @tparam EV      The edge value type.
+ * @tparam VV      The vertex value type.
+ * @tparam GV      The graph value type.
+ * @tparam VId     Vertex id type
+ * @tparam Sourced Is a source vertex id stored on the edge?
+ * @tparam Traits  Defines the types for vertex and edge containers, including @c tombstone_edges.
+*/
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits, bool = has_tombstone_edges<Traits>>
+class dynamic_vertex_tombstones {
+public:
+  using mask_type = std::vector<bool>;
+
+  static_assert(std::random_access_iterator<typename Traits::edges_type::iterator>,
+                "tombstone_edges requires a random access edges_type");
+
+public:
+  constexpr dynamic_vertex_tombstones()                                  = default;
+  constexpr dynamic_vertex_tombstones(const dynamic_vertex_tombstones&) = default;
+  constexpr dynamic_vertex_tombstones(dynamic_vertex_tombstones&&)      = default;
+  constexpr ~dynamic_vertex_tombstones()                                 = default;
+
+  constexpr dynamic_vertex_tombstones& operator=(const dynamic_vertex_tombstones&) = default;
+  constexpr dynamic_vertex_tombstones& operator=(dynamic_vertex_tombstones&&)      = default;
+
+  template <class Alloc>
+  constexpr dynamic_vertex_tombstones(const Alloc&) {}
+
+public:
+  [[nodiscard]] constexpr bool is_dead_edge(size_t i) const noexcept { return i < dead_.size() && dead_[i]; }
+
+  // Number of dead edges in the vertex's edge container
+  [[nodiscard]] constexpr size_t dead_edge_count() const noexcept { return dead_count_; }
+
+  // The mask of dead edges and their count, for views that must see later erases
+  [[nodiscard]] constexpr const mask_type* dead_edges() const noexcept { return &dead_; }
+  [[nodiscard]] constexpr const size_t*    dead_edge_count_ptr() const noexcept { return &dead_count_; }
+
+  // Mark edge i of an edge container of size n dead. Returns false if it was already dead.
+  constexpr bool mark_dead_edge(size_t i, size_t n) {
+    if (dead_.size() < n)
+      dead_.resize(n, false);
+    if (dead_[i])
+      return false;
+    dead_[i] = true;
+    ++dead_count_;
+    return true;
+  }
+
+  constexpr void clear_dead_edges() noexcept {
+    dead_.clear();
+    dead_count_ = 0;
+  }
+
+  // Heap bytes held by the mask
+  [[nodiscard]] constexpr size_t dead_edges_bytes() const noexcept {
+    return dead_.capacity() ? graph::container::detail::heap_block_bytes((dead_.capacity() + 7) / 8) : 0;
+  }
+
+private:
+  mask_type dead_;
+  size_t    dead_count_ = 0;
+};
+
+/**
+ * @ingroup graph_containers
+ * @brief Implementation of the tombstones of a vertex when @c Traits::tombstone_edges isn't true.
+ * No space is used and erased edges are removed from the edge container.
+*/
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
+class dynamic_vertex_tombstones<EV, VV, GV, VId, Sourced, Traits, false> {
+public:
+  constexpr dynamic_vertex_tombstones() = default;
+
+  template <class Alloc>
+  constexpr dynamic_vertex_tombstones(const Alloc&) {}
+};
+
+/**
+ * @ingroup graph_containers
+ * @brief Implementation of the target index of a vertex in a @c dynamic_graph.
+ *
+ * It's a composable class of dynamic_vertex_base that's only present when
+ * @c Traits::edge_index_threshold is non-zero; the specialization for @c false is empty so no space
+ * is used otherwise.
+ *
+ * The index maps each target id to the position of the first live edge to it in the vertex's edge
+ * container. It's only built once the vertex's degree reaches the threshold, so low-degree vertices
+ * hold an empty optional. It's maintained by the graph and isn't meant to be modified directly.
+ *
+ * @tparam EV      The edge value type.
+ * @tparam VV      The vertex value type.
+ * @tparam GV      The graph value type.
+ * @tparam VId     Vertex id type
+ * @tparam Sourced Is a source vertex id stored on the edge?
+ * @tparam Traits  Defines the types for vertex and edge containers, including @c edge_index_threshold.
+*/
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits, bool = has_edge_index<Traits>>
+class dynamic_vertex_edge_index {
+public:
+  using index_type = std::unordered_map<VId, size_t>;
+
+  static constexpr size_t edge_index_threshold = Traits::edge_index_threshold;
+
+  static_assert(std::random_access_iterator<typename Traits::edges_type::iterator>,
+                "edge_index_threshold requires a random access edges_type");
+
+public:
+  constexpr dynamic_vertex_edge_index()                                  = default;
+  constexpr dynamic_vertex_edge_index(const dynamic_vertex_edge_index&) = default;
+  constexpr dynamic_vertex_edge_index(dynamic_vertex_edge_index&&)      = default;
+  constexpr ~dynamic_vertex_edge_index()                                 = default;
+
+  constexpr dynamic_vertex_edge_index& operator=(const dynamic_vertex_edge_index&) = default;
+  constexpr dynamic_vertex_edge_index& operator=(dynamic_vertex_edge_index&&)      = default;
+
+  template <class Alloc>
+  constexpr dynamic_vertex_edge_index(const Alloc&) {}
+
+public:
+  // The index, or nullopt when the vertex's degree is below the threshold
+  constexpr std::optional<index_type>&       edge_index() noexcept { return edge_index_; }
+  constexpr const std::optional<index_type>& edge_index() const noexcept { return edge_index_; }
+
+private:
+  std::optional<index_type> edge_index_;
+};
+
+/**
+ * @ingroup graph_containers
+ * @brief Implementation of the target index of a vertex when @c Traits::edge_index_threshold is 0
+ * or isn't defined. No space is used and edges are found by a linear scan.
+*/
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
+class dynamic_vertex_edge_index<EV, VV, GV, VId, Sourced, Traits, false> {
+public:
+  constexpr dynamic_vertex_edge_index() = default;
+
+  template <class Alloc>
+  constexpr dynamic_vertex_edge_index(const Alloc&) {}
+};
+
+/**
+ * @ingroup graph_containers
+ * @brief Implementation of the dense ordinal of a vertex in a @c dynamic_graph with keyed vertices.
+ *
+ * It's a composable class of dynamic_vertex_base that's only present when @c Traits::vertex_ordinals
+ * is true; the specialization for @c false is empty so no space is used otherwise.
+ *
+ * The graph numbers its vertices 0..N-1 in the order of its vertex container whenever vertices are
+ * loaded, so the ordinal can index flat per-vertex arrays without hashing or searching for the
+ * vertex id.
+ *
+ * @tparam EV      The edge value type.
+ * @tparam VV      The vertex value type.
+ * @tparam GV      The graph value type.
+ * @tparam VId     Vertex id type
+ * @tparam Sourced Is a source vertex id stored on the edge?
+ * @tparam Traits  Defines the types for vertex and edge containers, including @c vertex_ordinals.
+*/
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits, bool = has_vertex_ordinals<Traits>>
+class dynamic_vertex_ordinal {
+public:
+  constexpr dynamic_vertex_ordinal() = default;
+
+  template <class Alloc>
+  constexpr dynamic_vertex_ordinal(const Alloc&) {}
+
+public:
+  [[nodiscard]] constexpr size_t ordinal() const noexcept { return ordinal_; }
+  constexpr void                 set_ordinal(size_t ordinal) noexcept { ordinal_ = ordinal; }
+
+private:
+  size_t ordinal_ = 0;
+};
+
+/**
+ * @ingroup graph_containers
+ * @brief Implementation of the dense ordinal of a vertex when @c Traits::vertex_ordinals is false or
+ * isn't defined. No space is used.
+*/
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
+class dynamic_vertex_ordinal<EV, VV, GV, VId, Sourced, Traits, false> {
+public:
+  constexpr dynamic_vertex_ordinal() = default;
+
+  template <class Alloc>
+  constexpr dynamic_vertex_ordinal(const Alloc&) {}
+};
+
 /**
  * @ingroup graph_containers
  * @brief Base implementation of a vertex that provides access to outgoing edges on the vertex.
@@ -643,15 +968,22 @@ public:
  * @tparam Traits  Defines the types for vertex and edge containers.
 */
 template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
-class dynamic_vertex_base {
+class dynamic_vertex_base : public dynamic_vertex_in_edges<EV, VV, GV, VId, Sourced, Traits>,
+                            public dynamic_vertex_tombstones<EV, VV, GV, VId, Sourced, Traits>,
+                            public dynamic_vertex_edge_index<EV, VV, GV, VId, Sourced, Traits>,
+                            public dynamic_vertex_ordinal<EV, VV, GV, VId, Sourced, Traits> {
 public:
-  using vertex_id_type = VId;
-  using value_type     = VV;
-  using graph_type     = dynamic_graph<EV, VV, GV, VId, Sourced, Traits>;
-  using vertex_type    = dynamic_vertex<EV, VV, GV, VId, Sourced, Traits>;
-  using edge_type      = dynamic_edge<EV, VV, GV, VId, Sourced, Traits>;
-  using edges_type     = typename Traits::edges_type;
-  using allocator_type = typename edges_type::allocator_type;
+  using base_in_edges_type   = dynamic_vertex_in_edges<EV, VV, GV, VId, Sourced, Traits>;
+  using base_tombstones_type = dynamic_vertex_tombstones<EV, VV, GV, VId, Sourced, Traits>;
+  using base_edge_index_type = dynamic_vertex_edge_index<EV, VV, GV, VId, Sourced, Traits>;
+  using base_ordinal_type    = dynamic_vertex_ordinal<EV, VV, GV, VId, Sourced, Traits>;
+  using vertex_id_type     = VId;
+  using value_type         = VV;
+  using graph_type         = dynamic_graph<EV, VV, GV, VId, Sourced, Traits>;
+  using vertex_type        = dynamic_vertex<EV, VV, GV, VId, Sourced, Traits>;
+  using edge_type          = dynamic_edge<EV, VV, GV, VId, Sourced, Traits>;
+  using edges_type         = typename Traits::edges_type;
+  using allocator_type     = typename edges_type::allocator_type;
 
 public:
   constexpr dynamic_vertex_base()                           = default;
@@ -662,7 +994,12 @@ public:
   constexpr dynamic_vertex_base& operator=(const dynamic_vertex_base&) = default;
   constexpr dynamic_vertex_base& operator=(dynamic_vertex_base&&)      = default;
 
-  constexpr dynamic_vertex_base(allocator_type alloc) : edges_(alloc) {}
+  constexpr dynamic_vertex_base(allocator_type alloc)
+        : base_in_edges_type(alloc)
+        , base_tombstones_type(alloc)
+        , base_edge_index_type(alloc)
+        , base_ordinal_type(alloc)
+        , edges_(alloc) {}
 
 public:
   constexpr edges_type&       edges() noexcept { return edges_; }
@@ -712,6 +1049,8 @@ private: // CPO properties
    * For random-access vertex containers (vector), the edge iterator type is determined
    * by the graph's const-ness. For bidirectional containers (map), the iterator type
    * is determined by what the vertex descriptor's stored iterator provides.
+   *
+   * When @c Traits::tombstone_edges is true the view skips dead edges.
    */
   template<typename U>
     requires vertex_descriptor_type<U> && 
@@ -726,7 +1065,13 @@ private: // CPO properties
         typename edges_type::const_iterator,
         typename edges_type::iterator>;
     using vertex_iter_t = typename U::iterator_type;
-    return edge_descriptor_view<edge_iter_t, vertex_iter_t>(edges_container, u);
+    if constexpr (has_tombstone_edges<Traits>) {
+      const auto& v = u.inner_value(g);
+      return masked_edge_descriptor_view<edge_iter_t, vertex_iter_t>(
+            edges_container, v.dead_edges(), v.dead_edge_count_ptr(), u);
+    } else {
+      return edge_descriptor_view<edge_iter_t, vertex_iter_t>(edges_container, u);
+    }
   }
 
   /**
@@ -740,7 +1085,28 @@ private: // CPO properties
   [[nodiscard]] friend constexpr auto edges(const graph_type& g, const U& u) noexcept {
     using edge_iter_t = typename edges_type::const_iterator;
     using vertex_iter_t = typename U::iterator_type;
-    return edge_descriptor_view<edge_iter_t, vertex_iter_t>(u.inner_value(g).edges_, u);
+    const auto& v = u.inner_value(g);
+    if constexpr (has_tombstone_edges<Traits>) {
+      return masked_edge_descriptor_view<edge_iter_t, vertex_iter_t>(v.edges_, v.dead_edges(), v.dead_edge_count_ptr(),
+                                                                     u);
+    } else {
+      return edge_descriptor_view<edge_iter_t, vertex_iter_t>(v.edges_, u);
+    }
+  }
+
+  /**
+   * @brief Get the source ids of the incoming edges of a vertex (ADL customization)
+   * @param g The graph
+   * @param u The vertex descriptor (must reference vertex_type in this graph)
+   * @return The vertex's @c in_edges_type container, one source id per incoming edge
+   * @note Complexity: O(1) - direct member access
+   * @note Only available when @c Traits defines @c in_edges_type
+   */
+  template<typename U>
+    requires has_in_edges_type<Traits> && vertex_descriptor_type<U> &&
+             std::same_as<vertex_from_descriptor_t<U>, vertex_type>
+  [[nodiscard]] friend constexpr const auto& in_edges(const graph_type& g, const U& u) noexcept {
+    return u.inner_value(g).in_edges();
   }
 
   // friend constexpr typename edges_type::iterator
@@ -908,6 +1274,9 @@ public: // types
   using edge_allocator_type = typename edges_type::allocator_type;
   using edge_type           = dynamic_edge<EV, VV, GV, VId, Sourced, Traits>;
 
+  static_assert(!has_vertex_ordinals<Traits> || is_associative_container<vertices_type>,
+                "vertex_ordinals requires a map or unordered_map vertex container");
+
 public: // Construction/Destruction/Assignment
   constexpr dynamic_graph_base()                          = default;
   constexpr dynamic_graph_base(const dynamic_graph_base&) = default;
@@ -1109,6 +1478,7 @@ public: // Load operations
         auto&& [id, value] = vproj(v); //copyable_vertex_t<VId, VV>
         vertices_[id].value() = value;
       }
+      renumber_vertices();
     } else {
       // For sequential containers, pre-size and use index-based access
       if constexpr (sized_range<VRng> && resizable<vertices_type>) {
@@ -1161,6 +1531,7 @@ public: // Load operations
         auto&& [id, value] = vproj(v); //copyable_vertex_t<VId, VV>
         vertices_[id].value() = move(value);
       }
+      renumber_vertices();
     } else {
       // For sequential containers, pre-size and use index-based access
       // Harmonize sizing logic with const& overload (ensure we never shrink and honor explicit vertex_count)
@@ -1258,8 +1629,9 @@ public: // Load operations
         
         // operator[] on map will auto-insert default vertex if not present
         // We need to ensure both source and target vertices exist
-        (void)vertices_[e.target_id]; // ensure target vertex exists
-        auto&& edge_adder = push_or_insert(vertices_[e.source_id].edges());
+        add_in_edge(vertices_[e.target_id], e.source_id); // ensures target vertex exists
+        vertex_type& u          = vertices_[e.source_id];
+        auto&&       edge_adder = push_or_insert(u.edges());
         if constexpr (Sourced) {
           if constexpr (is_void_v<EV>) {
             edge_adder(edge_type(e.source_id, e.target_id));
@@ -1274,7 +1646,9 @@ public: // Load operations
           }
         }
         edge_count_ += 1;
+        index_appended_edge(u);
       }
+      renumber_vertices();
     } else {
       // Sequential container path (vector/deque): original logic
       // Optimized strategy: for forward ranges without explicit vertex_count we do a single pass collecting
@@ -1320,13 +1694,28 @@ public: // Load operations
               }
             }
           }
+          // Likewise for the reverse adjacency, using in-degree counts
+          if constexpr (has_in_edges_type<Traits>) {
+            if constexpr (reservable<typename Traits::in_edges_type>) {
+              std::vector<size_type> in_degrees(vertices_.size(), size_type{0});
+              for (auto const& e : projected) {
+                if (static_cast<size_t>(e.target_id) < in_degrees.size())
+                  in_degrees[static_cast<size_t>(e.target_id)]++;
+              }
+              for (size_t vid = 0; vid < in_degrees.size(); ++vid) {
+                if (in_degrees[vid]) vertices_[vid].in_edges().reserve(vertices_[vid].in_edges().size() + in_degrees[vid]);
+              }
+            }
+          }
           // Insert from cached list
           for (auto& e : projected) {
             if (static_cast<size_t>(e.source_id) >= vertices_.size())
               throw std::runtime_error("source id exceeds the number of vertices in load_edges");
             if (static_cast<size_t>(e.target_id) >= vertices_.size())
               throw std::runtime_error("target id exceeds the number of vertices in load_edges");
-            auto&& edge_adder = push_or_insert(vertices_[e.source_id].edges());
+            add_in_edge(vertices_[e.target_id], e.source_id);
+            vertex_type& u          = vertices_[e.source_id];
+            auto&&       edge_adder = push_or_insert(u.edges());
             if constexpr (Sourced) {
               if constexpr (is_void_v<EV>) {
                 edge_adder(edge_type(e.source_id, e.target_id));
@@ -1341,6 +1730,7 @@ public: // Load operations
               }
             }
             edge_count_ += 1;
+            index_appended_edge(u);
           }
           return; // done
         }
@@ -1356,7 +1746,9 @@ public: // Load operations
           throw std::runtime_error("source id exceeds the number of vertices in load_edges");
         if (static_cast<size_t>(e.target_id) >= vertices_.size())
           throw std::runtime_error("target id exceeds the number of vertices in load_edges");
-        auto&& edge_adder = push_or_insert(vertices_[e.source_id].edges());
+        add_in_edge(vertices_[e.target_id], e.source_id);
+        vertex_type& u          = vertices_[e.source_id];
+        auto&&       edge_adder = push_or_insert(u.edges());
         if constexpr (Sourced) {
           if constexpr (is_void_v<EV>) {
             edge_adder(edge_type(std::move(e.source_id), std::move(e.target_id)));
@@ -1371,6 +1763,7 @@ public: // Load operations
           }
         }
         edge_count_ += 1;
+        index_appended_edge(u);
       }
     }
   }
@@ -1379,6 +1772,165 @@ public: // Load operations
   // (Removed deprecated legacy parameter order bridge overload)
 
 private:
+  constexpr vertex_type* find_vertex_ptr(const vertex_id_type& id) noexcept {
+    if constexpr (is_associative_container<vertices_type>) {
+      auto it = vertices_.find(id);
+      return it == vertices_.end() ? nullptr : &it->second;
+    } else {
+      return contains_vertex(id) ? &vertices_[static_cast<size_type>(id)] : nullptr;
+    }
+  }
+  constexpr const vertex_type* find_vertex_ptr(const vertex_id_type& id) const noexcept {
+    return const_cast<dynamic_graph_base*>(this)->find_vertex_ptr(id);
+  }
+
+  // Erase live edge i of u (whose id is uid), keeping edge_count_ and the target's in-edges in sync
+  void erase_edge_at(vertex_type& u, const vertex_id_type& uid, size_t i) {
+    auto&                ec  = u.edges();
+    const vertex_id_type vid = ec[i].target_id();
+    if constexpr (has_tombstone_edges<Traits>) {
+      u.mark_dead_edge(i, ec.size());
+      if constexpr (has_edge_index<Traits>) {
+        if (u.edge_index())
+          reindex_target(u, vid, i);
+      }
+    } else {
+      ec.erase(ec.begin() + static_cast<std::ptrdiff_t>(i));
+      rebuild_edge_index(u); // later positions have shifted
+    }
+    --edge_count_;
+    if constexpr (has_in_edges_type<Traits>) {
+      if (vertex_type* v = find_vertex_ptr(vid)) {
+        auto& ie = v->in_edges();
+        auto  it = std::ranges::find(ie, uid);
+        if (it != ie.end())
+          ie.erase(it);
+      }
+    }
+  }
+
+  // Remove the dead edges of v when they're at least min_dead_ratio of its edges; returns the number removed
+  static size_t purge_dead_edges(vertex_type& v, double min_dead_ratio) {
+    auto&        ec   = v.edges();
+    const size_t dead = v.dead_edge_count();
+    if (dead == 0 || static_cast<double>(dead) < min_dead_ratio * static_cast<double>(ec.size()))
+      return 0;
+    size_t out = 0;
+    for (size_t i = 0; i < ec.size(); ++i) {
+      if (!v.is_dead_edge(i)) {
+        if (out != i)
+          ec[out] = std::move(ec[i]);
+        ++out;
+      }
+    }
+    ec.erase(ec.begin() + static_cast<std::ptrdiff_t>(out), ec.end());
+    v.clear_dead_edges();
+    rebuild_edge_index(v);
+    return dead;
+  }
+
+  // Number of edges of u that haven't been erased
+  static constexpr size_t live_degree(const vertex_type& u) noexcept {
+    if constexpr (has_tombstone_edges<Traits>)
+      return u.edges().size() - u.dead_edge_count();
+    else
+      return static_cast<size_t>(std::ranges::size(u.edges()));
+  }
+
+  // Position of the first live edge of u to vid, or u.edges().size() if there isn't one
+  static size_t find_edge_pos(const vertex_type& u, const vertex_id_type& vid) {
+    auto& ec = u.edges();
+    if constexpr (has_edge_index<Traits>) {
+      if (u.edge_index()) {
+        auto it = u.edge_index()->find(vid);
+        return it == u.edge_index()->end() ? ec.size() : it->second;
+      }
+    }
+    for (size_t i = 0; i < ec.size(); ++i) {
+      if constexpr (has_tombstone_edges<Traits>) {
+        if (u.is_dead_edge(i))
+          continue;
+      }
+      if (ec[i].target_id() == vid)
+        return i;
+    }
+    return ec.size();
+  }
+
+  // Build u's target index when its degree is at least Traits::edge_index_threshold, or drop it when it isn't
+  static void rebuild_edge_index(vertex_type& u) {
+    if constexpr (has_edge_index<Traits>) {
+      const size_t degree = live_degree(u);
+      if (degree < Traits::edge_index_threshold) {
+        u.edge_index().reset();
+        return;
+      }
+      auto& ec    = u.edges();
+      auto& index = u.edge_index().emplace();
+      index.reserve(degree);
+      for (size_t i = 0; i < ec.size(); ++i) {
+        if constexpr (has_tombstone_edges<Traits>) {
+          if (u.is_dead_edge(i))
+            continue;
+        }
+        index.try_emplace(ec[i].target_id(), i);
+      }
+    }
+  }
+
+  // Keep u's target index in sync after an edge has been appended to it
+  static void index_appended_edge(vertex_type& u) {
+    if constexpr (has_edge_index<Traits>) {
+      auto& ec = u.edges();
+      if (u.edge_index())
+        u.edge_index()->try_emplace(ec.back().target_id(), ec.size() - 1);
+      else if (live_degree(u) >= Traits::edge_index_threshold)
+        rebuild_edge_index(u);
+    }
+  }
+
+  // Point the index entry of vid at the next live edge to it after edge i of u was marked dead
+  static void reindex_target(vertex_type& u, const vertex_id_type& vid, size_t i) {
+    if constexpr (has_edge_index<Traits>) {
+      auto& index = *u.edge_index();
+      auto  it    = index.find(vid);
+      if (it == index.end() || it->second != i)
+        return;
+      auto& ec = u.edges();
+      for (size_t j = i + 1; j < ec.size(); ++j) {
+        if (!u.is_dead_edge(j) && ec[j].target_id() == vid) {
+          it->second = j;
+          return;
+        }
+      }
+      index.erase(it);
+    }
+  }
+
+  // Edge descriptor of edge pos of u, as produced by edges(g,u); pos == size is the end position
+  template <class G, class U>
+  static auto edge_descriptor_at(G& g, const U& u, size_t pos) {
+    using edge_desc_type = std::ranges::range_value_t<decltype(graph::edges(g, u))>;
+    return edge_desc_type(pos, u);
+  }
+
+  // Number the vertices 0..N-1 in container order when Traits::vertex_ordinals is true
+  constexpr void renumber_vertices() noexcept {
+    if constexpr (has_vertex_ordinals<Traits>) {
+      size_t n = 0;
+      for (auto& [id, v] : vertices_)
+        v.set_ordinal(n++);
+    }
+  }
+
+  // Record uid as the source of an incoming edge on v when Traits defines in_edges_type
+  constexpr void add_in_edge(vertex_type& v, const vertex_id_type& uid) {
+    if constexpr (has_in_edges_type<Traits>) {
+      using in_edge_value_type = typename Traits::in_edges_type::value_type;
+      push_or_insert(v.in_edges())(in_edge_value_type(uid));
+    }
+  }
+
   constexpr void terminate_partitions() {
     // Partitions are only meaningful for sequential containers with numeric IDs
     // For associative containers (map/unordered_map), partition functionality is not supported
@@ -1443,6 +1995,210 @@ public: // Operations
     edge_count_ = 0;
   }
 
+  /**
+   * @brief Erase the first edge from @c uid to @c vid.
+   *
+   * When @c Traits::tombstone_edges is true the edge is marked dead and stays in the edge container
+   * until compact() reclaims it, so iterators, indices and edge descriptors of the other edges of
+   * @c uid stay valid and no edges are moved. Otherwise the edge is removed from the container.
+   *
+   * When @c Traits defines @c in_edges_type, one occurrence of @c uid is removed from the in-edges
+   * of @c vid.
+   *
+   * @param uid Source vertex id
+   * @param vid Target vertex id
+   * @return true if an edge was erased; false if either vertex doesn't exist or there's no such edge.
+   * @note Complexity: O(degree(uid)), plus O(in_degree(vid)) when in-edges are kept. O(1) average
+   *       to find the edge when uid has a target index, with tombstones.
+   */
+  bool erase_edge(const vertex_id_type& uid, const vertex_id_type& vid)
+    requires std::random_access_iterator<typename edges_type::iterator>
+  {
+    vertex_type* u = find_vertex_ptr(uid);
+    if (u == nullptr || find_vertex_ptr(vid) == nullptr)
+      return false;
+    const size_t i = find_edge_pos(*u, vid);
+    if (i == u->edges().size())
+      return false;
+    erase_edge_at(*u, uid, i);
+    return true;
+  }
+
+  /**
+   * @brief Erase the edge referenced by an edge descriptor from edges(g,u).
+   *
+   * See erase_edge(uid,vid) for the effects. Without tombstones, descriptors of the later edges of
+   * the same vertex are invalidated.
+   *
+   * @param uv Edge descriptor of an edge in this graph
+   * @return true if the edge was erased; false if it was already erased.
+   * @note Complexity: O(1) with tombstones, O(degree) otherwise; plus O(in_degree) when in-edges are kept
+   */
+  template <class E>
+    requires edge_descriptor_type<E> && std::random_access_iterator<typename edges_type::iterator>
+  bool erase_edge(const E& uv) {
+    const auto   uid = static_cast<vertex_id_type>(uv.source().vertex_id());
+    vertex_type* u   = find_vertex_ptr(uid);
+    const size_t i   = static_cast<size_t>(uv.value());
+    if (u == nullptr || i >= u->edges().size())
+      return false;
+    if constexpr (has_tombstone_edges<Traits>) {
+      if (u->is_dead_edge(i))
+        return false;
+    }
+    erase_edge_at(*u, uid, i);
+    return true;
+  }
+
+  /**
+   * @brief Number of erased edges that are still held in the edge containers.
+   *
+   * It's always 0 unless @c Traits::tombstone_edges is true.
+   *
+   * @note Complexity: O(V)
+   */
+  [[nodiscard]] size_type dead_edge_count() const noexcept {
+    size_type n = 0;
+    if constexpr (has_tombstone_edges<Traits>) {
+      for (auto& u : vertices_) {
+        if constexpr (is_associative_container<vertices_type>)
+          n += u.second.dead_edge_count();
+        else
+          n += u.dead_edge_count();
+      }
+    }
+    return n;
+  }
+
+  /**
+   * @brief Is there an edge from uid to vid?
+   *
+   * Only defined when @c Traits::edge_index_threshold is non-zero, which makes the contains_edge(g,uid,vid)
+   * CPO use it instead of scanning edges(g,u). Vertices with at least that many edges are looked
+   * up in their target index; the others are scanned.
+   *
+   * @return false if there's no such edge or uid isn't a vertex of the graph.
+   * @note Complexity: O(1) average for indexed vertices, O(degree(uid)) otherwise
+   */
+  [[nodiscard]] bool contains_edge(const vertex_id_type& uid, const vertex_id_type& vid) const
+    requires has_edge_index<Traits>
+  {
+    const vertex_type* u = find_vertex_ptr(uid);
+    return u != nullptr && find_edge_pos(*u, vid) < u->edges().size();
+  }
+
+  /**
+   * @brief Is there an edge from vertex descriptor u to vertex descriptor v? See contains_edge(uid,vid).
+   */
+  template <class U, class V>
+    requires has_edge_index<Traits> && vertex_descriptor_type<U> && vertex_descriptor_type<V>
+  [[nodiscard]] bool contains_edge(const U& u, const V& v) const {
+    const vertex_type& uu = u.inner_value(vertices_);
+    return find_edge_pos(uu, static_cast<vertex_id_type>(v.vertex_id())) < uu.edges().size();
+  }
+
+  /**
+   * @brief Find the first edge from u to vid, using u's target index when it has one.
+   *
+   * Only defined when @c Traits::edge_index_threshold is non-zero, which makes the find_vertex_edge
+   * CPO use it. Like the CPO's default, the edge descriptor returned has the end position of
+   * edges(g,u) when there's no such edge.
+   *
+   * @note Complexity: O(1) average for indexed vertices, O(degree(u)) otherwise
+   */
+  template <class U>
+    requires has_edge_index<Traits> && vertex_descriptor_type<U>
+  [[nodiscard]] auto find_vertex_edge(const U& u, const vertex_id_type& vid) {
+    return edge_descriptor_at(static_cast<graph_type&>(*this), u, find_edge_pos(u.inner_value(vertices_), vid));
+  }
+  template <class U>
+    requires has_edge_index<Traits> && vertex_descriptor_type<U>
+  [[nodiscard]] auto find_vertex_edge(const U& u, const vertex_id_type& vid) const {
+    return edge_descriptor_at(static_cast<const graph_type&>(*this), u,
+                              find_edge_pos(u.inner_value(vertices_), vid));
+  }
+
+  template <class U, class V>
+    requires has_edge_index<Traits> && vertex_descriptor_type<U> && vertex_descriptor_type<V>
+  [[nodiscard]] auto find_vertex_edge(const U& u, const V& v) {
+    return find_vertex_edge(u, static_cast<vertex_id_type>(v.vertex_id()));
+  }
+  template <class U, class V>
+    requires has_edge_index<Traits> && vertex_descriptor_type<U> && vertex_descriptor_type<V>
+  [[nodiscard]] auto find_vertex_edge(const U& u, const V& v) const {
+    return find_vertex_edge(u, static_cast<vertex_id_type>(v.vertex_id()));
+  }
+
+  /**
+   * @brief Find the first edge from uid to vid. See find_vertex_edge(u,vid); uid must be a vertex of the graph.
+   */
+  [[nodiscard]] auto find_vertex_edge(const vertex_id_type& uid, const vertex_id_type& vid)
+    requires has_edge_index<Traits>
+  {
+    return find_vertex_edge(*find_vertex(*this, uid), vid);
+  }
+  [[nodiscard]] auto find_vertex_edge(const vertex_id_type& uid, const vertex_id_type& vid) const
+    requires has_edge_index<Traits>
+  {
+    return find_vertex_edge(*find_vertex(*this, uid), vid);
+  }
+
+  /**
+   * @brief Reclaim dead edges and slack in the edge containers.
+   *
+   * When @c Traits::tombstone_edges is true, the dead edges of each vertex are removed from its edge
+   * container once they make up at least @c min_dead_ratio of it, keeping the order of the live
+   * edges. Vertices are processed in parallel when the vertex container is sequential. A ratio of
+   * 0 removes all dead edges.
+   *
+   * Edge containers that provide compact() (e.g. edge_block_list) are then compacted in vertex
+   * order, which lays out the adjacency of consecutive vertices next to each other. Memory that's
+   * no longer used is then given back by the container's trim(), when it has one.
+   *
+   * Iterators, references and edge descriptors are invalidated when anything is compacted. It
+   * must not run concurrently with readers of the graph.
+   *
+   * Compaction is never started implicitly, by erase_edge() or in the background: that would
+   * invalidate the iterators that tombstones keep valid. Call it at a point where no readers are
+   * active, e.g. once dead_edge_count() is a large enough fraction of num_edges(g).
+   *
+   * @param min_dead_ratio Minimum fraction of dead edges in a vertex's edge container before
+   *                       they're removed, in [0,1].
+   * @return The number of dead edges removed
+   * @note Complexity: O(V + E)
+   */
+  size_type compact(double min_dead_ratio = 0.0) {
+    size_type reclaimed = 0;
+    if constexpr (has_tombstone_edges<Traits>) {
+      if constexpr (is_associative_container<vertices_type>) {
+        for (auto& u : vertices_)
+          reclaimed += purge_dead_edges(u.second, min_dead_ratio);
+      } else {
+        std::vector<size_type> per_worker(graph::detail::hardware_threads(), 0);
+        graph::detail::parallel_for_chunks(
+              size_type{0}, vertices_.size(),
+              [&](size_type lo, size_type hi, size_t worker) {
+                for (size_type i = lo; i < hi; ++i)
+                  per_worker[worker] += purge_dead_edges(vertices_[i], min_dead_ratio);
+              },
+              256);
+        for (size_type n : per_worker)
+          reclaimed += n;
+      }
+    }
+    if constexpr (requires(edges_type& ec) { ec.compact(); }) {
+      for (auto& u : vertices_) {
+        if constexpr (is_associative_container<vertices_type>)
+          u.second.edges().compact();
+        else
+          u.edges().compact();
+      }
+      if constexpr (requires { edges_type::trim(); })
+        edges_type::trim();
+    }
+    return reclaimed;
+  }
+
   /**
    * @brief Check if a vertex with the given id exists in the graph.
    * 
@@ -1559,6 +2315,79 @@ private: // CPO properties
   friend constexpr auto num_edges(const dynamic_graph_base& g) { return g.edge_count_; }
   friend constexpr bool has_edge(const dynamic_graph_base& g) { return g.edge_count_ > 0; }
 
+  /**
+   * @brief Heap memory held by the graph, split by use (see graph_memory_usage).
+   *
+   * Edge containers are sized by their size(). For containers without one (forward_list) the
+   * number of edges is taken from num_edges(g), so edges aren't traversed.
+   *
+   * @note Complexity: O(V). Nothing is allocated.
+   */
+  [[nodiscard]] friend graph_memory_usage memory_usage(const dynamic_graph_base& g) noexcept {
+    using detail::container_memory;
+    graph_memory_usage mu;
+
+    const size_t nv = g.vertices_.size();
+    const auto   vb = container_memory(g.vertices_, nv);
+    if constexpr (!std::is_void_v<VV>)
+      mu.vertex_values = nv * sizeof(VV);
+    mu.vertices = vb.held - vb.slack - mu.vertex_values;
+    mu.slack    = vb.slack;
+
+    size_t edge_elements = 0;
+    size_t edge_held     = 0;
+    auto   add_vertex    = [&](const vertex_type& u) {
+      if constexpr (requires { u.edges().size(); }) {
+        const auto eb = container_memory(u.edges(), u.edges().size());
+        edge_elements += u.edges().size();
+        edge_held += eb.held - eb.slack;
+        mu.slack += eb.slack;
+      }
+      if constexpr (has_in_edges_type<Traits>) {
+        if constexpr (requires { u.in_edges().size(); }) {
+          const auto ib = container_memory(u.in_edges(), u.in_edges().size());
+          mu.edges += ib.held - ib.slack;
+          mu.slack += ib.slack;
+        }
+      }
+      if constexpr (has_tombstone_edges<Traits>)
+        mu.edges += u.dead_edges_bytes();
+      if constexpr (has_edge_index<Traits>) {
+        if (u.edge_index())
+          mu.edges += container_memory(*u.edge_index(), u.edge_index()->size()).held;
+      }
+    };
+    for (auto& u : g.vertices_) {
+      if constexpr (is_associative_container<vertices_type>)
+        add_vertex(u.second);
+      else
+        add_vertex(u);
+    }
+    if constexpr (!requires(const edges_type& ec) { ec.size(); }) {
+      edge_elements = g.edge_count_;
+      edge_held     = g.edge_count_ * detail::container_node_bytes<edges_type>();
+    }
+    if constexpr (has_in_edges_type<Traits>) {
+      using in_edges_type = typename Traits::in_edges_type;
+      if constexpr (!requires(const in_edges_type& ie) { ie.size(); })
+        mu.edges += g.edge_count_ * detail::container_node_bytes<in_edges_type>();
+    }
+    if constexpr (!std::is_void_v<EV>)
+      mu.edge_values = edge_elements * sizeof(EV);
+    mu.edges += edge_held - mu.edge_values;
+
+    const auto pb = container_memory(g.partition_, g.partition_.size());
+    mu.partitions = pb.held - pb.slack;
+    mu.slack += pb.slack;
+    return mu;
+  }
+
+  /**
+   * @brief Reclaim dead edges and slack in the edge containers of @c g (see compact()).
+   * @return The number of dead edges removed
+   */
+  friend size_type compact(dynamic_graph_base& g, double min_dead_ratio = 0.0) { return g.compact(min_dead_ratio); }
+
   /**
    * @brief Find a vertex by id, returning a vertex descriptor view iterator for use with CPOs.
    *
@@ -2111,6 +2940,24 @@ private: // Member variables
 //    a first pass to accumulate per-vertex out-degrees and perform reserve() on
 //    each vertex adjacency container to reduce reallocations.
 //    This optimization does not occur for other container types (e.g. list, set).
+//  - In-edges (Traits::in_edges_type): the source id of every loaded edge is
+//    also appended to its target's in-edge container, so in_edges(g,u) lists
+//    incoming edges in the order they were loaded. Duplicate edges produce
+//    duplicate in-edge entries. Forward ranges reserve in-degree capacity the
+//    same way out-edges are reserved.
+//  - Tombstones (Traits::tombstone_edges): erase_edge() only marks the edge dead,
+//    so num_edges(g) and degree(g,u) drop immediately while the edge container
+//    keeps its size until compact(g) removes the dead edges. Edges loaded after an
+//    erase are appended after the dead ones and are live.
+//  - Vertex ordinals (Traits::vertex_ordinals): every load_vertices() and
+//    load_edges() renumbers all vertices in container order, which is O(V) per
+//    call, so load keyed graphs in a few large batches. Copies keep the ordinals
+//    of the original even if an unordered_map copy iterates in a different order.
+//  - Edge index (Traits::edge_index_threshold): a vertex's target index is built
+//    when its degree reaches the threshold while loading edges, and kept in sync by
+//    erase_edge() and compact(). It maps a target to its first live edge, so for
+//    multi-edges find_vertex_edge() returns the same edge the linear scan would.
+//    Edges added to a vertex's edge container directly aren't indexed.
 
 } // namespace graph::container
 
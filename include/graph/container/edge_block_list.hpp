@@ -0,0 +1,458 @@
+/**
+ * @file edge_block_list.hpp
+ * @brief Per-vertex edge container built from fixed-size blocks drawn from a shared pool
+ *
+ * An edge_block_list stores its elements in a singly-linked chain of cache-line sized blocks.
+ * Blocks come from an edge_block_pool that is shared by every list with the same element type
+ * and block size, so a graph's adjacency lives in a few large slabs rather than one heap
+ * allocation per vertex (vector) or per edge (list):
+ *
+ * - Appending never moves existing elements (unlike vector) and allocates once per block
+ *   rather than once per element (unlike list/forward_list).
+ * - Scanning touches one cache line per block, with the elements of a block contiguous.
+ * - compact() re-lays a chain into adjacent blocks; compacting the vertices in id order makes
+ *   the whole adjacency close to sequential in memory. trim() returns unused slabs.
+ *
+ * It's used as the @c edges_type of vob_graph_traits.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace graph::container {
+
+/**
+ * @ingroup graph_containers
+ * @brief Pool of fixed-size blocks shared by all edge_block_list<T,BlockBytes> objects.
+ *
+ * Blocks are carved from slabs of many blocks. Freed blocks go on a free list and are reused
+ * before a slab's unused tail; trim() gives slabs with no blocks in use back to the system.
+ * Allocation and deallocation are guarded by a mutex so graphs in different threads can share
+ * the pool; a single graph is still not safe to modify from more than one thread.
+ *
+ * @tparam T          Element type
+ * @tparam BlockBytes Target block size in bytes, including the block header. Must be a power of 2.
+ *                    It's exceeded when a single element doesn't fit in it.
+ */
+template <class T, size_t BlockBytes = 64>
+class edge_block_pool {
+  static_assert(std::has_single_bit(BlockBytes), "BlockBytes must be a power of 2");
+
+public:
+  struct block_header {
+    block_header* next  = nullptr;
+    uint32_t      count = 0;
+  };
+
+  static constexpr size_t header_bytes = sizeof(block_header);
+  static constexpr size_t capacity     = (BlockBytes > header_bytes + sizeof(T))
+                                               ? (BlockBytes - header_bytes) / sizeof(T)
+                                               : size_t{1}; // elements per block
+
+  /**
+   * @brief A block of up to @c capacity elements. Elements [0,count) are constructed.
+   */
+  struct alignas(std::max(BlockBytes, alignof(T))) block : block_header {
+    alignas(T) std::byte storage[capacity * sizeof(T)];
+
+    T*       data() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+    const T* data() const noexcept { return std::launder(reinterpret_cast<const T*>(storage)); }
+    void*    slot(size_t i) noexcept { return storage + i * sizeof(T); }
+    block*   next_block() const noexcept { return static_cast<block*>(this->next); }
+  };
+
+  static constexpr size_t slab_blocks = 256; // default blocks per slab
+
+public:
+  edge_block_pool() = default;
+  edge_block_pool(const edge_block_pool&) = delete;
+  edge_block_pool& operator=(const edge_block_pool&) = delete;
+
+  ~edge_block_pool() {
+    for (auto& s : slabs_)
+      ::operator delete(s.first, std::align_val_t{alignof(block)});
+  }
+
+  /**
+   * @brief The process-wide pool for this element type and block size.
+   * @note It's never destroyed, so lists with static storage duration can outlive any use of it.
+   */
+  static edge_block_pool& instance() {
+    static edge_block_pool* pool = new edge_block_pool();
+    return *pool;
+  }
+
+  /**
+   * @brief Allocate an empty block.
+   * @note Complexity: O(1) amortized
+   */
+  [[nodiscard]] block* allocate() {
+    std::lock_guard lock(mutex_);
+    block*          b = free_;
+    if (b) {
+      free_ = b->next_block();
+      --free_count_;
+    } else {
+      if (bump_ == bump_end_)
+        add_slab(slab_blocks);
+      b = bump_++;
+    }
+    ::new (static_cast<void*>(b)) block();
+    ++in_use_;
+    return b;
+  }
+
+  /**
+   * @brief Allocate a chain of @c n empty blocks that are adjacent in memory.
+   *
+   * The blocks are taken from the unused tail of the current slab, or from a new slab when the
+   * tail is too short. The free list isn't used so the run is always contiguous.
+   *
+   * @param n Number of blocks (> 0)
+   * @return The first block of the chain; each block's @c next links to the following one.
+   * @note Complexity: O(n)
+   */
+  [[nodiscard]] block* allocate_run(size_t n) {
+    std::lock_guard lock(mutex_);
+    if (static_cast<size_t>(bump_end_ - bump_) < n)
+      add_slab(std::max(n, slab_blocks));
+    block* first = bump_;
+    bump_ += n;
+    for (size_t i = 0; i < n; ++i) {
+      ::new (static_cast<void*>(first + i)) block();
+      first[i].next = (i + 1 < n) ? first + i + 1 : nullptr;
+    }
+    in_use_ += n;
+    return first;
+  }
+
+  /**
+   * @brief Return a chain of blocks to the pool. Elements must already be destroyed.
+   * @param first First block of a chain terminated by a null @c next
+   * @note Complexity: O(blocks in the chain)
+   */
+  void deallocate_chain(block* first) noexcept {
+    if (!first)
+      return;
+    std::lock_guard lock(mutex_);
+    while (first) {
+      block* nxt  = first->next_block();
+      first->next = free_;
+      free_       = first;
+      ++free_count_;
+      --in_use_;
+      first = nxt;
+    }
+  }
+
+  /**
+   * @brief Release slabs that have no blocks in use back to the system.
+   * @return Number of bytes released
+   * @note Complexity: O(F log S) for F free blocks and S slabs
+   */
+  size_t trim() {
+    std::lock_guard lock(mutex_);
+    if (slabs_.empty())
+      return 0;
+
+    // Count the free blocks that lie in each slab (the free list and the unused bump tail)
+    std::sort(slabs_.begin(), slabs_.end());
+    std::vector<size_t> free_in_slab(slabs_.size(), 0);
+    auto                slab_of = [this](const block* b) {
+      auto it = std::upper_bound(slabs_.begin(), slabs_.end(), b,
+                                 [](const block* p, const auto& s) { return p < s.first; });
+      return static_cast<size_t>(std::distance(slabs_.begin(), it) - 1);
+    };
+    for (block* b = free_; b; b = b->next_block())
+      ++free_in_slab[slab_of(b)];
+    if (bump_ != bump_end_)
+      free_in_slab[slab_of(bump_)] += static_cast<size_t>(bump_end_ - bump_);
+
+    std::vector<bool> release(slabs_.size(), false);
+    for (size_t i = 0; i < slabs_.size(); ++i)
+      release[i] = (free_in_slab[i] == slabs_[i].second);
+    if (std::ranges::none_of(release, [](bool r) { return r; }))
+      return 0;
+
+    // Rebuild the free list without the blocks of released slabs
+    block* kept = nullptr;
+    free_count_ = 0;
+    for (block* b = free_; b;) {
+      block* nxt = b->next_block();
+      if (!release[slab_of(b)]) {
+        b->next = kept;
+        kept    = b;
+        ++free_count_;
+      }
+      b = nxt;
+    }
+    free_ = kept;
+    if (bump_ != bump_end_ && release[slab_of(bump_)])
+      bump_ = bump_end_ = nullptr;
+
+    size_t released = 0;
+    size_t out      = 0;
+    for (size_t i = 0; i < slabs_.size(); ++i) {
+      if (release[i]) {
+        released += slabs_[i].second * sizeof(block);
+        ::operator delete(slabs_[i].first, std::align_val_t{alignof(block)});
+      } else {
+        slabs_[out++] = slabs_[i];
+      }
+    }
+    slabs_.resize(out);
+    return released;
+  }
+
+  /// @brief Number of blocks handed out and not yet returned
+  [[nodiscard]] size_t blocks_in_use() const {
+    std::lock_guard lock(mutex_);
+    return in_use_;
+  }
+
+  /// @brief Bytes held in slabs, whether in use or not
+  [[nodiscard]] size_t reserved_bytes() const {
+    std::lock_guard lock(mutex_);
+    size_t          n = 0;
+    for (auto& s : slabs_)
+      n += s.second;
+    return n * sizeof(block);
+  }
+
+private:
+  void add_slab(size_t n) {
+    void* p = ::operator new(n * sizeof(block), std::align_val_t{alignof(block)});
+    slabs_.emplace_back(static_cast<block*>(p), n);
+    bump_     = static_cast<block*>(p);
+    bump_end_ = bump_ + n;
+  }
+
+private:
+  mutable std::mutex                   mutex_;
+  std::vector<std::pair<block*, size_t>> slabs_;          // {first block, block count}
+  block*                               free_       = nullptr;
+  size_t                               free_count_ = 0;
+  block*                               bump_       = nullptr; // unused tail of the newest slab
+  block*                               bump_end_   = nullptr;
+  size_t                               in_use_     = 0;
+};
+
+
+/**
+ * @ingroup graph_containers
+ * @brief Sequence container of blocks drawn from edge_block_pool<T,BlockBytes>::instance().
+ *
+ * Supports the subset of the sequence container interface used for a dynamic_graph edge
+ * container: forward iteration, size(), empty(), push_back(), emplace_back() and clear().
+ * Iterators are invalidated only by clear(), compact() and destruction; appending doesn't
+ * invalidate iterators or references to existing elements.
+ *
+ * @tparam T          Element type
+ * @tparam BlockBytes Target block size in bytes (see edge_block_pool)
+ * @tparam Alloc      Accepted for interface compatibility with the vertex container's allocator.
+ *                    Blocks always come from the shared pool.
+ */
+template <class T, size_t BlockBytes = 64, class Alloc = std::allocator<T>>
+class edge_block_list {
+public:
+  using pool_type       = edge_block_pool<T, BlockBytes>;
+  using block_type      = typename pool_type::block;
+  using value_type      = T;
+  using allocator_type  = Alloc;
+  using size_type       = size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference       = T&;
+  using const_reference = const T&;
+  using pointer         = T*;
+  using const_pointer   = const T*;
+
+  static constexpr size_t block_capacity = pool_type::capacity;
+
+  template <bool Const>
+  class basic_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<Const, const T*, T*>;
+    using reference         = std::conditional_t<Const, const T&, T&>;
+    using block_pointer     = std::conditional_t<Const, const block_type*, block_type*>;
+
+    constexpr basic_iterator() noexcept = default;
+    constexpr basic_iterator(block_pointer b, uint32_t idx) noexcept : block_(b), idx_(idx) {}
+
+    // iterator -> const_iterator
+    template <bool C = Const>
+      requires C
+    constexpr basic_iterator(const basic_iterator<false>& rhs) noexcept : block_(rhs.block_), idx_(rhs.idx_) {}
+
+    [[nodiscard]] reference operator*() const noexcept { return block_->data()[idx_]; }
+    [[nodiscard]] pointer   operator->() const noexcept { return block_->data() + idx_; }
+
+    basic_iterator& operator++() noexcept {
+      if (++idx_ == block_->count) {
+        block_ = block_->next_block();
+        idx_   = 0;
+      }
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept {
+      basic_iterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const basic_iterator& rhs) const noexcept {
+      return block_ == rhs.block_ && idx_ == rhs.idx_;
+    }
+
+  private:
+    block_pointer block_ = nullptr;
+    uint32_t      idx_   = 0;
+
+    friend class basic_iterator<!Const>;
+  };
+
+  using iterator       = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+public:
+  edge_block_list() noexcept = default;
+  explicit edge_block_list(const allocator_type& alloc) noexcept : alloc_(alloc) {}
+
+  edge_block_list(const edge_block_list& rhs) : alloc_(rhs.alloc_) {
+    for (const auto& val : rhs)
+      push_back(val);
+  }
+  edge_block_list(edge_block_list&& rhs) noexcept
+        : alloc_(rhs.alloc_), head_(rhs.head_), tail_(rhs.tail_), size_(rhs.size_) {
+    rhs.head_ = rhs.tail_ = nullptr;
+    rhs.size_             = 0;
+  }
+  ~edge_block_list() { clear(); }
+
+  edge_block_list& operator=(const edge_block_list& rhs) {
+    if (this != &rhs) {
+      edge_block_list tmp(rhs);
+      swap(tmp);
+    }
+    return *this;
+  }
+  edge_block_list& operator=(edge_block_list&& rhs) noexcept {
+    if (this != &rhs) {
+      clear();
+      swap(rhs);
+    }
+    return *this;
+  }
+
+  void swap(edge_block_list& rhs) noexcept {
+    std::swap(alloc_, rhs.alloc_);
+    std::swap(head_, rhs.head_);
+    std::swap(tail_, rhs.tail_);
+    std::swap(size_, rhs.size_);
+  }
+
+  [[nodiscard]] allocator_type get_allocator() const noexcept { return alloc_; }
+
+public: // Iteration
+  [[nodiscard]] iterator       begin() noexcept { return iterator(head_, 0); }
+  [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(head_, 0); }
+  [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+
+  [[nodiscard]] iterator       end() noexcept { return iterator(); }
+  [[nodiscard]] const_iterator end() const noexcept { return const_iterator(); }
+  [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+
+public: // Properties
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+  [[nodiscard]] bool      empty() const noexcept { return size_ == 0; }
+
+  /// @brief Number of blocks in the chain
+  [[nodiscard]] size_type block_count() const noexcept { return (size_ + block_capacity - 1) / block_capacity; }
+
+  /// @brief Number of elements the blocks in the chain can hold
+  [[nodiscard]] size_type capacity() const noexcept { return block_count() * block_capacity; }
+
+  /// @brief Bytes of the blocks in the chain (elements, headers and unused slots)
+  [[nodiscard]] size_type allocated_bytes() const noexcept { return block_count() * sizeof(block_type); }
+
+public: // Operations
+  template <class... Args>
+  reference emplace_back(Args&&... args) {
+    if (!tail_ || tail_->count == block_capacity) {
+      block_type* b = pool_type::instance().allocate();
+      if (tail_)
+        tail_->next = b;
+      else
+        head_ = b;
+      tail_ = b;
+    }
+    T* p = ::new (tail_->slot(tail_->count)) T(std::forward<Args>(args)...);
+    ++tail_->count;
+    ++size_;
+    return *p;
+  }
+
+  void push_back(const T& val) { emplace_back(val); }
+  void push_back(T&& val) { emplace_back(std::move(val)); }
+
+  void clear() noexcept {
+    for (block_type* b = head_; b; b = b->next_block())
+      std::destroy_n(b->data(), b->count);
+    pool_type::instance().deallocate_chain(head_);
+    head_ = tail_ = nullptr;
+    size_         = 0;
+  }
+
+  /**
+   * @brief Move the elements into a run of blocks that are adjacent in memory, each full except
+   * the last.
+   *
+   * Iterators and references are invalidated. The old blocks go back to the pool's free list;
+   * call trim() once a set of lists has been compacted to give fully unused slabs back.
+   *
+   * @note Complexity: O(size())
+   */
+  void compact() {
+    if (size_ == 0)
+      return;
+    block_type* run = pool_type::instance().allocate_run(block_count());
+    block_type* dst = run;
+    for (block_type* b = head_; b; b = b->next_block()) {
+      for (uint32_t i = 0; i < b->count; ++i) {
+        if (dst->count == block_capacity)
+          dst = dst->next_block();
+        ::new (dst->slot(dst->count)) T(std::move(b->data()[i]));
+        ++dst->count;
+      }
+      std::destroy_n(b->data(), b->count);
+    }
+    pool_type::instance().deallocate_chain(head_);
+    head_ = run;
+    tail_ = dst;
+  }
+
+  /**
+   * @brief Give slabs without blocks in use back to the system.
+   * @return Number of bytes released
+   */
+  static size_t trim() { return pool_type::instance().trim(); }
+
+private:
+  [[no_unique_address]] allocator_type alloc_;
+  block_type*                          head_ = nullptr;
+  block_type*                          tail_ = nullptr;
+  size_type                            size_ = 0;
+};
+
+} // namespace graph::container
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <map>
+#include <set>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// NOTES
+//  memory_usage(g) reports the heap memory held by a graph container, split by what it's used for.
+//  It's meant to be cheap enough to export as a metric: it's O(V), doesn't allocate and doesn't
+//  touch edges (beyond reading the size of each vertex's edge container).
+//
+//  Node-based containers (list, set, map, unordered_*) don't expose their allocations, so their
+//  nodes are estimated from the link pointers of the common standard library layouts, rounded up
+//  to the allocation granularity of operator new. Memory owned by the values themselves (e.g. the
+//  characters of a std::string vertex value) isn't included.
+
+namespace graph::container {
+
+/**
+ * @ingroup graph_containers
+ * @brief Heap memory held by a graph, in bytes.
+ *
+ * Each byte is counted in exactly one member, so total() is their sum. Reserved but unused capacity
+ * of vectors, deques and edge blocks is only counted in @c slack.
+ */
+struct graph_memory_usage {
+  size_t vertices      = 0; // vertex container, excluding vertex values
+  size_t edges         = 0; // edge containers incl. per-node overhead & in-edges, excluding edge values
+  size_t vertex_values = 0; // user vertex values (VV)
+  size_t edge_values   = 0; // user edge values (EV)
+  size_t partitions    = 0; // partition start ids
+  size_t slack         = 0; // reserved but unused capacity
+
+  [[nodiscard]] constexpr size_t total() const noexcept {
+    return vertices + edges + vertex_values + edge_values + partitions + slack;
+  }
+
+  constexpr graph_memory_usage& operator+=(const graph_memory_usage& rhs) noexcept {
+    vertices += rhs.vertices;
+    edges += rhs.edges;
+    vertex_values += rhs.vertex_values;
+    edge_values += rhs.edge_values;
+    partitions += rhs.partitions;
+    slack += rhs.slack;
+    return *this;
+  }
+
+  constexpr bool operator==(const graph_memory_usage&) const noexcept = default;
+};
+
+namespace detail {
+
+  // Bytes actually taken by an operator new allocation of n bytes
+  [[nodiscard]] constexpr size_t heap_block_bytes(size_t n) noexcept {
+    constexpr size_t granularity = alignof(std::max_align_t);
+    return (n + granularity - 1) / granularity * granularity;
+  }
+
+  // Number of link pointers in the node of a node-based standard container, 0 if it isn't one.
+  // Tree nodes hold 3 pointers and a color, which pads to 4 pointers.
+  template <class C>
+  struct container_node_links : std::integral_constant<size_t, 0> {};
+  template <class T, class A>
+  struct container_node_links<std::forward_list<T, A>> : std::integral_constant<size_t, 1> {};
+  template <class T, class A>
+  struct container_node_links<std::list<T, A>> : std::integral_constant<size_t, 2> {};
+  template <class K, class C, class A>
+  struct container_node_links<std::set<K, C, A>> : std::integral_constant<size_t, 4> {};
+  template <class K, class C, class A>
+  struct container_node_links<std::multiset<K, C, A>> : std::integral_constant<size_t, 4> {};
+  template <class K, class T, class C, class A>
+  struct container_node_links<std::map<K, T, C, A>> : std::integral_constant<size_t, 4> {};
+  template <class K, class T, class C, class A>
+  struct container_node_links<std::multimap<K, T, C, A>> : std::integral_constant<size_t, 4> {};
+  template <class K, class H, class E, class A>
+  struct container_node_links<std::unordered_set<K, H, E, A>> : std::integral_constant<size_t, 1> {};
+  template <class K, class H, class E, class A>
+  struct container_node_links<std::unordered_multiset<K, H, E, A>> : std::integral_constant<size_t, 1> {};
+  template <class K, class T, class H, class E, class A>
+  struct container_node_links<std::unordered_map<K, T, H, E, A>> : std::integral_constant<size_t, 1> {};
+  template <class K, class T, class H, class E, class A>
+  struct container_node_links<std::unordered_multimap<K, T, H, E, A>> : std::integral_constant<size_t, 1> {};
+
+  template <class C>
+  inline constexpr bool is_node_container_v = container_node_links<C>::value > 0;
+
+  template <class C>
+  struct is_std_deque : std::false_type {};
+  template <class T, class A>
+  struct is_std_deque<std::deque<T, A>> : std::true_type {};
+
+  // Bytes of one node of a node-based container
+  template <class C>
+  [[nodiscard]] constexpr size_t container_node_bytes() noexcept {
+    return heap_block_bytes(container_node_links<C>::value * sizeof(void*) + sizeof(typename C::value_type));
+  }
+
+  // Heap memory of a container with n elements: bytes held, and the part of it that's unused capacity
+  struct container_bytes {
+    size_t held  = 0;
+    size_t slack = 0;
+  };
+
+  /**
+   * @brief Heap memory held by a container of @c n elements.
+   *
+   * @c n is passed separately so it can be supplied for containers without an O(1) size()
+   * (forward_list). Containers with @c allocated_bytes() and @c capacity() (e.g. edge_block_list)
+   * report their own allocations.
+   */
+  template <class C>
+  [[nodiscard]] constexpr container_bytes container_memory(const C& c, size_t n) noexcept {
+    using value_type            = typename C::value_type;
+    constexpr size_t value_size = sizeof(value_type);
+    if constexpr (is_node_container_v<C>) {
+      container_bytes b{n * container_node_bytes<C>(), 0};
+      if constexpr (requires { c.bucket_count(); })
+        b.held += heap_block_bytes(c.bucket_count() * sizeof(void*));
+      return b;
+    } else if constexpr (is_std_deque<C>::value) {
+      // Fixed-size blocks of 512 bytes (or one element) plus a map of block pointers (libstdc++ layout)
+      constexpr size_t per_block = value_size < 512 ? 512 / value_size : 1;
+      const size_t     blocks    = n / per_block + 1;
+      const size_t     map_size  = blocks + 2 > 8 ? blocks + 2 : 8;
+      const size_t     held      = blocks * heap_block_bytes(per_block * value_size) + map_size * sizeof(void*);
+      return {held, blocks * per_block * value_size - n * value_size};
+    } else if constexpr (requires { c.allocated_bytes(); c.capacity(); }) {
+      return {static_cast<size_t>(c.allocated_bytes()), (static_cast<size_t>(c.capacity()) - n) * value_size};
+    } else if constexpr (requires { c.capacity(); }) {
+      const size_t cap = static_cast<size_t>(c.capacity());
+      return {cap ? heap_block_bytes(cap * value_size) : 0, (cap - n) * value_size};
+    } else {
+      return {n * value_size, 0};
+    }
+  }
+
+} // namespace detail
+
+} // namespace graph::container
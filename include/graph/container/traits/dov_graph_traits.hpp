@@ -19,13 +19,20 @@ class dynamic_graph;
 //  Vertices: std::deque (stable iterators)
 //  Edges:    std::vector (random access)
 //  Parameter semantics mirror vofl_graph_traits.
-template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false>
+//  Tombstones: when true, erase_edge() marks edges dead instead of removing them; edges(g,u) skips
+//              dead edges and compact(g) reclaims them.
+//  EdgeIndexThreshold: when non-zero, a vertex with at least this many edges keeps a hash index of its
+//              target ids so contains_edge and find_vertex_edge are O(1) on it.
+template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false, bool Tombstones = false,
+          size_t EdgeIndexThreshold = 0>
 struct dov_graph_traits {
-  using edge_value_type                      = EV;
-  using vertex_value_type                    = VV;
-  using graph_value_type                     = GV;
-  using vertex_id_type                       = VId;
-  static constexpr bool sourced              = Sourced;
+  using edge_value_type                        = EV;
+  using vertex_value_type                      = VV;
+  using graph_value_type                       = GV;
+  using vertex_id_type                         = VId;
+  static constexpr bool   sourced              = Sourced;
+  static constexpr bool   tombstone_edges      = Tombstones;
+  static constexpr size_t edge_index_threshold = EdgeIndexThreshold;
 
   using edge_type   = dynamic_edge<EV, VV, GV, VId, Sourced, dov_graph_traits>;
   using vertex_type = dynamic_vertex<EV, VV, GV, VId, Sourced, dov_graph_traits>;
@@ -26,13 +26,17 @@ class dynamic_graph;
 //         The std::list edge container provides bidirectional iteration (unlike forward_list).
 //  Template parameters: EV (edge value or void), VV (vertex value or void), GV (graph value or void),
 //  VId (vertex id - any ordered type with operator<), Sourced (store source id on edge when true).
-template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false>
+//  Ordinals: when true, each vertex keeps a dense ordinal 0..N-1 (in vertices(g) order), renumbered by
+//  load_vertices/load_edges, which vertex descriptors return in O(1) from ordinal().
+template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false,
+          bool Ordinals = false>
 struct mol_graph_traits {
   using edge_value_type                      = EV;
   using vertex_value_type                    = VV;
   using graph_value_type                     = GV;
   using vertex_id_type                       = VId;
   static constexpr bool sourced              = Sourced;
+  static constexpr bool vertex_ordinals      = Ordinals;
 
   using edge_type   = dynamic_edge<EV, VV, GV, VId, Sourced, mol_graph_traits>;
   using vertex_type = dynamic_vertex<EV, VV, GV, VId, Sourced, mol_graph_traits>;
@@ -27,13 +27,20 @@ class dynamic_graph;
 //         Edges use std::vector for cache-friendly access and O(1) size().
 //  Template parameters: EV (edge value or void), VV (vertex value or void), GV (graph value or void),
 //  VId (vertex id - any hashable type with std::hash specialization), Sourced (store source id on edge when true).
-template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false>
+//  EdgeIndexThreshold: when non-zero, a vertex with at least this many edges keeps a hash index of its
+//  target ids so contains_edge and find_vertex_edge are O(1) on it.
+//  Ordinals: when true, each vertex keeps a dense ordinal 0..N-1 (in vertices(g) order), renumbered by
+//  load_vertices/load_edges, which vertex descriptors return in O(1) from ordinal().
+template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false,
+          size_t EdgeIndexThreshold = 0, bool Ordinals = false>
 struct uov_graph_traits {
-  using edge_value_type                      = EV;
-  using vertex_value_type                    = VV;
-  using graph_value_type                     = GV;
-  using vertex_id_type                       = VId;
-  static constexpr bool sourced              = Sourced;
+  using edge_value_type                        = EV;
+  using vertex_value_type                      = VV;
+  using graph_value_type                       = GV;
+  using vertex_id_type                         = VId;
+  static constexpr bool   sourced              = Sourced;
+  static constexpr size_t edge_index_threshold = EdgeIndexThreshold;
+  static constexpr bool   vertex_ordinals      = Ordinals;
 
   using edge_type   = dynamic_edge<EV, VV, GV, VId, Sourced, uov_graph_traits>;
   using vertex_type = dynamic_vertex<EV, VV, GV, VId, Sourced, uov_graph_traits>;
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+#include "graph/container/edge_block_list.hpp"
+
+namespace graph::container {
+
+// Forward declarations
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
+struct dynamic_edge;
+
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
+struct dynamic_vertex;
+
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
+class dynamic_graph;
+
+// vob_graph_traits
+//  Vertices: std::vector
+//  Edges:    edge_block_list (chain of 64-byte blocks from a pool shared by all vertices; appends
+//            don't relocate edges and scans stay within a cache line per block).
+//            Call g.compact() after heavy loading to lay each vertex's blocks out contiguously.
+//  Parameter semantics mirror vofl_graph_traits.
+template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false>
+struct vob_graph_traits {
+  using edge_value_type                      = EV;
+  using vertex_value_type                    = VV;
+  using graph_value_type                     = GV;
+  using vertex_id_type                       = VId;
+  static constexpr bool sourced              = Sourced;
+
+  using edge_type   = dynamic_edge<EV, VV, GV, VId, Sourced, vob_graph_traits>;
+  using vertex_type = dynamic_vertex<EV, VV, GV, VId, Sourced, vob_graph_traits>;
+  using graph_type  = dynamic_graph<EV, VV, GV, VId, Sourced, vob_graph_traits>;
+
+  using vertices_type = std::vector<vertex_type>;
+  using edges_type    = edge_block_list<edge_type, 64>;
+};
+
+} // namespace graph::container
@@ -19,13 +19,16 @@ class dynamic_graph;
 //  Vertices: std::vector
 //  Edges:    std::deque (stable iterators with random access).
 //  Parameter semantics mirror vofl_graph_traits.
-template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false>
+//  Tombstones: when true, erase_edge() marks edges dead instead of removing them; edges(g,u) skips
+//              dead edges and compact(g) reclaims them.
+template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false, bool Tombstones = false>
 struct vod_graph_traits {
   using edge_value_type                      = EV;
   using vertex_value_type                    = VV;
   using graph_value_type                     = GV;
   using vertex_id_type                       = VId;
   static constexpr bool sourced              = Sourced;
+  static constexpr bool tombstone_edges      = Tombstones;
 
   using edge_type   = dynamic_edge<EV, VV, GV, VId, Sourced, vod_graph_traits>;
   using vertex_type = dynamic_vertex<EV, VV, GV, VId, Sourced, vod_graph_traits>;
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+
+namespace graph::container {
+
+// Forward declarations
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
+struct dynamic_edge;
+
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
+struct dynamic_vertex;
+
+template <class EV, class VV, class GV, class VId, bool Sourced, class Traits>
+class dynamic_graph;
+
+// vov_bidirectional_graph_traits
+//  Vertices: std::vector
+//  Edges:    std::vector (contiguous; best for random access & cache locality).
+//  In-edges: std::vector of source ids, kept on each target vertex so in_edges(g,u) and
+//            in_degree(g,u) are O(1) to reach and traversing incoming edges doesn't need a transpose.
+//  Parameter semantics mirror vofl_graph_traits.
+template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false>
+struct vov_bidirectional_graph_traits {
+  using edge_value_type                      = EV;
+  using vertex_value_type                    = VV;
+  using graph_value_type                     = GV;
+  using vertex_id_type                       = VId;
+  static constexpr bool sourced              = Sourced;
+
+  using edge_type   = dynamic_edge<EV, VV, GV, VId, Sourced, vov_bidirectional_graph_traits>;
+  using vertex_type = dynamic_vertex<EV, VV, GV, VId, Sourced, vov_bidirectional_graph_traits>;
+  using graph_type  = dynamic_graph<EV, VV, GV, VId, Sourced, vov_bidirectional_graph_traits>;
+
+  using vertices_type = std::vector<vertex_type>;
+  using edges_type    = std::vector<edge_type>;
+  using in_edges_type = std::vector<VId>;
+};
+
+} // namespace graph::container
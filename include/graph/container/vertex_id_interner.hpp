@@ -0,0 +1,321 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "graph/graph_info.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  Maps external vertex keys (strings, sparse 64-bit ids, ...) to dense ids 0..N-1 so the graph can
+//  use vov or compressed_graph instead of a map/unordered_map vertex container, and maps the dense ids
+//  back to the keys when the results are reported.
+//
+//  Ids are assigned in the order keys are first seen. The bulk functions (intern_all, intern_edges)
+//  run in parallel and assign the same ids a sequential loop over intern() would.
+
+namespace graph::container {
+
+/**
+ * @ingroup graph_containers
+ * @brief Assigns dense vertex ids to external vertex keys.
+ *
+ * The forward mapping is a hash table split into independently locked shards, so intern() and find()
+ * may be called concurrently. The reverse mapping is a vector of keys indexed by id.
+ *
+ * key(), keys() and size() aren't synchronized with intern(); call them once interning is done.
+ * intern_all() and intern_edges() use all hardware threads themselves and mustn't run concurrently
+ * with any other member.
+ *
+ * Typical use with a dense graph:
+ * @code
+ *   auto to_edge = [](const row& r) { return copyable_edge_t<std::string, double>{r.from, r.to, r.weight}; };
+ *   vertex_id_interner<std::string> ids;
+ *   ids.intern_edges(rows, to_edge);
+ *   G g;
+ *   g.load_edges(rows, ids.edge_projection(to_edge), ids.size());
+ *   ...
+ *   std::cout << ids.key(uid);
+ * @endcode
+ *
+ * @tparam Key      External key type.
+ * @tparam VId      Dense vertex id type.
+ * @tparam Hash     Hash function for @c Key.
+ * @tparam KeyEqual Equality for @c Key.
+ */
+template <class Key, std::integral VId = uint32_t, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class vertex_id_interner {
+public:
+  using key_type       = Key;
+  using vertex_id_type = VId;
+  using hasher         = Hash;
+  using key_equal      = KeyEqual;
+  using keys_type      = std::vector<Key>;
+  using size_type      = size_t;
+
+  static constexpr size_t shard_count = 64;
+
+public:
+  vertex_id_interner() : state_(std::make_unique<state>()) {}
+
+  /**
+   * @brief Construct an empty interner with room for @c expected_keys keys.
+   */
+  explicit vertex_id_interner(size_type expected_keys) : vertex_id_interner() { reserve(expected_keys); }
+
+  vertex_id_interner(const vertex_id_interner&)            = delete;
+  vertex_id_interner& operator=(const vertex_id_interner&) = delete;
+  ~vertex_id_interner()                                     = default;
+
+  /**
+   * @brief Take the keys and ids of @c other, leaving it empty and usable.
+   * @note Allocates the empty shards left in @c other
+   */
+  vertex_id_interner(vertex_id_interner&& other) : state_(std::exchange(other.state_, std::make_unique<state>())) {}
+  vertex_id_interner& operator=(vertex_id_interner&& other) {
+    state_ = std::exchange(other.state_, std::make_unique<state>());
+    return *this;
+  }
+
+public: // Properties
+  /**
+   * @brief Number of keys interned, which is one more than the largest id assigned.
+   */
+  [[nodiscard]] size_type size() const noexcept { return state_->keys.size(); }
+  [[nodiscard]] bool      empty() const noexcept { return state_->keys.empty(); }
+
+  /**
+   * @brief The key of a dense id.
+   * @note Complexity: O(1)
+   */
+  [[nodiscard]] const key_type& key(vertex_id_type id) const { return state_->keys[static_cast<size_type>(id)]; }
+
+  /**
+   * @brief All keys indexed by their dense id.
+   */
+  [[nodiscard]] const keys_type& keys() const noexcept { return state_->keys; }
+
+  /**
+   * @brief The dense id of a key, if it has been interned. Safe to call concurrently with intern().
+   * @note Complexity: O(1) average
+   */
+  [[nodiscard]] std::optional<vertex_id_type> find(const key_type& k) const {
+    const shard&     sh = state_->shards[shard_of(k)];
+    std::lock_guard  lock(sh.mutex);
+    auto             it = sh.ids.find(k);
+    if (it == sh.ids.end())
+      return std::nullopt;
+    return it->second;
+  }
+
+  [[nodiscard]] bool contains(const key_type& k) const { return find(k).has_value(); }
+
+public: // Operations
+  void reserve(size_type expected_keys) {
+    state_->keys.reserve(expected_keys);
+    for (auto& sh : state_->shards)
+      sh.ids.reserve(expected_keys / shard_count + 1);
+  }
+
+  void clear() noexcept {
+    state_->keys.clear();
+    for (auto& sh : state_->shards)
+      sh.ids.clear();
+  }
+
+  /**
+   * @brief Return the dense id of a key, assigning the next id if it hasn't been seen before.
+   *
+   * Safe to call concurrently from several threads; the ids assigned then depend on the order the
+   * threads get to the keys.
+   *
+   * @throws std::overflow_error if a new id wouldn't fit in @c VId.
+   * @note Complexity: O(1) average
+   */
+  vertex_id_type intern(const key_type& k) {
+    shard&          sh = state_->shards[shard_of(k)];
+    std::lock_guard lock(sh.mutex);
+    auto            it = sh.ids.find(k);
+    if (it != sh.ids.end())
+      return it->second;
+    vertex_id_type id;
+    {
+      std::lock_guard keys_lock(state_->keys_mutex);
+      id = next_id(state_->keys.size());
+      state_->keys.push_back(k);
+    }
+    sh.ids.emplace(k, id);
+    return id;
+  }
+
+  /**
+   * @brief Intern every key of a range in parallel.
+   *
+   * Ids are assigned in the order keys first appear in @c rng, following any keys already interned.
+   *
+   * @param rng  The keys, or values that @c proj converts to keys.
+   * @param proj Projection from the range's value type to @c Key.
+   * @throws std::overflow_error if the new ids wouldn't fit in @c VId. No keys are added then.
+   * @note Complexity: O(N/P) expected with P hardware threads, plus O(K log K) for K new keys
+   */
+  template <std::ranges::random_access_range R, class Proj = std::identity>
+  requires std::convertible_to<std::invoke_result_t<Proj&, std::ranges::range_reference_t<R>>, key_type>
+  void intern_all(R&& rng, Proj proj = {}) {
+    auto first = std::ranges::begin(rng);
+    bulk_intern(static_cast<size_type>(std::ranges::distance(rng)),
+                [&](size_type i) -> key_type { return std::invoke(proj, first[static_cast<std::ptrdiff_t>(i)]); });
+  }
+
+  /**
+   * @brief Intern the source and target keys of every edge of a range in parallel.
+   *
+   * Keys are taken in the order source, target of the first edge, then of the second edge, etc.
+   *
+   * @param erng  The edges.
+   * @param eproj Projection from the range's value type to @c copyable_edge_t<Key,EV>, or to any type
+   *              with @c source_id and @c target_id members convertible to @c Key.
+   * @throws std::overflow_error if the new ids wouldn't fit in @c VId. No keys are added then.
+   */
+  template <std::ranges::random_access_range ERng, class EProj = std::identity>
+  void intern_edges(ERng&& erng, EProj eproj = {}) {
+    auto first = std::ranges::begin(erng);
+    bulk_intern(2 * static_cast<size_type>(std::ranges::distance(erng)), [&](size_type i) -> key_type {
+      auto&& e = std::invoke(eproj, first[static_cast<std::ptrdiff_t>(i / 2)]);
+      return (i % 2 == 0) ? key_type(e.source_id) : key_type(e.target_id);
+    });
+  }
+
+  /**
+   * @brief Projection for load_edges() that converts edges with external keys to dense ids.
+   *
+   * The function returned calls @c eproj to get a @c copyable_edge_t<Key,EV> and returns the
+   * @c copyable_edge_t<VId,EV> with the keys replaced by their ids. Keys that haven't been interned
+   * are interned by it, so it can be used without calling intern_edges() first. The interner must
+   * outlive the function returned.
+   */
+  template <class EProj = std::identity>
+  [[nodiscard]] auto edge_projection(EProj eproj = {}) {
+    return [this, eproj](const auto& edge_data) {
+      auto&& e = std::invoke(eproj, edge_data);
+      if constexpr (requires { e.value; }) {
+        using value_type = std::remove_cvref_t<decltype(e.value)>;
+        return copyable_edge_t<vertex_id_type, value_type>{intern(e.source_id), intern(e.target_id), e.value};
+      } else {
+        return copyable_edge_t<vertex_id_type, void>{intern(e.source_id), intern(e.target_id)};
+      }
+    };
+  }
+
+private:
+  struct alignas(64) shard {
+    mutable std::mutex                                        mutex;
+    std::unordered_map<key_type, vertex_id_type, Hash, KeyEqual> ids;
+  };
+
+  struct state {
+    shard      shards[shard_count];
+    std::mutex keys_mutex;
+    keys_type  keys;
+  };
+
+  // A key seen at position pos of a bulk input
+  struct pending_key {
+    size_type pos;
+    key_type  k;
+  };
+
+  static size_t shard_of(const key_type& k) {
+    // Fibonacci hashing spreads weak hashes (e.g. identity for integers) over the shards
+    const uint64_t h = uint64_t{Hash{}(k)} * 0x9E3779B97F4A7C15ull;
+    return (h >> 58) % shard_count;
+  }
+
+  static vertex_id_type next_id(size_type n) {
+    if (n > static_cast<size_type>(std::numeric_limits<vertex_id_type>::max()))
+      throw std::overflow_error("vertex_id_interner: too many keys for the vertex id type");
+    return static_cast<vertex_id_type>(n);
+  }
+
+  template <class GetKey>
+  void bulk_intern(size_type n, GetKey&& get_key) {
+    if (n == 0)
+      return;
+    state& st = *state_;
+
+    // 1. Bucket the keys that aren't interned yet by shard, in input order within each worker
+    using buckets_type = std::vector<std::vector<pending_key>>;
+    std::vector<buckets_type> local(graph::detail::hardware_threads(), buckets_type(shard_count));
+    const size_t              workers = graph::detail::parallel_for_chunks(
+          size_type{0}, n,
+          [&](size_type lo, size_type hi, size_t w) {
+            for (size_type i = lo; i < hi; ++i) {
+              key_type     k = get_key(i);
+              const size_t s = shard_of(k);
+              if (!st.shards[s].ids.contains(k))
+                local[w][s].push_back({i, std::move(k)});
+            }
+          },
+          4096);
+
+    // 2. Per shard, keep the first occurrence of each new key. Workers hold consecutive chunks, so
+    //    visiting them in order visits positions in increasing order.
+    std::vector<std::vector<pending_key>> fresh(shard_count);
+    graph::detail::parallel_for(
+          size_t{0}, shard_count,
+          [&](size_t s) {
+            std::unordered_map<key_type, bool, Hash, KeyEqual> seen;
+            for (size_t w = 0; w < workers; ++w)
+              for (pending_key& pk : local[w][s])
+                if (seen.emplace(pk.k, true).second)
+                  fresh[s].push_back(std::move(pk));
+          },
+          1);
+
+    // 3. Number the new keys in order of first appearance
+    std::vector<std::pair<size_type, std::pair<size_t, size_type>>> order; // pos, (shard, index)
+    for (size_t s = 0; s < shard_count; ++s)
+      for (size_type j = 0; j < fresh[s].size(); ++j)
+        order.push_back({fresh[s][j].pos, {s, j}});
+    if (order.empty())
+      return;
+    std::ranges::sort(order, {}, [](const auto& o) { return o.first; });
+
+    const size_type base = st.keys.size();
+    next_id(base + order.size() - 1); // throws before anything is modified
+    std::vector<std::vector<vertex_id_type>> ids(shard_count);
+    for (size_t s = 0; s < shard_count; ++s)
+      ids[s].resize(fresh[s].size());
+    st.keys.reserve(base + order.size());
+    for (size_type r = 0; r < order.size(); ++r) {
+      auto [s, j] = order[r].second;
+      ids[s][j]   = static_cast<vertex_id_type>(base + r);
+      st.keys.push_back(fresh[s][j].k);
+    }
+
+    // 4. Publish the forward mapping
+    graph::detail::parallel_for(
+          size_t{0}, shard_count,
+          [&](size_t s) {
+            auto& sh = st.shards[s].ids;
+            sh.reserve(sh.size() + fresh[s].size());
+            for (size_type j = 0; j < fresh[s].size(); ++j)
+              sh.emplace(std::move(fresh[s][j].k), ids[s][j]);
+          },
+          1);
+  }
+
+private:
+  std::unique_ptr<state> state_;
+};
+
+} // namespace graph::container
@@ -8,6 +8,7 @@
 #include "descriptor.hpp"
 #include <type_traits>
 #include <concepts>
+#include <iterator>
 
 namespace graph {
 
@@ -24,6 +25,10 @@ class vertex_descriptor_view;
 template<edge_iterator EdgeIter, vertex_iterator VertexIter>
 class edge_descriptor_view;
 
+template<edge_iterator EdgeIter, vertex_iterator VertexIter>
+    requires std::random_access_iterator<EdgeIter>
+class masked_edge_descriptor_view;
+
 // =============================================================================
 // Primary type trait templates
 // =============================================================================
@@ -126,6 +131,12 @@ struct is_edge_descriptor_view : std::false_type {};
 template<edge_iterator EdgeIter, vertex_iterator VertexIter>
 struct is_edge_descriptor_view<edge_descriptor_view<EdgeIter, VertexIter>> : std::true_type {};
 
+/**
+ * @brief Specialization for masked_edge_descriptor_view
+ */
+template<edge_iterator EdgeIter, vertex_iterator VertexIter>
+struct is_edge_descriptor_view<masked_edge_descriptor_view<EdgeIter, VertexIter>> : std::true_type {};
+
 /**
  * @brief Helper variable template for is_edge_descriptor_view
  * Removes cv-qualifiers before checking
@@ -151,6 +162,12 @@ struct is_descriptor_view<vertex_descriptor_view<VertexIter>> : std::true_type {
 template<edge_iterator EdgeIter, vertex_iterator VertexIter>
 struct is_descriptor_view<edge_descriptor_view<EdgeIter, VertexIter>> : std::true_type {};
 
+/**
+ * @brief Specialization for masked_edge_descriptor_view
+ */
+template<edge_iterator EdgeIter, vertex_iterator VertexIter>
+struct is_descriptor_view<masked_edge_descriptor_view<EdgeIter, VertexIter>> : std::true_type {};
+
 /**
  * @brief Helper variable template for is_descriptor_view
  * Removes cv-qualifiers before checking
@@ -200,6 +217,11 @@ struct edge_descriptor_edge_iterator_type<edge_descriptor_view<EdgeIter, VertexI
     using type = EdgeIter;
 };
 
+template<edge_iterator EdgeIter, vertex_iterator VertexIter>
+struct edge_descriptor_edge_iterator_type<masked_edge_descriptor_view<EdgeIter, VertexIter>> {
+    using type = EdgeIter;
+};
+
 /**
  * @brief Helper alias for edge_descriptor_edge_iterator_type
  */
@@ -222,6 +244,11 @@ struct edge_descriptor_vertex_iterator_type<edge_descriptor_view<EdgeIter, Verte
     using type = VertexIter;
 };
 
+template<edge_iterator EdgeIter, vertex_iterator VertexIter>
+struct edge_descriptor_vertex_iterator_type<masked_edge_descriptor_view<EdgeIter, VertexIter>> {
+    using type = VertexIter;
+};
+
 /**
  * @brief Helper alias for edge_descriptor_vertex_iterator_type
  */
@@ -0,0 +1,83 @@
+/**
+ * @file bitmap.hpp
+ * @brief Dense bit set over vertex indexes used by the traversal algorithms
+ *
+ * A bitmap is an array of 64-bit words. The plain members are for single-threaded use; the
+ * atomic_* members use std::atomic_ref on the word, so different threads can set bits of the
+ * same word concurrently. Whole words can be read and written through word(), which lets
+ * parallel loops that are split on word boundaries use the plain members without races.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graph::detail {
+
+class bitmap {
+public:
+  using word_type                        = uint64_t;
+  static constexpr size_t bits_per_word = 64;
+
+  bitmap() = default;
+  explicit bitmap(size_t n) : size_(n), words_(word_count(n), word_type{0}) {}
+
+  [[nodiscard]] static constexpr size_t word_count(size_t n) noexcept { return (n + bits_per_word - 1) / bits_per_word; }
+
+  [[nodiscard]] size_t size() const noexcept { return size_; }
+  [[nodiscard]] size_t num_words() const noexcept { return words_.size(); }
+
+  [[nodiscard]] word_type&       word(size_t w) noexcept { return words_[w]; }
+  [[nodiscard]] const word_type& word(size_t w) const noexcept { return words_[w]; }
+
+  [[nodiscard]] bool test(size_t i) const noexcept { return (words_[i / bits_per_word] & mask(i)) != 0; }
+  void               set(size_t i) noexcept { words_[i / bits_per_word] |= mask(i); }
+  void               reset(size_t i) noexcept { words_[i / bits_per_word] &= ~mask(i); }
+
+  /// Set bit i; true if this call changed it from 0 to 1. Safe to call concurrently.
+  bool atomic_test_and_set(size_t i) noexcept {
+    std::atomic_ref<word_type> w(words_[i / bits_per_word]);
+    if (w.load(std::memory_order_relaxed) & mask(i))
+      return false;
+    return (w.fetch_or(mask(i), std::memory_order_relaxed) & mask(i)) == 0;
+  }
+
+  /// Test bit i. Safe to call concurrently with atomic_test_and_set.
+  [[nodiscard]] bool atomic_test(size_t i) const noexcept {
+    std::atomic_ref<word_type> w(const_cast<word_type&>(words_[i / bits_per_word]));
+    return (w.load(std::memory_order_relaxed) & mask(i)) != 0;
+  }
+
+  void clear() noexcept { std::fill(words_.begin(), words_.end(), word_type{0}); }
+
+  /// Resize to n bits, all clear
+  void assign(size_t n) {
+    size_ = n;
+    words_.assign(word_count(n), word_type{0});
+  }
+
+  [[nodiscard]] size_t count() const noexcept {
+    size_t c = 0;
+    for (word_type w : words_)
+      c += static_cast<size_t>(std::popcount(w));
+    return c;
+  }
+
+  void swap(bitmap& other) noexcept {
+    std::swap(size_, other.size_);
+    words_.swap(other.words_);
+  }
+
+private:
+  [[nodiscard]] static constexpr word_type mask(size_t i) noexcept { return word_type{1} << (i % bits_per_word); }
+
+  size_t                 size_ = 0;
+  std::vector<word_type> words_;
+};
+
+} // namespace graph::detail
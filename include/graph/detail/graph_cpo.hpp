@@ -1753,6 +1753,293 @@ inline namespace _cpo_instances {
     inline constexpr _cpo_impls::_degree::_fn degree{};
 } // namespace _cpo_instances
 
+namespace _cpo_impls {
+    // =========================================================================
+    // in_edges(g, u) and in_edges(g, uid) CPO
+    // =========================================================================
+    
+    namespace _in_edges {
+        // Strategy enum for in_edges(g, u) - vertex descriptor version
+        enum class _St_u { _none, _member, _adl };
+        
+        // Check for g.in_edges(u) member function - vertex descriptor
+        template<typename G, typename U>
+        concept _has_member_u = requires(G& g, const U& u) {
+            { g.in_edges(u) } -> std::ranges::forward_range;
+        };
+        
+        // Check for ADL in_edges(g, u) - vertex descriptor
+        template<typename G, typename U>
+        concept _has_adl_u = requires(G& g, const U& u) {
+            { in_edges(g, u) } -> std::ranges::forward_range;
+        };
+        
+        template<typename G, typename U>
+        [[nodiscard]] consteval _Choice_t<_St_u> _Choose_u() noexcept {
+            if constexpr (_has_member_u<G, U>) {
+                return {_St_u::_member, noexcept(std::declval<G&>().in_edges(std::declval<const U&>()))};
+            } else if constexpr (_has_adl_u<G, U>) {
+                return {_St_u::_adl, noexcept(in_edges(std::declval<G&>(), std::declval<const U&>()))};
+            } else {
+                return {_St_u::_none, false};
+            }
+        }
+        
+        // Strategy enum for in_edges(g, uid) - vertex ID version
+        enum class _St_uid { _none, _member, _adl, _default };
+        
+        // Check for g.in_edges(uid) member function - vertex ID
+        template<typename G, typename VId>
+        concept _has_member_uid = requires(G& g, const VId& uid) {
+            { g.in_edges(uid) } -> std::ranges::forward_range;
+        };
+        
+        // Check for ADL in_edges(g, uid) - vertex ID
+        template<typename G, typename VId>
+        concept _has_adl_uid = requires(G& g, const VId& uid) {
+            { in_edges(g, uid) } -> std::ranges::forward_range;
+        };
+        
+        // Check if we can use default implementation: in_edges(g, *find_vertex(g, uid))
+        template<typename G, typename VId>
+        concept _has_default_uid = requires(G& g, const VId& uid) {
+            { find_vertex(g, uid) } -> std::input_iterator;
+            requires vertex_descriptor_type<decltype(*find_vertex(g, uid))>;
+            requires (_has_member_u<G, decltype(*find_vertex(g, uid))> || _has_adl_u<G, decltype(*find_vertex(g, uid))>);
+        };
+        
+        template<typename G, typename VId>
+        [[nodiscard]] consteval _Choice_t<_St_uid> _Choose_uid() noexcept {
+            if constexpr (_has_member_uid<G, VId>) {
+                return {_St_uid::_member, noexcept(std::declval<G&>().in_edges(std::declval<const VId&>()))};
+            } else if constexpr (_has_adl_uid<G, VId>) {
+                return {_St_uid::_adl, noexcept(in_edges(std::declval<G&>(), std::declval<const VId&>()))};
+            } else if constexpr (_has_default_uid<G, VId>) {
+                return {_St_uid::_default, false};
+            } else {
+                return {_St_uid::_none, false};
+            }
+        }
+        
+        class _fn {
+        private:
+            template<typename G, typename U>
+            static constexpr _Choice_t<_St_u> _Choice_u = _Choose_u<std::remove_cvref_t<G>, std::remove_cvref_t<U>>();
+            
+            template<typename G, typename VId>
+            static constexpr _Choice_t<_St_uid> _Choice_uid = _Choose_uid<std::remove_cvref_t<G>, std::remove_cvref_t<VId>>();
+            
+        public:
+            // in_edges(g, u) - vertex descriptor version
+            template<typename G, vertex_descriptor_type U>
+            [[nodiscard]] constexpr decltype(auto) operator()(G&& g, const U& u) const
+                noexcept(_Choice_u<G, U>._No_throw)
+                requires (_Choice_u<std::remove_cvref_t<G>, std::remove_cvref_t<U>>._Strategy != _St_u::_none)
+            {
+                using _G = std::remove_cvref_t<G>;
+                using _U = std::remove_cvref_t<U>;
+                
+                if constexpr (_Choice_u<_G, _U>._Strategy == _St_u::_member) {
+                    return g.in_edges(u);
+                } else if constexpr (_Choice_u<_G, _U>._Strategy == _St_u::_adl) {
+                    return in_edges(g, u);
+                }
+            }
+            
+            // in_edges(g, uid) - vertex ID version
+            template<typename G, typename VId>
+                requires (!vertex_descriptor_type<VId>)
+            [[nodiscard]] constexpr decltype(auto) operator()(G&& g, const VId& uid) const
+                noexcept(_Choice_uid<G, VId>._No_throw)
+                requires (_Choice_uid<std::remove_cvref_t<G>, std::remove_cvref_t<VId>>._Strategy != _St_uid::_none)
+            {
+                using _G = std::remove_cvref_t<G>;
+                using _VId = std::remove_cvref_t<VId>;
+                
+                if constexpr (_Choice_uid<_G, _VId>._Strategy == _St_uid::_member) {
+                    return g.in_edges(uid);
+                } else if constexpr (_Choice_uid<_G, _VId>._Strategy == _St_uid::_adl) {
+                    return in_edges(g, uid);
+                } else if constexpr (_Choice_uid<_G, _VId>._Strategy == _St_uid::_default) {
+                    // Default: find vertex then call in_edges(g, u)
+                    auto v = *find_vertex(g, uid);
+                    return (*this)(std::forward<G>(g), v);
+                }
+            }
+        };
+    } // namespace _in_edges
+} // namespace _cpo_impls
+
+// =============================================================================
+// in_edges(g, u) and in_edges(g, uid) - Public CPO instances
+// =============================================================================
+
+inline namespace _cpo_instances {
+    /**
+     * @brief CPO for getting the incoming edges of a vertex on a bidirectional graph
+     * 
+     * Usage: 
+     *   for (auto&& uid : graph::in_edges(my_graph, vertex_descriptor)) ...
+     *   for (auto&& uid : graph::in_edges(my_graph, vertex_id)) ...
+     * 
+     * Returns: A forward range with an element for each edge that has the vertex as its target.
+     *          There is no default; the graph must provide it as a member or through ADL.
+     *          dynamic_graph (with an in_edges_type) and compressed_graph (after build_in_edges())
+     *          yield the source vertex id of each edge.
+     */
+    inline constexpr _cpo_impls::_in_edges::_fn in_edges{};
+} // namespace _cpo_instances
+
+namespace _cpo_impls {
+    // =========================================================================
+    // in_degree(g, u) and in_degree(g, uid) CPO
+    // =========================================================================
+    
+    namespace _in_degree {
+        // Strategy enum for in_degree(g, u) - vertex descriptor version
+        enum class _St_u { _none, _member, _adl, _default };
+        
+        // Check for g.in_degree(u) member function - vertex descriptor
+        template<typename G, typename U>
+        concept _has_member_u = requires(G& g, const U& u) {
+            { g.in_degree(u) } -> std::integral;
+        };
+        
+        // Check for ADL in_degree(g, u) - vertex descriptor
+        template<typename G, typename U>
+        concept _has_adl_u = requires(G& g, const U& u) {
+            { in_degree(g, u) } -> std::integral;
+        };
+        
+        // Check if we can use default: count in_edges via size() or distance()
+        template<typename G, typename U>
+        concept _has_default_u = requires(G& g, const U& u) {
+            { _cpo_instances::in_edges(g, u) } -> std::ranges::forward_range;
+        };
+        
+        template<typename G, typename U>
+        [[nodiscard]] consteval _Choice_t<_St_u> _Choose_u() noexcept {
+            if constexpr (_has_member_u<G, U>) {
+                return {_St_u::_member, noexcept(std::declval<G&>().in_degree(std::declval<const U&>()))};
+            } else if constexpr (_has_adl_u<G, U>) {
+                return {_St_u::_adl, noexcept(in_degree(std::declval<G&>(), std::declval<const U&>()))};
+            } else if constexpr (_has_default_u<G, U>) {
+                return {_St_u::_default, noexcept(_cpo_instances::in_edges(std::declval<G&>(), std::declval<const U&>()))};
+            } else {
+                return {_St_u::_none, false};
+            }
+        }
+        
+        // Strategy enum for in_degree(g, uid) - vertex ID version
+        enum class _St_uid { _none, _member, _adl, _default };
+        
+        // Check for g.in_degree(uid) member function - vertex ID
+        template<typename G, typename VId>
+        concept _has_member_uid = requires(G& g, const VId& uid) {
+            { g.in_degree(uid) } -> std::integral;
+        };
+        
+        // Check for ADL in_degree(g, uid) - vertex ID
+        template<typename G, typename VId>
+        concept _has_adl_uid = requires(G& g, const VId& uid) {
+            { in_degree(g, uid) } -> std::integral;
+        };
+        
+        // Check if we can use default implementation: count in_edges(g, uid)
+        template<typename G, typename VId>
+        concept _has_default_uid = requires(G& g, const VId& uid) {
+            { _cpo_instances::in_edges(g, uid) } -> std::ranges::forward_range;
+        };
+        
+        template<typename G, typename VId>
+        [[nodiscard]] consteval _Choice_t<_St_uid> _Choose_uid() noexcept {
+            if constexpr (_has_member_uid<G, VId>) {
+                return {_St_uid::_member, noexcept(std::declval<G&>().in_degree(std::declval<const VId&>()))};
+            } else if constexpr (_has_adl_uid<G, VId>) {
+                return {_St_uid::_adl, noexcept(in_degree(std::declval<G&>(), std::declval<const VId&>()))};
+            } else if constexpr (_has_default_uid<G, VId>) {
+                return {_St_uid::_default, false};
+            } else {
+                return {_St_uid::_none, false};
+            }
+        }
+        
+        class _fn {
+        private:
+            template<typename G, typename U>
+            static constexpr _Choice_t<_St_u> _Choice_u = _Choose_u<std::remove_cvref_t<G>, std::remove_cvref_t<U>>();
+            
+            template<typename G, typename VId>
+            static constexpr _Choice_t<_St_uid> _Choice_uid = _Choose_uid<std::remove_cvref_t<G>, std::remove_cvref_t<VId>>();
+            
+            template<typename R>
+            [[nodiscard]] static constexpr auto _count(R&& r) {
+                if constexpr (std::ranges::sized_range<R>) {
+                    return std::ranges::size(r);
+                } else {
+                    return static_cast<size_t>(std::ranges::distance(r));
+                }
+            }
+            
+        public:
+            // in_degree(g, u) - vertex descriptor version
+            template<typename G, vertex_descriptor_type U>
+            [[nodiscard]] constexpr auto operator()(G&& g, const U& u) const
+                noexcept(_Choice_u<G, U>._No_throw)
+                requires (_Choice_u<std::remove_cvref_t<G>, std::remove_cvref_t<U>>._Strategy != _St_u::_none)
+            {
+                using _G = std::remove_cvref_t<G>;
+                using _U = std::remove_cvref_t<U>;
+                
+                if constexpr (_Choice_u<_G, _U>._Strategy == _St_u::_member) {
+                    return g.in_degree(u);
+                } else if constexpr (_Choice_u<_G, _U>._Strategy == _St_u::_adl) {
+                    return in_degree(g, u);
+                } else if constexpr (_Choice_u<_G, _U>._Strategy == _St_u::_default) {
+                    return _count(_cpo_instances::in_edges(std::forward<G>(g), u));
+                }
+            }
+            
+            // in_degree(g, uid) - vertex ID version
+            template<typename G, typename VId>
+                requires (!vertex_descriptor_type<VId>)
+            [[nodiscard]] constexpr auto operator()(G&& g, const VId& uid) const
+                noexcept(_Choice_uid<G, VId>._No_throw)
+                requires (_Choice_uid<std::remove_cvref_t<G>, std::remove_cvref_t<VId>>._Strategy != _St_uid::_none)
+            {
+                using _G = std::remove_cvref_t<G>;
+                using _VId = std::remove_cvref_t<VId>;
+                
+                if constexpr (_Choice_uid<_G, _VId>._Strategy == _St_uid::_member) {
+                    return g.in_degree(uid);
+                } else if constexpr (_Choice_uid<_G, _VId>._Strategy == _St_uid::_adl) {
+                    return in_degree(g, uid);
+                } else if constexpr (_Choice_uid<_G, _VId>._Strategy == _St_uid::_default) {
+                    return _count(_cpo_instances::in_edges(std::forward<G>(g), uid));
+                }
+            }
+        };
+    } // namespace _in_degree
+} // namespace _cpo_impls
+
+// =============================================================================
+// in_degree(g, u) and in_degree(g, uid) - Public CPO instances
+// =============================================================================
+
+inline namespace _cpo_instances {
+    /**
+     * @brief CPO for getting the in-degree (number of incoming edges) of a vertex
+     * 
+     * Usage: 
+     *   auto deg = graph::in_degree(my_graph, vertex_descriptor);
+     *   auto deg = graph::in_degree(my_graph, vertex_id);
+     * 
+     * Returns: Number of incoming edges to the vertex (integral type). Defaults to the size
+     *          of in_edges(g,u) when the graph doesn't provide it.
+     */
+    inline constexpr _cpo_impls::_in_degree::_fn in_degree{};
+} // namespace _cpo_instances
+
 namespace _cpo_impls {
     // =========================================================================
     // find_vertex_edge(g, u, v) and find_vertex_edge(g, u, vid) and 
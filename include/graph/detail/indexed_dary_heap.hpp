@@ -0,0 +1,164 @@
+/**
+ * @file indexed_dary_heap.hpp
+ * @brief Min-heap of dense ids with decrease-key, used by the shortest path algorithms
+ *
+ * Each id in [0, n) is in the heap at most once. A position array maps ids to their slot, so
+ * decrease() moves an entry up in place instead of pushing a duplicate as a lazy-deletion
+ * std::priority_queue does; the heap never holds more than n entries. Keys are kept next to
+ * the ids in the heap array, so sifting doesn't read an external key array.
+ *
+ * An arity of 4 makes the tree half as deep as a binary heap, and the 4 children of a slot are
+ * adjacent in memory, which suits the many decrease-keys (sift-up) and fewer pops (sift-down)
+ * of Dijkstra on sparse graphs.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace graph::detail {
+
+/**
+ * @brief Indexed d-ary min-heap of (key, id) pairs ordered by key.
+ *
+ * @tparam Key     Priority type
+ * @tparam Id      Unsigned integral id type; ids are in [0, capacity)
+ * @tparam Arity   Number of children of each slot
+ * @tparam Compare Strict weak order on keys; the heap's top is the least key
+ */
+template <class Key, class Id = size_t, size_t Arity = 4, class Compare = std::less<Key>>
+class indexed_dary_heap {
+  static_assert(Arity >= 2, "indexed_dary_heap needs at least 2 children per slot");
+
+public:
+  using key_type  = Key;
+  using id_type   = Id;
+  using size_type = size_t;
+
+  static constexpr Id npos = std::numeric_limits<Id>::max();
+
+  struct entry {
+    Key key;
+    Id  id;
+  };
+
+  indexed_dary_heap() = default;
+  explicit indexed_dary_heap(size_t capacity, Compare comp = Compare()) : pos_(capacity, npos), comp_(std::move(comp)) {}
+
+  /// Ids in [0, capacity) can be pushed. Clears the heap.
+  void reset(size_t capacity) {
+    heap_.clear();
+    pos_.assign(capacity, npos);
+  }
+
+  [[nodiscard]] bool   empty() const noexcept { return heap_.empty(); }
+  [[nodiscard]] size_t size() const noexcept { return heap_.size(); }
+  [[nodiscard]] size_t capacity() const noexcept { return pos_.size(); }
+
+  [[nodiscard]] bool       contains(Id id) const noexcept { return pos_[id] != npos; }
+  [[nodiscard]] const Key& key(Id id) const noexcept { return heap_[pos_[id]].key; }
+
+  [[nodiscard]] const entry& top() const noexcept { return heap_.front(); }
+
+  /// Add id, which must not be in the heap
+  void push(Id id, const Key& k) {
+    assert(!contains(id));
+    heap_.push_back(entry{k, id});
+    pos_[id] = static_cast<Id>(heap_.size() - 1);
+    sift_up(heap_.size() - 1);
+  }
+
+  /// Lower the key of id, which must be in the heap, to k
+  void decrease(Id id, const Key& k) {
+    const size_t i = pos_[id];
+    assert(!comp_(heap_[i].key, k));
+    heap_[i].key = k;
+    sift_up(i);
+  }
+
+  /// Push id with key k, or lower its key to k if it's in the heap with a greater key.
+  /// @return true if the heap changed
+  bool push_or_decrease(Id id, const Key& k) {
+    if (!contains(id)) {
+      push(id, k);
+      return true;
+    }
+    if (comp_(k, heap_[pos_[id]].key)) {
+      decrease(id, k);
+      return true;
+    }
+    return false;
+  }
+
+  /// Remove and return the entry with the least key
+  entry pop() {
+    entry result = heap_.front();
+    pos_[result.id] = npos;
+    if (heap_.size() > 1) {
+      heap_.front() = heap_.back();
+      pos_[heap_.front().id] = 0;
+      heap_.pop_back();
+      sift_down(0);
+    } else {
+      heap_.pop_back();
+    }
+    return result;
+  }
+
+  /// Remove all entries. O(size()), not O(capacity()), so a heap can be reused cheaply for searches
+  /// that touch few ids.
+  void clear() noexcept {
+    for (const entry& e : heap_)
+      pos_[e.id] = npos;
+    heap_.clear();
+  }
+
+private:
+  void sift_up(size_t i) {
+    entry e = heap_[i];
+    while (i > 0) {
+      const size_t parent = (i - 1) / Arity;
+      if (!comp_(e.key, heap_[parent].key))
+        break;
+      place(i, heap_[parent]);
+      i = parent;
+    }
+    place(i, e);
+  }
+
+  void sift_down(size_t i) {
+    const size_t n = heap_.size();
+    entry        e = heap_[i];
+    for (;;) {
+      const size_t first = i * Arity + 1;
+      if (first >= n)
+        break;
+      const size_t last = first + Arity < n ? first + Arity : n;
+      size_t       best = first;
+      for (size_t c = first + 1; c < last; ++c)
+        if (comp_(heap_[c].key, heap_[best].key))
+          best = c;
+      if (!comp_(heap_[best].key, e.key))
+        break;
+      place(i, heap_[best]);
+      i = best;
+    }
+    place(i, e);
+  }
+
+  void place(size_t i, const entry& e) {
+    heap_[i]   = e;
+    pos_[e.id] = static_cast<Id>(i);
+  }
+
+  std::vector<entry> heap_;
+  std::vector<Id>    pos_; // slot of each id, npos when not in the heap
+  [[no_unique_address]] Compare comp_{};
+};
+
+} // namespace graph::detail
@@ -0,0 +1,173 @@
+/**
+ * @file parallel.hpp
+ * @brief Minimal fork-join helpers used by containers and algorithms that process vertices in parallel
+ *
+ * The library has no dependency on a threading runtime. These helpers split an index range into
+ * contiguous chunks and run them on std::thread workers, falling back to the calling thread when
+ * the range is small or only one hardware thread is available. The first exception thrown by a
+ * worker is rethrown on the calling thread once all workers have joined.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace graph::detail {
+
+/**
+ * @brief Number of workers used by parallel_for; at least 1.
+ */
+[[nodiscard]] inline size_t hardware_threads() noexcept {
+  const unsigned n = std::thread::hardware_concurrency();
+  return n == 0 ? size_t{1} : static_cast<size_t>(n);
+}
+
+/**
+ * @brief Call @c f(lo, hi, worker) for contiguous chunks [lo,hi) that partition [first,last).
+ *
+ * At most @c hardware_threads() chunks are created and each has at least @c grain elements, so
+ * ranges smaller than 2*grain run on the calling thread as a single chunk with worker 0. Worker
+ * numbers are dense in [0, number of chunks), which lets callers keep per-worker accumulators.
+ *
+ * @param first First index
+ * @param last  One past the last index
+ * @param f     Callable as f(Index lo, Index hi, size_t worker)
+ * @param grain Minimum number of indices per chunk
+ * @return The number of chunks (workers) used
+ */
+template <std::integral Index, class F>
+size_t parallel_for_chunks(Index first, Index last, F&& f, size_t grain = 1024) {
+  if (!(first < last))
+    return 0;
+  const size_t n       = static_cast<size_t>(last - first);
+  const size_t workers = std::min(hardware_threads(), std::max(size_t{1}, n / std::max(grain, size_t{1})));
+  if (workers <= 1) {
+    f(first, last, size_t{0});
+    return 1;
+  }
+
+  std::exception_ptr       error;
+  std::mutex               error_mutex;
+  std::vector<std::thread> threads;
+  threads.reserve(workers - 1);
+  auto run = [&](size_t w) {
+    const Index lo = static_cast<Index>(first + static_cast<Index>(n * w / workers));
+    const Index hi = static_cast<Index>(first + static_cast<Index>(n * (w + 1) / workers));
+    try {
+      f(lo, hi, w);
+    } catch (...) {
+      std::lock_guard lock(error_mutex);
+      if (!error)
+        error = std::current_exception();
+    }
+  };
+  for (size_t w = 1; w < workers; ++w)
+    threads.emplace_back(run, w);
+  run(0);
+  for (auto& t : threads)
+    t.join();
+  if (error)
+    std::rethrow_exception(error);
+  return workers;
+}
+
+/**
+ * @brief Call @c f(i) for each i in [first,last), splitting the range across workers.
+ *
+ * @param first First index
+ * @param last  One past the last index
+ * @param f     Callable as f(Index i). Calls for different indices may run concurrently.
+ * @param grain Minimum number of indices per worker
+ */
+template <std::integral Index, class F>
+void parallel_for(Index first, Index last, F&& f, size_t grain = 1024) {
+  parallel_for_chunks(
+        first, last,
+        [&f](Index lo, Index hi, size_t) {
+          for (Index i = lo; i < hi; ++i)
+            f(i);
+        },
+        grain);
+}
+
+/**
+ * @brief Call @c f(lo, hi, part) for ranges of vertices [lo,hi) with about the same number of
+ *        vertices plus edges. Parts run in parallel.
+ *
+ * @param offsets The (n+1)-element prefix sum of the vertex degrees (or any per-vertex work)
+ * @param f       Callable as f(size_t lo, size_t hi, size_t part), with part < hardware_threads() * 8
+ */
+template <class F>
+void parallel_for_edge_balanced(const std::vector<size_t>& offsets, F&& f) {
+  const size_t n     = offsets.size() - 1;
+  const size_t work  = n + offsets.back();
+  const size_t parts = std::min(n, hardware_threads() * 8);
+  if (parts <= 1 || work < 8192) {
+    f(size_t{0}, n, size_t{0});
+    return;
+  }
+  // First vertex at which the work done so far reaches part p's share
+  auto boundary = [&](size_t p) {
+    const size_t target = work / parts * p + std::min(p, work % parts);
+    return *std::ranges::partition_point(std::views::iota(size_t{0}, n + 1),
+                                         [&](size_t v) { return v + offsets[v] < target; });
+  };
+  parallel_for(size_t{0}, parts, [&](size_t p) { f(boundary(p), boundary(p + 1), p); }, 1);
+}
+
+/**
+ * @brief Sort [first,last) by @c comp: chunks are sorted in parallel, then merged pairwise in
+ *        parallel rounds. Not stable.
+ *
+ * @param grain Minimum number of elements per chunk
+ */
+template <std::random_access_iterator It, class Comp = std::ranges::less>
+void parallel_sort(It first, It last, Comp comp = {}, size_t grain = 1 << 14) {
+  using Diff         = std::iter_difference_t<It>;
+  const size_t n     = static_cast<size_t>(last - first);
+  const size_t parts = std::min(hardware_threads(), std::max(size_t{1}, n / std::max(grain, size_t{1})));
+  if (parts <= 1) {
+    std::sort(first, last, comp);
+    return;
+  }
+  auto at = [&](size_t p) { return first + static_cast<Diff>(n * p / parts); };
+  parallel_for(size_t{0}, parts, [&](size_t p) { std::sort(at(p), at(p + 1), comp); }, 1);
+  for (size_t width = 1; width < parts; width *= 2)
+    parallel_for(
+          size_t{0}, (parts + 2 * width - 1) / (2 * width),
+          [&](size_t i) {
+            const size_t lo  = i * 2 * width;
+            const size_t mid = std::min(lo + width, parts);
+            const size_t hi  = std::min(lo + 2 * width, parts);
+            if (mid < hi)
+              std::inplace_merge(at(lo), at(mid), at(hi), comp);
+          },
+          1);
+}
+
+/**
+ * @brief Atomically lower @c target to @c value if value is less.
+ *
+ * @return true if this call lowered target
+ */
+template <class T>
+bool atomic_fetch_min(T& target, T value) noexcept {
+  std::atomic_ref<T> a(target);
+  T                  current = a.load(std::memory_order_relaxed);
+  while (value < current)
+    if (a.compare_exchange_weak(current, value, std::memory_order_relaxed))
+      return true;
+  return false;
+}
+
+} // namespace graph::detail
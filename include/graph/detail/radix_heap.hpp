@@ -0,0 +1,100 @@
+/**
+ * @file radix_heap.hpp
+ * @brief Monotone priority queue for unsigned integer keys
+ *
+ * A radix heap (Ahuja, Mehlhorn, Orlin & Tarjan) keeps entries in buckets by the highest bit in
+ * which their key differs from the last key popped. Keys pushed must be no less than that key,
+ * which Dijkstra's algorithm guarantees, and in return push is O(1) and pop is amortized
+ * O(log C) for keys up to C, with only sequential vector appends and scans.
+ *
+ * There is no decrease-key: a vertex whose distance improves is pushed again and the stale entry
+ * is skipped when it's popped.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace graph::detail {
+
+/**
+ * @brief Min-priority queue of (key, id) pairs whose keys never go below the last key popped.
+ *
+ * @tparam Key Unsigned integral key type
+ * @tparam Id  Id type carried with each key
+ */
+template <std::unsigned_integral Key, class Id = size_t>
+class radix_heap {
+public:
+  using key_type = Key;
+  using id_type  = Id;
+
+  struct entry {
+    Key key;
+    Id  id;
+  };
+
+  static constexpr size_t num_buckets = static_cast<size_t>(std::numeric_limits<Key>::digits) + 1;
+
+  [[nodiscard]] bool   empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_t size() const noexcept { return size_; }
+
+  /// The key of the last entry popped; keys pushed must be at least this
+  [[nodiscard]] Key last_key() const noexcept { return last_; }
+
+  void push(Id id, Key k) {
+    assert(k >= last_);
+    buckets_[bucket_of(k)].push_back(entry{k, id});
+    ++size_;
+  }
+
+  /// Remove and return an entry with the least key
+  entry pop() {
+    assert(!empty());
+    if (buckets_[0].empty())
+      redistribute();
+    entry e = buckets_[0].back();
+    buckets_[0].pop_back();
+    --size_;
+    return e;
+  }
+
+  /// Remove all entries and allow any key to be pushed again. Bucket memory is kept.
+  void clear() noexcept {
+    for (auto& b : buckets_)
+      b.clear();
+    size_ = 0;
+    last_ = 0;
+  }
+
+private:
+  [[nodiscard]] size_t bucket_of(Key k) const noexcept { return static_cast<size_t>(std::bit_width(static_cast<Key>(k ^ last_))); }
+
+  // Move the least key into last_, then spread the first non-empty bucket over the lower buckets.
+  // Every entry of bucket i lands in a bucket below i, so each entry moves at most digits times.
+  void redistribute() {
+    size_t i = 1;
+    while (buckets_[i].empty())
+      ++i;
+    Key least = buckets_[i].front().key;
+    for (const entry& e : buckets_[i])
+      if (e.key < least)
+        least = e.key;
+    last_ = least;
+    for (const entry& e : buckets_[i])
+      buckets_[bucket_of(e.key)].push_back(e);
+    buckets_[i].clear();
+  }
+
+  std::array<std::vector<entry>, num_buckets> buckets_;
+  Key                                         last_ = 0;
+  size_t                                      size_ = 0;
+};
+
+} // namespace graph::detail
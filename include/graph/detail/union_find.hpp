@@ -0,0 +1,144 @@
+/**
+ * @file union_find.hpp
+ * @brief Disjoint sets over dense ids, with sequential and lock-free operations
+ *
+ * Each set is a tree of parent links in a single vector, and a link always points from a larger
+ * id to a smaller one. The root of a set is therefore its least id, whatever order the sets were
+ * joined in, and it's the same for the sequential and the concurrent operations.
+ *
+ * The concurrent operations (Shiloach & Vishkin style linking, as used by Afforest) only write
+ * roots, with a compare-and-swap from id to the smaller root, so any number of threads can call
+ * concurrent_unite and concurrent_find together. They don't compress paths; compress() does that
+ * afterwards by pointer jumping, in parallel. Don't mix sequential and concurrent calls without a
+ * join in between.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "graph/detail/parallel.hpp"
+
+namespace graph::detail {
+
+/**
+ * @brief Disjoint sets of the ids [0, size()), each identified by its least id.
+ *
+ * @tparam Id Integral id type
+ */
+template <std::integral Id = size_t>
+class union_find {
+public:
+  using id_type = Id;
+
+  union_find() = default;
+  explicit union_find(size_t n) { reset(n); }
+
+  /// Make n singleton sets
+  void reset(size_t n) {
+    parent_.resize(n);
+    parallel_for(size_t{0}, n, [this](size_t i) { parent_[i] = static_cast<Id>(i); }, 1 << 16);
+  }
+
+  [[nodiscard]] size_t size() const noexcept { return parent_.size(); }
+
+  /// The parent link of x; after compress() it's the root of x's set
+  [[nodiscard]] Id parent(Id x) const noexcept { return parent_[index(x)]; }
+
+  /// All parent links, indexed by id
+  [[nodiscard]] const std::vector<Id>& parents() const noexcept { return parent_; }
+
+  /// Root of the set containing x, halving the path to it
+  Id find(Id x) noexcept {
+    while (parent_[index(x)] != x) {
+      Id& p = parent_[index(x)];
+      p     = parent_[index(p)];
+      x     = p;
+    }
+    return x;
+  }
+
+  /// Join the sets of a and b; false if they were already the same set
+  bool unite(Id a, Id b) noexcept {
+    a = find(a);
+    b = find(b);
+    if (a == b)
+      return false;
+    if (a < b)
+      std::swap(a, b);
+    parent_[index(a)] = b;
+    return true;
+  }
+
+  [[nodiscard]] bool same(Id a, Id b) noexcept { return find(a) == find(b); }
+
+  /// Root of the set containing x. Safe to call concurrently with concurrent_unite.
+  [[nodiscard]] Id concurrent_find(Id x) const noexcept {
+    for (;;) {
+      const Id p = load(x);
+      if (p == x)
+        return x;
+      x = p;
+    }
+  }
+
+  /**
+   * @brief Join the sets of a and b without locks.
+   *
+   * @return true if this call joined two different sets
+   */
+  bool concurrent_unite(Id a, Id b) noexcept {
+    Id pa = load(a);
+    Id pb = load(b);
+    while (pa != pb) {
+      const Id high   = std::max(pa, pb);
+      const Id low    = std::min(pa, pb);
+      Id       p_high = load(high);
+      if (p_high == low)
+        return false; // another thread linked them
+      if (p_high == high &&
+          std::atomic_ref<Id>(parent_[index(high)]).compare_exchange_strong(p_high, low, std::memory_order_relaxed))
+        return true;
+      pa = load(load(high));
+      pb = load(low);
+    }
+    return false;
+  }
+
+  /// Point every id directly at its root, in parallel
+  void compress() {
+    parallel_for(
+          size_t{0}, parent_.size(),
+          [this](size_t i) {
+            const Id x = static_cast<Id>(i);
+            Id       p = load(x);
+            for (Id pp = load(p); p != pp; pp = load(p))
+              p = pp;
+            std::atomic_ref<Id>(parent_[i]).store(p, std::memory_order_relaxed);
+          },
+          1 << 14);
+  }
+
+  /// Number of sets
+  [[nodiscard]] size_t count() const noexcept {
+    size_t roots = 0;
+    for (size_t i = 0; i < parent_.size(); ++i)
+      roots += parent_[i] == static_cast<Id>(i);
+    return roots;
+  }
+
+private:
+  [[nodiscard]] static size_t index(Id x) noexcept { return static_cast<size_t>(x); }
+
+  [[nodiscard]] Id load(Id x) const noexcept {
+    return std::atomic_ref<Id>(const_cast<Id&>(parent_[index(x)])).load(std::memory_order_relaxed);
+  }
+
+  std::vector<Id> parent_;
+};
+
+} // namespace graph::detail
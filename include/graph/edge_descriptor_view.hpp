@@ -8,6 +8,7 @@
 #include "edge_descriptor.hpp"
 #include <ranges>
 #include <iterator>
+#include <vector>
 
 namespace graph {
 
@@ -168,6 +169,123 @@ private:
     vertex_desc source_{};
 };
 
+/**
+ * @brief Forward-only view over random-access edge storage that skips masked-out edges
+ *
+ * Used for containers that delete edges by marking them (tombstones) rather than erasing them.
+ * Edge @c i is skipped when @c i < mask.size() and @c mask[i] is true; edges past the end of the
+ * mask are never skipped, so edges appended after the mask was last sized are visible. A null
+ * mask skips nothing.
+ *
+ * The view refers to the owner's mask and dead edge count rather than copying them, so edges
+ * marked dead after the view was created are skipped and no longer counted by size(), which stays
+ * O(1). Appending edges or compacting the container invalidates the view, as it does the
+ * container's iterators.
+ *
+ * @tparam EdgeIter Random access iterator type of the underlying edge container
+ * @tparam VertexIter Iterator type of the vertex container
+ */
+template<edge_iterator EdgeIter, vertex_iterator VertexIter>
+    requires std::random_access_iterator<EdgeIter>
+class masked_edge_descriptor_view : public std::ranges::view_interface<masked_edge_descriptor_view<EdgeIter, VertexIter>> {
+public:
+    using edge_desc = edge_descriptor<EdgeIter, VertexIter>;
+    using vertex_desc = vertex_descriptor<VertexIter>;
+    using edge_storage_type = typename edge_desc::edge_storage_type;
+    using mask_type = std::vector<bool>;
+
+    /**
+     * @brief Forward iterator that yields edge_descriptor values for unmasked edges
+     */
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = edge_desc;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const edge_desc*;
+        using reference = edge_desc;
+
+        constexpr iterator() noexcept = default;
+
+        constexpr iterator(edge_storage_type edge_pos, edge_storage_type end_pos, const mask_type* mask,
+                           vertex_desc source) noexcept
+            : current_edge_(edge_pos), end_(end_pos), mask_(mask), source_(source) {
+            skip_masked();
+        }
+
+        [[nodiscard]] constexpr edge_desc operator*() const noexcept {
+            return edge_desc{current_edge_, source_};
+        }
+
+        constexpr iterator& operator++() noexcept {
+            ++current_edge_;
+            skip_masked();
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept {
+            iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const iterator& other) const noexcept {
+            return current_edge_ == other.current_edge_;
+        }
+
+    private:
+        constexpr void skip_masked() noexcept {
+            if (mask_) {
+                const auto n = static_cast<edge_storage_type>(mask_->size());
+                while (current_edge_ < end_ && current_edge_ < n && (*mask_)[current_edge_])
+                    ++current_edge_;
+            }
+        }
+
+        edge_storage_type current_edge_{};
+        edge_storage_type end_{};
+        const mask_type* mask_ = nullptr;
+        vertex_desc source_{};
+    };
+
+    using const_iterator = iterator;
+
+    constexpr masked_edge_descriptor_view() noexcept = default;
+
+    /**
+     * @brief Construct view from an edge container, its mask and source vertex
+     * @param container The underlying edge container
+     * @param mask Mask of skipped edges, or nullptr
+     * @param masked Number of edges set in the mask, or nullptr for none
+     * @param source The source vertex for all edges in this container
+     */
+    template<typename Container>
+    constexpr masked_edge_descriptor_view(const Container& container, const mask_type* mask, const size_t* masked,
+                                          vertex_desc source) noexcept
+        : end_(static_cast<edge_storage_type>(container.size()))
+        , mask_(mask)
+        , masked_(masked)
+        , source_(source) {}
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return iterator{0, end_, mask_, source_}; }
+    [[nodiscard]] constexpr iterator end() const noexcept { return iterator{end_, end_, nullptr, source_}; }
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept { return end(); }
+
+    // Number of unmasked edges
+    [[nodiscard]] constexpr size_t size() const noexcept {
+        return static_cast<size_t>(end_) - (masked_ ? *masked_ : size_t{0});
+    }
+
+    [[nodiscard]] constexpr vertex_desc source() const noexcept { return source_; }
+
+private:
+    edge_storage_type end_{};
+    const mask_type* mask_ = nullptr;
+    const size_t* masked_ = nullptr;
+    vertex_desc source_{};
+};
+
 // Deduction guides for per-vertex adjacency
 template<typename Container, typename VertexDesc>
 edge_descriptor_view(Container&, VertexDesc) 
@@ -182,3 +300,6 @@ edge_descriptor_view(const Container&, VertexDesc)
 // Enable borrowed_range for edge_descriptor_view to allow std::ranges operations on temporaries
 template<typename EdgeIter, typename VertexIter>
 inline constexpr bool std::ranges::enable_borrowed_range<graph::edge_descriptor_view<EdgeIter, VertexIter>> = true;
+
+template<typename EdgeIter, typename VertexIter>
+inline constexpr bool std::ranges::enable_borrowed_range<graph::masked_edge_descriptor_view<EdgeIter, VertexIter>> = true;
@@ -0,0 +1,355 @@
+/**
+ * @file property_map.hpp
+ * @brief Dense per-vertex and per-edge value arrays keyed by descriptors
+ *
+ * vertex_property_map<G,T> and edge_property_map<G,T> hold one T per vertex or edge of a graph in a
+ * contiguous array, so algorithms can keep their scratch data (distances, colors, parents, ...) the
+ * same way for every graph type:
+ *
+ * @code
+ *   vertex_property_map<G, double> distance(g, infinity);
+ *   for (auto u : vertices(g))
+ *     for (auto uv : edges(g, u))
+ *       distance[target(g, uv)] = std::min(distance[target(g, uv)], distance[u] + 1);
+ * @endcode
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/detail/parallel.hpp"
+
+// NOTES
+//  Index graphs (random access vertex descriptors, e.g. vov and compressed_graph) use the vertex
+//  id as the array index. Graphs whose vertices are keyed (map/unordered_map vertex containers)
+//  number their vertices 0..N-1 in vertices(g) order when the map is built and keep a hash of
+//  vertex id to number. When their vertex descriptors have ordinal() (dynamic_graph with
+//  vertex_ordinals), the ordinal is used as the number instead, so access by descriptor doesn't
+//  hash. Edges are numbered by vertex, so the edges of a vertex are next to each other in the
+//  array.
+//
+//  The array is allocated without being written and then filled in parallel, so on NUMA systems
+//  its pages are placed near the threads that fill them. Elements are separate objects, so
+//  different elements can be written concurrently; atomic(k) gives a std::atomic_ref for updates
+//  of the same element. That rules out T = bool, whose vector packs 8 elements into a byte: use
+//  uint8_t or char for flags.
+//
+//  A map is a snapshot of the vertices and edges of the graph it was built from. Adding or
+//  removing vertices or edges invalidates it, as does compact() on a graph with tombstone edges.
+
+namespace graph {
+
+namespace detail {
+  /**
+   * @brief Allocator that default-initializes elements instead of value-initializing them.
+   *
+   * A vector of trivial values sized with it doesn't write its memory, which leaves the first
+   * write to the thread that fills it.
+   */
+  template <class T, class A = std::allocator<T>>
+  class default_init_allocator : public A {
+    using a_traits = std::allocator_traits<A>;
+
+  public:
+    template <class U>
+    struct rebind {
+      using other = default_init_allocator<U, typename a_traits::template rebind_alloc<U>>;
+    };
+
+    using A::A;
+    constexpr default_init_allocator() noexcept = default;
+    template <class U>
+    constexpr default_init_allocator(const default_init_allocator<U, typename a_traits::template rebind_alloc<U>>& other) noexcept
+          : A(other) {}
+
+    template <class U>
+    void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>) {
+      ::new (static_cast<void*>(p)) U;
+    }
+    template <class U, class... Args>
+    void construct(U* p, Args&&... args) {
+      a_traits::construct(static_cast<A&>(*this), p, std::forward<Args>(args)...);
+    }
+  };
+
+  template <class T>
+  using property_vector = std::vector<T, default_init_allocator<T>>;
+
+  // Assign value to every element of v, splitting the work across threads
+  template <class T>
+  void parallel_fill(property_vector<T>& v, const T& value) {
+    parallel_for_chunks(
+          size_t{0}, v.size(),
+          [&](size_t lo, size_t hi, size_t) {
+            std::fill(v.begin() + static_cast<std::ptrdiff_t>(lo), v.begin() + static_cast<std::ptrdiff_t>(hi), value);
+          },
+          4096);
+  }
+
+  template <class T>
+  [[nodiscard]] property_vector<T> make_property_vector(size_t n, const T& init) {
+    property_vector<T> v(n);
+    parallel_fill(v, init);
+    return v;
+  }
+} // namespace detail
+
+/**
+ * @brief One value of type T for each vertex of a graph of type G, indexed by vertex descriptor or id.
+ *
+ * The values are in a contiguous array ordered by vertex id for index graphs, and by the order of
+ * vertices(g) when the map was built otherwise.
+ *
+ * @tparam G Graph type
+ * @tparam T Value type
+ */
+template <adjacency_list G, class T>
+class vertex_property_map {
+  static_assert(!std::same_as<std::remove_cv_t<T>, bool>,
+                "vertex_property_map<G,bool> would be a bit-packed std::vector<bool>; use uint8_t or char");
+
+public:
+  using graph_type      = G;
+  using value_type      = T;
+  using vertex_id_type  = std::remove_cvref_t<vertex_id_t<G>>;
+  using size_type       = size_t;
+  using storage_type    = detail::property_vector<T>;
+  using reference       = typename storage_type::reference;
+  using const_reference = typename storage_type::const_reference;
+  using iterator        = typename storage_type::iterator;
+  using const_iterator  = typename storage_type::const_iterator;
+
+  /// Are vertex ids used as the index? Otherwise ids are hashed to their index.
+  static constexpr bool is_indexed = random_access_descriptor<vertex_t<G>>;
+
+  /// Do vertex descriptors give their index in O(1)? True for index graphs and keyed graphs with ordinals.
+  static constexpr bool has_ordinals = requires(const vertex_t<G>& u) { u.ordinal(); };
+
+public:
+  vertex_property_map() = default;
+
+  /**
+   * @brief Create a map with a value for each vertex of g, initialized to @c init in parallel.
+   * @note Complexity: O(V/P) with P hardware threads for index graphs, O(V) otherwise
+   */
+  explicit vertex_property_map(const G& g, const T& init = T{}) {
+    if constexpr (!is_indexed) {
+      index_.reserve(static_cast<size_t>(std::ranges::size(vertices(g))));
+      for (auto u : vertices(g)) {
+        if constexpr (has_ordinals)
+          index_.try_emplace(static_cast<vertex_id_type>(u.vertex_id()), u.ordinal());
+        else
+          index_.try_emplace(static_cast<vertex_id_type>(u.vertex_id()), index_.size());
+      }
+    }
+    values_ = detail::make_property_vector(static_cast<size_t>(std::ranges::size(vertices(g))), init);
+  }
+
+public: // Properties
+  [[nodiscard]] size_type size() const noexcept { return values_.size(); }
+  [[nodiscard]] bool      empty() const noexcept { return values_.empty(); }
+
+  [[nodiscard]] T*       data() noexcept { return values_.data(); }
+  [[nodiscard]] const T* data() const noexcept { return values_.data(); }
+
+  [[nodiscard]] iterator       begin() noexcept { return values_.begin(); }
+  [[nodiscard]] iterator       end() noexcept { return values_.end(); }
+  [[nodiscard]] const_iterator begin() const noexcept { return values_.begin(); }
+  [[nodiscard]] const_iterator end() const noexcept { return values_.end(); }
+
+  /**
+   * @brief Array index of a vertex, given as a vertex descriptor or a vertex id.
+   * @throws graph_error if the graph is keyed and the vertex wasn't in it when the map was built.
+   * @note Complexity: O(1) for index graphs and descriptors with ordinal(), O(1) average otherwise
+   */
+  template <class K>
+    requires vertex_descriptor_type<K> || std::convertible_to<const K&, vertex_id_type>
+  [[nodiscard]] size_type index_of(const K& k) const {
+    if constexpr (vertex_descriptor_type<K>) {
+      if constexpr (requires { k.ordinal(); })
+        return k.ordinal();
+      else
+        return find_index(static_cast<vertex_id_type>(k.vertex_id()));
+    } else if constexpr (is_indexed) {
+      return static_cast<size_type>(k);
+    } else {
+      return find_index(static_cast<vertex_id_type>(k));
+    }
+  }
+
+public: // Element access
+  template <class K>
+    requires vertex_descriptor_type<K> || std::convertible_to<const K&, vertex_id_type>
+  [[nodiscard]] reference operator[](const K& k) {
+    return values_[index_of(k)];
+  }
+  template <class K>
+    requires vertex_descriptor_type<K> || std::convertible_to<const K&, vertex_id_type>
+  [[nodiscard]] const_reference operator[](const K& k) const {
+    return values_[index_of(k)];
+  }
+
+  /**
+   * @brief Atomic access to the value of a vertex, for concurrent updates of the same element.
+   */
+  template <class K>
+    requires(vertex_descriptor_type<K> || std::convertible_to<const K&, vertex_id_type>) && std::is_trivially_copyable_v<T>
+  [[nodiscard]] std::atomic_ref<T> atomic(const K& k) noexcept(is_indexed) {
+    static_assert(alignof(T) >= std::atomic_ref<T>::required_alignment, "T isn't aligned for atomic access");
+    return std::atomic_ref<T>(values_[index_of(k)]);
+  }
+
+public: // Operations
+  /**
+   * @brief Assign @c value to every element, in parallel.
+   */
+  void fill(const T& value) { detail::parallel_fill(values_, value); }
+
+private:
+  size_type find_index(const vertex_id_type& uid) const {
+    auto it = index_.find(uid);
+    if (it == index_.end())
+      throw graph_error("vertex_property_map: vertex isn't in the map");
+    return it->second;
+  }
+
+private:
+  storage_type                                  values_;
+  std::unordered_map<vertex_id_type, size_type> index_; // keyed graphs only
+};
+
+/**
+ * @brief One value of type T for each edge of a graph of type G, indexed by edge descriptor.
+ *
+ * Edges are numbered by source vertex in vertices(g) order, then by their position in
+ * edges(g,u). When edges are stored in random access containers the number is computed from the
+ * edge's position and a per-vertex offset; otherwise edges are hashed by address to their number.
+ *
+ * @tparam G Graph type
+ * @tparam T Value type
+ */
+template <adjacency_list G, class T>
+class edge_property_map {
+  static_assert(!std::same_as<std::remove_cv_t<T>, bool>,
+                "edge_property_map<G,bool> would be a bit-packed std::vector<bool>; use uint8_t or char");
+
+public:
+  using graph_type      = G;
+  using value_type      = T;
+  using size_type       = size_t;
+  using storage_type    = detail::property_vector<T>;
+  using reference       = typename storage_type::reference;
+  using const_reference = typename storage_type::const_reference;
+  using iterator        = typename storage_type::iterator;
+  using const_iterator  = typename storage_type::const_iterator;
+
+  /// Are edge positions used to compute the index? Otherwise edges are hashed to their index.
+  static constexpr bool is_indexed = random_access_descriptor<edge_t<G>>;
+
+public:
+  edge_property_map() = default;
+
+  /**
+   * @brief Create a map with a value for each edge of g, initialized to @c init in parallel.
+   *
+   * With tombstone edges, the array also has room for the dead edges that are still stored.
+   *
+   * @note Complexity: O(V + E)
+   */
+  explicit edge_property_map(const G& g, const T& init = T{}) {
+    size_t n = 0;
+    if constexpr (is_indexed) {
+      first_ = vertex_property_map<G, size_type>(g, 0);
+      for (auto u : vertices(g)) {
+        // Reserve the positions from the first to the last edge of u, and offset them by n
+        size_t first = 0, last = 0;
+        bool   any   = false;
+        for (auto uv : edges(g, u)) {
+          if (!any)
+            first = static_cast<size_t>(uv.value());
+          last = static_cast<size_t>(uv.value()) + 1;
+          any  = true;
+        }
+        first_[u] = n - first; // unsigned wrap-around is undone by adding the position back
+        n += last - first;
+      }
+    } else {
+      for (auto u : vertices(g))
+        for (auto uv : edges(g, u))
+          index_.try_emplace(std::addressof(*uv.value()), n++);
+    }
+    values_ = detail::make_property_vector(n, init);
+  }
+
+public: // Properties
+  [[nodiscard]] size_type size() const noexcept { return values_.size(); }
+  [[nodiscard]] bool      empty() const noexcept { return values_.empty(); }
+
+  [[nodiscard]] T*       data() noexcept { return values_.data(); }
+  [[nodiscard]] const T* data() const noexcept { return values_.data(); }
+
+  [[nodiscard]] iterator       begin() noexcept { return values_.begin(); }
+  [[nodiscard]] iterator       end() noexcept { return values_.end(); }
+  [[nodiscard]] const_iterator begin() const noexcept { return values_.begin(); }
+  [[nodiscard]] const_iterator end() const noexcept { return values_.end(); }
+
+  /**
+   * @brief Array index of an edge descriptor.
+   * @throws graph_error if edges are hashed and the edge wasn't in the graph when the map was built.
+   * @note Complexity: O(1) when indexed, O(1) average otherwise
+   */
+  template <edge_descriptor_type E>
+  [[nodiscard]] size_type index_of(const E& uv) const {
+    if constexpr (random_access_descriptor<E>) {
+      return first_[uv.source()] + static_cast<size_type>(uv.value());
+    } else {
+      auto it = index_.find(std::addressof(*uv.value()));
+      if (it == index_.end())
+        throw graph_error("edge_property_map: edge isn't in the map");
+      return it->second;
+    }
+  }
+
+public: // Element access
+  template <edge_descriptor_type E>
+  [[nodiscard]] reference operator[](const E& uv) {
+    return values_[index_of(uv)];
+  }
+  template <edge_descriptor_type E>
+  [[nodiscard]] const_reference operator[](const E& uv) const {
+    return values_[index_of(uv)];
+  }
+
+  /**
+   * @brief Atomic access to the value of an edge, for concurrent updates of the same element.
+   */
+  template <edge_descriptor_type E>
+    requires std::is_trivially_copyable_v<T>
+  [[nodiscard]] std::atomic_ref<T> atomic(const E& uv) {
+    static_assert(alignof(T) >= std::atomic_ref<T>::required_alignment, "T isn't aligned for atomic access");
+    return std::atomic_ref<T>(values_[index_of(uv)]);
+  }
+
+public: // Operations
+  /**
+   * @brief Assign @c value to every element, in parallel.
+   */
+  void fill(const T& value) { detail::parallel_fill(values_, value); }
+
+private:
+  storage_type                               values_;
+  vertex_property_map<G, size_type>          first_; // indexed: index of position 0 of each vertex's edges
+  std::unordered_map<const void*, size_type> index_; // otherwise: edge address to index
+};
+
+} // namespace graph
@@ -70,6 +70,26 @@ public:
         }
     }
     
+    /**
+     * @brief Get the dense ordinal of the vertex, in [0, number of vertices)
+     * @return For random access: the index. For bidirectional: the ordinal kept on the vertex value
+     * 
+     * Only available for keyed vertices when the vertex value has an ordinal() member, such as
+     * dynamic_graph with vertex ordinals enabled. It's O(1), unlike a lookup of vertex_id() in a
+     * hash or tree, so per-vertex data can be kept in flat arrays.
+     */
+    [[nodiscard]] constexpr std::size_t ordinal() const noexcept
+        requires std::random_access_iterator<VertexIter> || requires(const VertexIter& it) {
+            { std::get<1>(*it).ordinal() } -> std::convertible_to<std::size_t>;
+        }
+    {
+        if constexpr (std::random_access_iterator<VertexIter>) {
+            return storage_;
+        } else {
+            return static_cast<std::size_t>(std::get<1>(*storage_).ordinal());
+        }
+    }
+    
     /**
      * @brief Get the underlying container value (the actual vertex data)
      * @param container The underlying vertex container
@@ -0,0 +1,266 @@
+/**
+ * @file depth_first_search.hpp
+ * @brief Non-recursive depth-first search as a lazy range of vertices
+ *
+ * @code
+ *   for (auto&& [vid, u] : views::vertices_depth_first_search(g, seed))
+ *     ...; // vertices reachable from seed, in discovery (pre-)order
+ *
+ *   struct postorder {
+ *     std::vector<uint32_t>* out;
+ *     void on_finish_vertex(const G& g, vertex_t<const G> u) { out->push_back(vertex_id(g, u)); }
+ *   };
+ *   auto dfs = views::vertices_depth_first_search(g, seed, postorder{&order});
+ *   for (auto&& vi : dfs) {}
+ * @endcode
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "graph/graph.hpp"
+#include "graph/adjacency_list_concepts.hpp"
+#include "graph/algorithm/common_adjacency.hpp"
+#include "graph/detail/bitmap.hpp"
+
+// NOTES
+//  The search keeps an explicit stack with one frame per vertex on the current path, holding the
+//  vertex and its position in edges(g,u), so its depth is bounded by memory rather than by the
+//  call stack. Advancing the iterator resumes the top frame until it finds an unvisited target,
+//  which is pushed and returned; exhausted frames are popped (finishing their vertex) on the way.
+//
+//  Visited vertices are a bitmap indexed by u.ordinal(): the vertex id of index graphs, and the
+//  dense ordinal of keyed dynamic_graph vertices (Traits::vertex_ordinals). The bitmap and the
+//  stack are sized when the view is created; reset() and resume() start another search reusing
+//  them, so repeated queries on the same graph don't allocate once the stack has reached its
+//  deepest size.
+//
+//  The visitor is a plain object whose hooks are found at compile time. Any of these members may
+//  be defined; the others cost nothing:
+//
+//    vis.on_discover_vertex(g, u)  when u is first reached (it's also the element yielded)
+//    vis.on_examine_edge(g, uv)    for each edge out of a vertex on the stack
+//    vis.on_finish_vertex(g, u)    when all edges of u have been followed
+//
+//  The iterators of edges(g,u) must stay valid after the range returned by edges(g,u) is
+//  destroyed, as they do for dynamic_graph and compressed_graph. The view is a snapshot: adding
+//  vertices or edges during a search invalidates it.
+
+namespace graph::views {
+
+/**
+ * @brief DFS visitor with no hooks; the default of vertices_depth_first_search
+ */
+struct dfs_null_visitor {};
+
+namespace detail {
+  template <class Vis, class G, class V>
+  concept has_on_discover_vertex = requires(Vis& vis, G& g, const V& u) { vis.on_discover_vertex(g, u); };
+  template <class Vis, class G, class E>
+  concept has_on_examine_edge = requires(Vis& vis, G& g, const E& uv) { vis.on_examine_edge(g, uv); };
+  template <class Vis, class G, class V>
+  concept has_on_finish_vertex = requires(Vis& vis, G& g, const V& u) { vis.on_finish_vertex(g, u); };
+
+  /// Graphs whose vertex descriptors have a dense index in [0, num_vertices(g))
+  template <class G>
+  concept ordinal_vertices = requires(const vertex_t<G>& u) {
+    { u.ordinal() } -> std::convertible_to<size_t>;
+  };
+} // namespace detail
+
+/**
+ * @brief Range of the vertices reachable from a seed, in depth-first discovery order.
+ *
+ * Elements are vertex_info<vertex_id, vertex_t<G>, void>, so they can be bound as [vid, u].
+ * The range is an input range: iterating it runs the search, and it can be iterated once per
+ * reset() or resume().
+ *
+ * @tparam G       Graph type (may be const)
+ * @tparam Visitor Hook object, stored by value or, when a reference type, by reference
+ */
+template <adjacency_list G, class Visitor = dfs_null_visitor>
+requires detail::ordinal_vertices<G>
+class vertices_depth_first_search_view
+      : public std::ranges::view_interface<vertices_depth_first_search_view<G, Visitor>> {
+public:
+  using graph_type      = G;
+  using vertex_type     = vertex_t<G>;
+  using vertex_id_type  = std::remove_cvref_t<vertex_id_t<G>>;
+  using edge_range_type = vertex_edge_range_t<G>;
+  using edge_iterator   = std::ranges::iterator_t<edge_range_type>;
+  using edge_sentinel   = std::ranges::sentinel_t<edge_range_type>;
+  using value_type      = vertex_info<vertex_id_type, vertex_type, void>;
+
+private:
+  struct frame {
+    vertex_type   u;
+    edge_iterator it;
+    edge_sentinel last;
+  };
+
+public:
+  class iterator {
+  public:
+    using iterator_concept = std::input_iterator_tag;
+    using value_type       = vertices_depth_first_search_view::value_type;
+    using difference_type  = std::ptrdiff_t;
+    using reference        = value_type;
+
+    iterator() = default;
+    explicit iterator(vertices_depth_first_search_view* view) noexcept : view_(view) {}
+
+    [[nodiscard]] value_type operator*() const {
+      const vertex_type& u = view_->stack_.back().u;
+      return value_type{static_cast<vertex_id_type>(graph::vertex_id(*view_->g_, u)), u};
+    }
+
+    iterator& operator++() {
+      view_->advance();
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+
+    [[nodiscard]] friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept {
+      return it.view_->depth() == 0;
+    }
+
+  private:
+    vertices_depth_first_search_view* view_ = nullptr;
+  };
+
+  /**
+   * @brief Prepare a search of g from the vertex with id @c seed
+   * @throws graph_error if g has no vertex with id @c seed
+   * @note Allocates a bitmap of num_vertices(g) bits; the search itself runs as the range is iterated
+   */
+  template <class V = Visitor>
+  vertices_depth_first_search_view(G& g, const vertex_id_type& seed, V&& vis = V{})
+        : g_(&g), visited_(static_cast<size_t>(graph::num_vertices(g))), visitor_(std::forward<V>(vis)) {
+    start(find_seed(seed));
+  }
+
+  /// Prepare a search of g from the vertex @c seed
+  template <class V = Visitor>
+  vertices_depth_first_search_view(G& g, const vertex_type& seed, V&& vis = V{})
+        : g_(&g), visited_(static_cast<size_t>(graph::num_vertices(g))), visitor_(std::forward<V>(vis)) {
+    start(seed);
+  }
+
+  [[nodiscard]] iterator                begin() { return iterator(this); }
+  [[nodiscard]] std::default_sentinel_t end() const noexcept { return {}; }
+
+  /**
+   * @brief Start a new search from @c seed, forgetting the vertices visited so far.
+   * @throws graph_error if seed isn't a vertex of the graph
+   * @note Complexity: O(V/64) to clear the bitmap; no allocation
+   */
+  void reset(const vertex_id_type& seed) { reset(find_seed(seed)); }
+  void reset(const vertex_type& seed) {
+    stack_.clear();
+    visited_.clear();
+    start(seed);
+  }
+
+  /**
+   * @brief Start another search from @c seed that skips the vertices visited by earlier ones.
+   *
+   * Running resume() over every vertex builds a depth-first forest of the whole graph. The range
+   * is empty when seed has already been visited.
+   */
+  void resume(const vertex_id_type& seed) { resume(find_seed(seed)); }
+  void resume(const vertex_type& seed) {
+    stack_.clear();
+    if (index_of(seed) >= visited_.size() || !visited(seed)) // start() rejects a seed outside g
+      start(seed);
+  }
+
+  /// Has u been reached by this search (or, after resume(), an earlier one)?
+  [[nodiscard]] bool visited(const vertex_type& u) const noexcept { return visited_.test(index_of(u)); }
+  [[nodiscard]] bool visited(const vertex_id_type& uid) const { return visited(find_seed(uid)); }
+
+  /// Number of vertices on the current path from the seed, including the current vertex
+  [[nodiscard]] size_t depth() const noexcept { return stack_.size(); }
+
+  [[nodiscard]] std::remove_reference_t<Visitor>&       visitor() noexcept { return visitor_; }
+  [[nodiscard]] const std::remove_reference_t<Visitor>& visitor() const noexcept { return visitor_; }
+
+private:
+  using visitor_type = std::remove_reference_t<Visitor>;
+
+  [[nodiscard]] static size_t index_of(const vertex_type& u) noexcept { return static_cast<size_t>(u.ordinal()); }
+
+  // The vertex with id uid, which must be in g
+  [[nodiscard]] vertex_type find_seed(const vertex_id_type& uid) const {
+    auto it = graph::find_vertex(*g_, graph::detail::native_id<G>(uid));
+    if (it == std::ranges::end(graph::vertices(*g_)))
+      throw graph_error("vertices_depth_first_search: seed isn't a vertex of the graph");
+    return *it;
+  }
+
+  void start(const vertex_type& seed) {
+    if (index_of(seed) >= visited_.size())
+      throw graph_error("vertices_depth_first_search: seed isn't a vertex of the graph");
+    visited_.set(index_of(seed));
+    push(seed);
+  }
+
+  void push(const vertex_type& u) {
+    auto&& r = graph::edges(*g_, u);
+    stack_.push_back(frame{u, std::ranges::begin(r), std::ranges::end(r)});
+    if constexpr (detail::has_on_discover_vertex<visitor_type, G, vertex_type>)
+      visitor_.on_discover_vertex(*g_, u);
+  }
+
+  // Move to the next undiscovered vertex, finishing the vertices whose edges run out on the way
+  void advance() {
+    while (!stack_.empty()) {
+      frame& top = stack_.back();
+      while (top.it != top.last) {
+        auto uv = *top.it;
+        ++top.it;
+        if constexpr (detail::has_on_examine_edge<visitor_type, G, decltype(uv)>)
+          visitor_.on_examine_edge(*g_, uv);
+        auto v = graph::target(*g_, uv);
+        if (!visited_.test(index_of(v))) {
+          visited_.set(index_of(v));
+          push(v); // may reallocate the stack, invalidating top
+          return;
+        }
+      }
+      if constexpr (detail::has_on_finish_vertex<visitor_type, G, vertex_type>)
+        visitor_.on_finish_vertex(*g_, top.u);
+      stack_.pop_back();
+    }
+  }
+
+  G*                    g_ = nullptr;
+  std::vector<frame>    stack_;
+  graph::detail::bitmap visited_;
+  Visitor               visitor_;
+};
+
+/**
+ * @brief Depth-first search of the vertices reachable from @c seed, as a lazy range.
+ *
+ * @param g    Graph whose vertex descriptors have ordinal(): index graphs, or keyed dynamic_graph
+ *             with Traits::vertex_ordinals
+ * @param seed Vertex id or descriptor to start from
+ * @param vis  Visitor with optional on_discover_vertex/on_examine_edge/on_finish_vertex hooks. An
+ *             lvalue is used by reference, an rvalue is moved into the view.
+ * @return A vertices_depth_first_search_view
+ * @throws graph_error if seed isn't a vertex of g
+ * @note Complexity: O(V + E) for a full iteration, with O(depth) extra space beyond the bitmap
+ */
+template <adjacency_list G, class Seed, class Visitor = dfs_null_visitor>
+requires detail::ordinal_vertices<G>
+[[nodiscard]] auto vertices_depth_first_search(G& g, const Seed& seed, Visitor&& vis = Visitor{}) {
+  return vertices_depth_first_search_view<G, Visitor>(g, seed, std::forward<Visitor>(vis));
+}
+
+} // namespace graph::views
@@ -0,0 +1,103 @@
+/**
+ * @file algorithm_test_graphs.hpp
+ * @brief Random edge lists, and graphs built from them, shared by the algorithm tests
+ *
+ * Every generator takes an explicit seed and returns edges sorted by source id, as
+ * compressed_graph requires. A test that needs a particular shape (hubs, clusters, a DAG)
+ * builds it on top of these and keeps it next to its reference implementation.
+ */
+
+#pragma once
+
+#include <graph/graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace graph::test {
+
+template <class EV = void>
+using edge_list_t = std::vector<copyable_edge_t<uint32_t, EV>>;
+
+template <class G>
+inline constexpr bool is_compressed_graph_v = false;
+template <class EV, class VV, class GV, class VId, class EIndex, class Alloc>
+inline constexpr bool is_compressed_graph_v<container::compressed_graph<EV, VV, GV, VId, EIndex, Alloc>> = true;
+
+/// Sorts edges by source id, keeping the order of the edges out of each vertex
+template <class EE>
+void sort_by_source(EE& ee) {
+  std::ranges::stable_sort(ee, [](const auto& a, const auto& b) { return a.source_id < b.source_id; });
+}
+
+/// m random directed edges over [0, n), with the self-loops and duplicates that come up
+inline edge_list_t<> random_edges(uint32_t n, uint32_t m, uint32_t seed) {
+  std::mt19937                            rng(seed);
+  std::uniform_int_distribution<uint32_t> pick(0, n - 1);
+  edge_list_t<>                           ee;
+  ee.reserve(m);
+  for (uint32_t i = 0; i < m; ++i) {
+    const uint32_t u = pick(rng), v = pick(rng);
+    ee.push_back({u, v});
+  }
+  sort_by_source(ee);
+  return ee;
+}
+
+/// m random undirected edges over [0, n), each stored in both directions
+inline edge_list_t<> random_symmetric_edges(uint32_t n, uint32_t m, uint32_t seed) {
+  std::mt19937                            rng(seed);
+  std::uniform_int_distribution<uint32_t> pick(0, n - 1);
+  edge_list_t<>                           ee;
+  ee.reserve(2 * size_t{m});
+  for (uint32_t i = 0; i < m; ++i) {
+    const uint32_t u = pick(rng), v = pick(rng);
+    ee.push_back({u, v});
+    ee.push_back({v, u});
+  }
+  sort_by_source(ee);
+  return ee;
+}
+
+/// random_symmetric_edges when symmetric, random_edges otherwise
+inline edge_list_t<> random_edges(uint32_t n, uint32_t m, bool symmetric, uint32_t seed) {
+  return symmetric ? random_symmetric_edges(n, m, seed) : random_edges(n, m, seed);
+}
+
+/// m random directed edges over [0, n) with integral weights in [min_weight, max_weight]
+template <class EV>
+edge_list_t<EV> random_weighted_edges(uint32_t n, uint32_t m, uint32_t min_weight, uint32_t max_weight, uint32_t seed) {
+  std::mt19937                            rng(seed);
+  std::uniform_int_distribution<uint32_t> pick(0, n - 1);
+  std::uniform_int_distribution<uint32_t> weight(min_weight, max_weight);
+  edge_list_t<EV>                         ee;
+  ee.reserve(m);
+  for (uint32_t i = 0; i < m; ++i) {
+    const uint32_t u = pick(rng), v = pick(rng);
+    ee.push_back({u, v, static_cast<EV>(weight(rng))});
+  }
+  sort_by_source(ee);
+  return ee;
+}
+
+/**
+ * @brief A graph of type G over edges sorted by source. A dynamic_graph gets at least n vertices;
+ *        a compressed_graph has as many as the largest id in ee needs.
+ */
+template <class G, class EE = edge_list_t<>>
+G make_graph(const EE& ee, size_t n = 0) {
+  if constexpr (is_compressed_graph_v<G>) {
+    return G(ee);
+  } else {
+    G g;
+    g.load_edges(ee, std::identity(), n);
+    return g;
+  }
+}
+
+} // namespace graph::test
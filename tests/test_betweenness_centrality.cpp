@@ -0,0 +1,284 @@
+/**
+ * @file test_betweenness_centrality.cpp
+ * @brief Tests for the parallel Brandes betweenness_centrality
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/betweenness_centrality.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_g   = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using csr_g   = compressed_graph<void, void, void, uint32_t, uint32_t>;
+using vov_int = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false>>;
+using csr_int = compressed_graph<int, void, void, uint32_t, uint32_t>;
+
+using edge_list     = edge_list_t<>;
+using int_edge_list = edge_list_t<int>;
+
+namespace {
+// Random edges without duplicates, in both directions when symmetric, sorted by source
+edge_list distinct_edges(uint32_t n, uint32_t m, bool symmetric, uint32_t seed) {
+  edge_list ee  = random_edges(n, m, symmetric, seed);
+  auto      key = [](auto& e) { return std::pair(e.source_id, e.target_id); };
+  std::ranges::sort(ee, {}, key);
+  auto dup = std::ranges::unique(ee, {}, key);
+  ee.erase(dup.begin(), dup.end());
+  return ee;
+}
+
+// Sum over the pairs s != v != t of the fraction of shortest s-t paths through v, from all-pairs BFS
+std::vector<double> reference_scores(const edge_list& ee, uint32_t n) {
+  std::vector<std::vector<uint32_t>> adj(n);
+  for (auto& e : ee)
+    adj[e.source_id].push_back(e.target_id);
+  std::vector<std::vector<int>>    dist(n, std::vector<int>(n, -1));
+  std::vector<std::vector<double>> sigma(n, std::vector<double>(n, 0.0));
+  for (uint32_t s = 0; s < n; ++s) {
+    std::deque<uint32_t> queue{s};
+    dist[s][s]  = 0;
+    sigma[s][s] = 1;
+    while (!queue.empty()) {
+      const uint32_t v = queue.front();
+      queue.pop_front();
+      for (uint32_t w : adj[v]) {
+        if (dist[s][w] < 0) {
+          dist[s][w] = dist[s][v] + 1;
+          queue.push_back(w);
+        }
+        if (dist[s][w] == dist[s][v] + 1)
+          sigma[s][w] += sigma[s][v];
+      }
+    }
+  }
+  std::vector<double> scores(n, 0.0);
+  for (uint32_t s = 0; s < n; ++s)
+    for (uint32_t t = 0; t < n; ++t)
+      for (uint32_t v = 0; v < n; ++v)
+        if (s != v && v != t && s != t && dist[s][t] > 0 && dist[s][v] > 0 && dist[v][t] > 0 &&
+            dist[s][v] + dist[v][t] == dist[s][t])
+          scores[v] += sigma[s][v] * sigma[v][t] / sigma[s][t];
+  return scores;
+}
+
+// The edges of distinct_edges with weights in [1, 4], the same both ways when symmetric, and a
+// heavier parallel copy of some of them
+int_edge_list weighted_distinct_edges(uint32_t n, uint32_t m, bool symmetric, uint32_t seed) {
+  std::mt19937                       rng(seed + 1);
+  std::uniform_int_distribution<int> weight(1, 4);
+  int_edge_list                      ee;
+  for (auto& e : distinct_edges(n, m, symmetric, seed))
+    if (!symmetric || e.source_id <= e.target_id) {
+      const int w = weight(rng);
+      ee.push_back({e.source_id, e.target_id, w});
+      if (symmetric && e.source_id != e.target_id)
+        ee.push_back({e.target_id, e.source_id, w});
+      if (ee.size() % 7 == 0)
+        ee.push_back({e.source_id, e.target_id, w + 1});
+    }
+  sort_by_source(ee);
+  return ee;
+}
+
+// reference_scores with weights: Floyd-Warshall distances, then path counts per source over the
+// vertices in increasing distance, counting parallel edges of the least weight separately
+std::vector<double> reference_weighted_scores(const int_edge_list& ee, uint32_t n) {
+  constexpr long                 none = std::numeric_limits<long>::max();
+  std::vector<std::vector<long>> dist(n, std::vector<long>(n, none));
+  for (uint32_t v = 0; v < n; ++v)
+    dist[v][v] = 0;
+  for (auto& e : ee)
+    dist[e.source_id][e.target_id] = std::min(dist[e.source_id][e.target_id], static_cast<long>(e.value));
+  for (uint32_t k = 0; k < n; ++k)
+    for (uint32_t i = 0; i < n; ++i)
+      for (uint32_t j = 0; j < n; ++j)
+        if (dist[i][k] != none && dist[k][j] != none)
+          dist[i][j] = std::min(dist[i][j], dist[i][k] + dist[k][j]);
+
+  std::vector<std::vector<double>> sigma(n, std::vector<double>(n, 0.0));
+  for (uint32_t s = 0; s < n; ++s) {
+    std::vector<uint32_t> order(n);
+    for (uint32_t v = 0; v < n; ++v)
+      order[v] = v;
+    std::ranges::sort(order, {}, [&](uint32_t v) { return dist[s][v]; });
+    sigma[s][s] = 1;
+    for (uint32_t v : order)
+      if (dist[s][v] != none)
+        for (auto& e : ee)
+          if (e.source_id == v && dist[s][v] + e.value == dist[s][e.target_id])
+            sigma[s][e.target_id] += sigma[s][v];
+  }
+
+  std::vector<double> scores(n, 0.0);
+  for (uint32_t s = 0; s < n; ++s)
+    for (uint32_t t = 0; t < n; ++t)
+      for (uint32_t v = 0; v < n; ++v)
+        if (s != v && v != t && s != t && dist[s][v] != none && dist[v][t] != none &&
+            dist[s][v] + dist[v][t] == dist[s][t])
+          scores[v] += sigma[s][v] * sigma[v][t] / sigma[s][t];
+  return scores;
+}
+
+bool close(const std::vector<double>& a, const std::vector<double>& b) {
+  if (a.size() != b.size())
+    return false;
+  for (size_t i = 0; i < a.size(); ++i)
+    if (std::abs(a[i] - b[i]) > 1e-9 * std::max(1.0, std::abs(b[i])))
+      return false;
+  return true;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("betweenness_centrality matches all-pairs path counts", "[algorithm][betweenness]", vov_g, csr_g) {
+  using G = TestType;
+
+  for (bool symmetric : {false, true}) {
+    const uint32_t  n  = 120;
+    const edge_list ee = distinct_edges(n, symmetric ? 200 : 360, symmetric, 17);
+    G               g  = make_graph<G>(ee, n);
+
+    const std::vector<double> expected = reference_scores(ee, n);
+    std::vector<double>       scores(n, -1.0);
+
+    betweenness_centrality(g, scores);
+    REQUIRE(close(scores, expected));
+
+    // Every vertex given explicitly is the exact case too
+    std::vector<uint32_t> all(n);
+    for (uint32_t v = 0; v < n; ++v)
+      all[v] = v;
+    betweenness_centrality(g, scores, all);
+    REQUIRE(close(scores, expected));
+
+    betweenness_centrality(g, scores, {.samples = n + 5});
+    REQUIRE(close(scores, expected));
+
+    std::vector<double> scaled = expected;
+    for (double& x : scaled)
+      x /= 2;
+    betweenness_centrality(g, scores, {.symmetric = true});
+    REQUIRE(close(scores, scaled));
+
+    for (double& x : scaled)
+      x = x * 2 / ((n - 1) * (n - 2));
+    betweenness_centrality(g, scores, {.normalize = true, .symmetric = symmetric});
+    REQUIRE(close(scores, scaled));
+  }
+}
+
+TEMPLATE_TEST_CASE("weighted betweenness_centrality matches all-pairs path counts",
+                   "[algorithm][betweenness]",
+                   vov_int,
+                   csr_int) {
+  using G = TestType;
+
+  for (bool symmetric : {false, true}) {
+    const uint32_t      n      = 90;
+    const int_edge_list ee     = weighted_distinct_edges(n, symmetric ? 150 : 270, symmetric, 17);
+    G                   g      = make_graph<G>(ee, n);
+    auto                weight = [&g](auto&& uv) { return edge_value(g, uv); };
+
+    const std::vector<double> expected = reference_weighted_scores(ee, n);
+    std::vector<double>       scores(n, -1.0);
+
+    betweenness_centrality(g, scores, weight);
+    REQUIRE(close(scores, expected));
+
+    std::vector<uint32_t> all(n);
+    for (uint32_t v = 0; v < n; ++v)
+      all[v] = v;
+    betweenness_centrality(g, scores, all, weight);
+    REQUIRE(close(scores, expected));
+
+    // Weights as double give the same paths
+    betweenness_centrality(g, scores, [&g](auto&& uv) { return 0.5 * edge_value(g, uv); });
+    REQUIRE(close(scores, expected));
+
+    // With unit weights it's the unweighted score
+    std::vector<double> unweighted(n);
+    betweenness_centrality(g, unweighted, {.normalize = true});
+    betweenness_centrality(g, scores, [](auto&&) { return 1; }, {.normalize = true});
+    REQUIRE(close(scores, unweighted));
+  }
+}
+
+TEST_CASE("betweenness_centrality from sampled sources", "[algorithm][betweenness]") {
+  const uint32_t  n  = 600;
+  const edge_list ee = distinct_edges(n, 2400, true, 4);
+  csr_g           g(ee);
+
+  std::vector<double> exact(n);
+  betweenness_centrality(g, exact);
+
+  // The same sample from the same seed
+  std::vector<double> a(n), b(n);
+  betweenness_centrality(g, a, {.samples = 150, .seed = 3});
+  betweenness_centrality(g, b, {.samples = 150, .seed = 3});
+  REQUIRE(close(a, b));
+
+  // The estimate of the total is close to the exact total
+  double total = 0, estimate = 0;
+  for (uint32_t v = 0; v < n; ++v) {
+    total += exact[v];
+    estimate += a[v];
+  }
+  REQUIRE(std::abs(estimate - total) < 0.1 * total);
+
+  // Explicit sources are scaled by n / size(sources)
+  std::vector<double> one(n);
+  betweenness_centrality(g, one, std::vector<int>{7});
+  std::vector<double> twice(n);
+  betweenness_centrality(g, twice, std::vector<int>{7, 7});
+  REQUIRE(close(one, twice));
+}
+
+TEST_CASE("betweenness_centrality on small graphs", "[algorithm][betweenness]") {
+  SECTION("undirected path and star") {
+    // Path 0 - 1 - 2 - 3, and a star with center 4 and leaves 5, 6, 7
+    csr_g g(edge_list{{0, 1}, {1, 0}, {1, 2}, {2, 1}, {2, 3}, {3, 2}, {4, 5}, {4, 6}, {4, 7}, {5, 4}, {6, 4}, {7, 4}});
+    std::vector<float> scores(8);
+    betweenness_centrality(g, scores, {.symmetric = true});
+    REQUIRE(scores == std::vector<float>{0, 2, 2, 0, 3, 0, 0, 0});
+  }
+
+  SECTION("two shortest paths share the dependency") {
+    // 0 -> {1,2} -> 3
+    vov_g g;
+    g.load_edges(edge_list{{0, 1}, {0, 2}, {1, 3}, {2, 3}}, std::identity(), 4);
+    std::vector<double> scores(4);
+    betweenness_centrality(g, scores);
+    REQUIRE(scores == std::vector<double>{0, 0.5, 0.5, 0});
+  }
+
+  SECTION("errors and empty inputs") {
+    csr_g               g(edge_list{{0, 1}, {1, 2}});
+    std::vector<double> scores(3);
+    REQUIRE_THROWS_AS(betweenness_centrality(g, std::vector<double>(2)), graph_error);
+    REQUIRE_THROWS_AS(betweenness_centrality(g, scores, std::vector<int>{3}), graph_error);
+    REQUIRE_THROWS_AS(betweenness_centrality(g, scores, std::vector<int>{-1}), graph_error);
+
+    betweenness_centrality(g, scores, std::vector<int>{});
+    REQUIRE(scores == std::vector<double>(3, 0.0));
+
+    csr_g               empty;
+    std::vector<double> none;
+    betweenness_centrality(empty, none);
+
+    // Weights must be positive
+    REQUIRE_THROWS_AS(betweenness_centrality(g, scores, [](auto&&) { return 0; }), graph_error);
+    REQUIRE_THROWS_AS(betweenness_centrality(g, scores, std::vector<int>{0}, [](auto&&) { return -1.0; }), graph_error);
+  }
+}
@@ -0,0 +1,146 @@
+/**
+ * @file test_bipartite_matching.cpp
+ * @brief Tests for maximum_bipartite_matching by parallel Hopcroft-Karp
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/algorithm/bipartite_matching.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using csr_g = compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<>;
+
+namespace {
+// Random edges from left [0, nl) to right [nl, nl + nr), sorted by source; in both directions
+// when symmetric
+edge_list random_bipartite(uint32_t nl, uint32_t nr, uint32_t m, bool symmetric, uint32_t seed) {
+  std::mt19937                            rng(seed);
+  std::uniform_int_distribution<uint32_t> left(0, nl - 1), right(nl, nl + nr - 1);
+  edge_list                               ee;
+  for (uint32_t i = 0; i < m; ++i) {
+    const uint32_t u = left(rng), v = right(rng);
+    ee.push_back({u, v});
+    if (symmetric)
+      ee.push_back({v, u});
+  }
+  ee.push_back({nl + nr - 1, nl + nr - 1}); // every right vertex exists, even without edges
+  sort_by_source(ee);
+  return ee;
+}
+
+csr_g make_bipartite(const edge_list& ee, uint32_t nl) {
+  return csr_g(ee, std::identity(), std::vector<uint32_t>{0, nl});
+}
+
+// Size of a maximum matching by Kuhn's augmenting paths, O(V E)
+size_t reference_matching(const edge_list& ee, uint32_t nl, uint32_t n) {
+  std::vector<std::vector<uint32_t>> adj(nl);
+  for (auto& e : ee)
+    if (e.source_id < nl && e.target_id >= nl)
+      adj[e.source_id].push_back(e.target_id);
+  std::vector<uint32_t> mate(n, n);
+  std::vector<bool>     seen;
+  auto                  augment = [&](auto&& self, uint32_t u) -> bool {
+    for (uint32_t v : adj[u]) {
+      if (seen[v])
+        continue;
+      seen[v] = true;
+      if (mate[v] == n || self(self, mate[v])) {
+        mate[v] = u;
+        return true;
+      }
+    }
+    return false;
+  };
+  size_t size = 0;
+  for (uint32_t u = 0; u < nl; ++u) {
+    seen.assign(n, false);
+    size += augment(augment, u);
+  }
+  return size;
+}
+
+// The mates are symmetric, pair left with right vertices along edges, and count the pairs
+size_t check_matching(const edge_list& ee, uint32_t nl, const std::vector<uint32_t>& mates) {
+  std::set<std::pair<uint32_t, uint32_t>> edges;
+  for (auto& e : ee)
+    edges.insert({e.source_id, e.target_id});
+  size_t pairs = 0;
+  for (uint32_t v = 0; v < mates.size(); ++v) {
+    const uint32_t w = mates[v];
+    REQUIRE(mates.at(w) == v);
+    if (w == v || v >= nl)
+      continue;
+    REQUIRE(w >= nl);
+    REQUIRE(edges.contains({v, w}));
+    ++pairs;
+  }
+  return pairs;
+}
+} // namespace
+
+TEST_CASE("maximum_bipartite_matching matches augmenting paths", "[algorithm][bipartite_matching]") {
+  struct shape {
+    uint32_t nl, nr, m;
+  };
+  for (auto [nl, nr, m] : {shape{2000, 2000, 2500}, shape{2000, 2000, 6000}, shape{1500, 3000, 5000},
+                           shape{3000, 1000, 9000}, shape{2000, 2000, 40000}})
+    for (bool symmetric : {false, true}) {
+      const edge_list ee = random_bipartite(nl, nr, m, symmetric, nl + m);
+      csr_g           g  = make_bipartite(ee, nl);
+      REQUIRE(num_partitions(g) == 2);
+
+      std::vector<uint32_t> mates(nl + nr);
+      const size_t          matched = maximum_bipartite_matching(g, mates);
+      REQUIRE(matched == reference_matching(ee, nl, nl + nr));
+      REQUIRE(check_matching(ee, nl, mates) == matched);
+    }
+}
+
+TEST_CASE("maximum_bipartite_matching on small graphs", "[algorithm][bipartite_matching]") {
+  SECTION("two right vertices for three left ones, and a perfect matching") {
+    // 0-3, 0-4, 1-3, 2-4, and a left-left edge 1-2 that's ignored
+    const edge_list       ee{{0, 3}, {0, 4}, {1, 2}, {1, 3}, {2, 4}};
+    csr_g                 g(ee, std::identity(), std::vector<uint32_t>{0, 3});
+    std::vector<uint32_t> mates(5);
+    REQUIRE(maximum_bipartite_matching(g, mates) == 2);
+
+    // 0-{3,4}, 1-{3}, 2-{4,5} has one perfect matching
+    csr_g            h(edge_list{{0, 3}, {0, 4}, {1, 3}, {2, 4}, {2, 5}}, std::identity(), std::vector<uint32_t>{0, 3});
+    std::vector<int> perfect(6);
+    REQUIRE(maximum_bipartite_matching(h, perfect) == 3);
+    REQUIRE(perfect == std::vector<int>{4, 3, 5, 1, 0, 2});
+  }
+
+  SECTION("unmatched vertices are their own mates") {
+    // Left 0..2 all only see right vertex 3; 4 has no edges
+    csr_g            g(edge_list{{0, 3}, {1, 3}, {2, 3}, {4, 4}}, std::identity(), std::vector<uint32_t>{0, 3});
+    std::vector<int> mates(5, -1);
+    REQUIRE(maximum_bipartite_matching(g, mates) == 1);
+    REQUIRE(std::ranges::count(mates, 3) == 1);
+    REQUIRE(mates[4] == 4);
+  }
+
+  SECTION("errors and an empty graph") {
+    csr_g            empty;
+    std::vector<int> none;
+    REQUIRE(maximum_bipartite_matching(empty, none) == 0);
+
+    csr_g            one_partition(edge_list{{0, 1}});
+    std::vector<int> two(2), one(1);
+    REQUIRE_THROWS_AS(maximum_bipartite_matching(one_partition, two), graph_error);
+    csr_g            g(edge_list{{0, 1}}, std::identity(), std::vector<uint32_t>{0, 1});
+    REQUIRE_THROWS_AS(maximum_bipartite_matching(g, one), graph_error);
+    REQUIRE(maximum_bipartite_matching(g, two) == 1);
+  }
+}
@@ -0,0 +1,148 @@
+/**
+ * @file test_breadth_first_search.cpp
+ * @brief Tests for the direction-optimizing breadth_first_search
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/breadth_first_search.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vov_bidirectional_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/property_map.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <span>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_g   = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using bidir_g = dynamic_graph<void, void, void, uint32_t, false,
+                              vov_bidirectional_graph_traits<void, void, void, uint32_t, false>>;
+using csr_g   = compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+constexpr uint32_t no_parent = std::numeric_limits<uint32_t>::max();
+
+namespace {
+template <class G>
+std::vector<int> reference_levels(G& g, uint32_t seed) {
+  std::vector<int>     level(num_vertices(g), -1);
+  std::queue<uint32_t> q;
+  level[seed] = 0;
+  q.push(seed);
+  while (!q.empty()) {
+    uint32_t uid = q.front();
+    q.pop();
+    for (auto uv : edges(g, *find_vertex(g, uid))) {
+      auto vid = static_cast<uint32_t>(target_id(g, uv));
+      if (level[vid] < 0) {
+        level[vid] = level[uid] + 1;
+        q.push(vid);
+      }
+    }
+  }
+  return level;
+}
+
+// Each reached vertex's parent is one level closer and has an edge to it
+template <class G>
+void require_valid_tree(G& g, uint32_t seed, const std::vector<uint32_t>& parents, const std::vector<int>& expected) {
+  for (uint32_t vid = 0; vid < parents.size(); ++vid) {
+    if (expected[vid] < 0) {
+      REQUIRE(parents[vid] == no_parent);
+    } else if (vid == seed) {
+      REQUIRE(parents[vid] == seed);
+    } else {
+      const uint32_t uid = parents[vid];
+      REQUIRE(uid < parents.size());
+      REQUIRE(expected[uid] == expected[vid] - 1);
+      REQUIRE(contains_edge(g, uid, vid));
+    }
+  }
+}
+} // namespace
+
+TEST_CASE("breadth_first_search on a small graph", "[algorithm][bfs]") {
+  //  0 -> 1 -> 2 -> 3,  0 -> 4 -> 3,  5 -> 0 (5 isn't reached)
+  vov_g g = make_graph<vov_g>({{0, 1}, {0, 4}, {1, 2}, {2, 3}, {4, 3}, {5, 0}});
+
+  std::vector<uint32_t> parents(num_vertices(g), no_parent);
+  REQUIRE(breadth_first_search(g, uint32_t(0), parents) == 5);
+  REQUIRE(parents == std::vector<uint32_t>{0, 0, 1, 4, 0, no_parent});
+
+  std::vector<int> levels(num_vertices(g), -1);
+  REQUIRE(breadth_first_search_levels(g, uint32_t(0), levels) == 5);
+  REQUIRE(levels == std::vector<int>{0, 1, 2, 2, 1, -1});
+
+  REQUIRE(breadth_first_search_levels(g, uint32_t(3), levels) == 1);
+  REQUIRE(levels[3] == 0);
+}
+
+TEMPLATE_TEST_CASE("breadth_first_search matches a sequential BFS", "[algorithm][bfs]", vov_g, bidir_g, csr_g) {
+  using G = TestType;
+
+  for (bool symmetric : {false, true}) {
+    G              g    = make_graph<G>(random_edges(5000, symmetric ? 20000 : 40000, symmetric, 42));
+    const uint32_t seed = 17;
+    auto           expected = reference_levels(g, seed);
+    const size_t   reached  = static_cast<size_t>(std::ranges::count_if(expected, [](int l) { return l >= 0; }));
+
+    // Default heuristics, always bottom-up when possible, and top-down only
+    for (bfs_options opt : {bfs_options{.symmetric = symmetric}, bfs_options{.alpha = 1e9, .beta = 1e-9, .symmetric = symmetric},
+                            bfs_options{.direction_optimizing = false}}) {
+      std::vector<int> levels(num_vertices(g), -1);
+      REQUIRE(breadth_first_search_levels(g, seed, levels, opt) == reached);
+      REQUIRE(levels == expected);
+
+      std::vector<uint32_t> parents(num_vertices(g), no_parent);
+      REQUIRE(breadth_first_search(g, seed, parents, opt) == reached);
+      require_valid_tree(g, seed, parents, expected);
+    }
+  }
+}
+
+TEST_CASE("breadth_first_search bottom-up over the in-edges of a compressed_graph", "[algorithm][bfs]") {
+  csr_g g = make_graph<csr_g>(random_edges(5000, 40000, 42));
+  g.build_in_edges();
+  const uint32_t seed     = 3;
+  auto           expected = reference_levels(g, seed);
+
+  for (bfs_options opt : {bfs_options{}, bfs_options{.alpha = 1e9, .beta = 1e-9}}) {
+    std::vector<int> levels(num_vertices(g), -1);
+    breadth_first_search_levels(g, seed, levels, opt);
+    REQUIRE(levels == expected);
+
+    std::vector<uint32_t> parents(num_vertices(g), no_parent);
+    breadth_first_search(g, seed, parents, opt);
+    require_valid_tree(g, seed, parents, expected);
+  }
+}
+
+TEST_CASE("breadth_first_search writes into caller buffers", "[algorithm][bfs]") {
+  vov_g g = make_graph<vov_g>(random_symmetric_edges(300, 600, 42));
+
+  vertex_property_map<vov_g, uint32_t> parents(g, no_parent);
+  REQUIRE(breadth_first_search(g, uint32_t(0), parents, {.symmetric = true}) > 1);
+  REQUIRE(parents[uint32_t(0)] == 0);
+
+  // A larger buffer is fine, only the first num_vertices(g) elements are used
+  std::vector<short> levels(num_vertices(g) + 10, short(-1));
+  breadth_first_search_levels(g, uint32_t(0), std::span(levels));
+  REQUIRE(levels[0] == 0);
+  REQUIRE(std::ranges::all_of(levels.begin() + 300, levels.end(), [](short l) { return l == -1; }));
+}
+
+TEST_CASE("breadth_first_search argument errors", "[algorithm][bfs]") {
+  vov_g                 g = make_graph<vov_g>({{0, 1}, {1, 2}});
+  std::vector<uint32_t> parents(3, no_parent);
+  std::vector<uint32_t> small(2, no_parent);
+  REQUIRE_THROWS_AS(breadth_first_search(g, uint32_t(3), parents), graph_error);
+  REQUIRE_THROWS_AS(breadth_first_search(g, uint32_t(0), small), graph_error);
+  REQUIRE(std::ranges::all_of(small, [](uint32_t p) { return p == no_parent; }));
+}
@@ -4102,3 +4102,64 @@ TEST_CASE("vertices(g, pid) returns vertex_descriptor_view", "[vertices_pid][api
     // Verify it's a vertex_descriptor_view
     STATIC_REQUIRE(is_vertex_descriptor_view_v<decltype(verts)>);
 }
+
+// =============================================================================
+// in_edges(g,u) and in_degree(g,u) CPO Tests
+// =============================================================================
+
+TEST_CASE("in_edges(g,u) throws until build_in_edges()", "[in_edges][api]") {
+    using Graph = compressed_graph<int, void, void, uint32_t, uint32_t>;
+    vector<copyable_edge_t<uint32_t, int>> ee = {
+        {0, 1, 10}, {0, 2, 20}, {1, 2, 30}, {3, 2, 40}, {3, 0, 50}
+    };
+    Graph g(ee);
+
+    REQUIRE_FALSE(g.has_in_edges());
+    for (auto u : vertices(g)) {
+        REQUIRE_THROWS_AS(in_edges(g, u), graph_error);
+        REQUIRE_THROWS_AS(in_degree(g, u), graph_error);
+    }
+    REQUIRE_THROWS_AS(in_edges(g, 1u), graph_error);
+
+    g.build_in_edges();
+    REQUIRE(g.has_in_edges());
+
+    SECTION("source ids in increasing order") {
+        auto to_vector = [](auto&& r) { return vector<uint32_t>(std::ranges::begin(r), std::ranges::end(r)); };
+        REQUIRE(to_vector(in_edges(g, *find_vertex(g, 0u))) == vector<uint32_t>{3});
+        REQUIRE(to_vector(in_edges(g, 1u)) == vector<uint32_t>{0});
+        REQUIRE(to_vector(in_edges(g, 2u)) == vector<uint32_t>{0, 1, 3});
+        REQUIRE(std::ranges::empty(in_edges(g, 3u)));
+    }
+
+    SECTION("in_degree") {
+        REQUIRE(in_degree(g, *find_vertex(g, 0u)) == 1);
+        REQUIRE(in_degree(g, 2u) == 3);
+        REQUIRE(in_degree(g, 3u) == 0);
+    }
+
+    SECTION("in-degrees sum to the number of edges") {
+        size_t total = 0;
+        for (auto u : vertices(g))
+            total += in_degree(g, u);
+        REQUIRE(total == num_edges(g));
+    }
+
+    SECTION("cleared by clear()") {
+        g.clear();
+        REQUIRE_FALSE(g.has_in_edges());
+        REQUIRE_THROWS_AS(in_edges(g, 0u), graph_error);
+    }
+}
+
+TEST_CASE("in_edges(g,u) on a const graph", "[in_edges][api]") {
+    using Graph = compressed_graph<void, void, void, uint32_t, uint32_t>;
+    vector<copyable_edge_t<uint32_t, void>> ee = {{0, 1}, {1, 1}, {2, 1}};
+    Graph g(ee);
+    g.build_in_edges();
+
+    const Graph& cg = g;
+    REQUIRE(in_degree(cg, 1u) == 3);
+    REQUIRE(std::ranges::equal(in_edges(cg, 1u), vector<uint32_t>{0, 1, 2}));
+    REQUIRE(std::ranges::empty(in_edges(cg, 7u)));
+}
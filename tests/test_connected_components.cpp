@@ -0,0 +1,154 @@
+/**
+ * @file test_connected_components.cpp
+ * @brief Tests for union_find and the Afforest connected_components
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/connected_components.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vov_bidirectional_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_g   = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using bidir_g = dynamic_graph<void, void, void, uint32_t, false,
+                              vov_bidirectional_graph_traits<void, void, void, uint32_t, false>>;
+using csr_g   = compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<>;
+
+namespace {
+// A giant component of random edges over [0, n/2), then paths in both directions over the rest; both directions when symmetric
+edge_list component_edges(uint32_t n, bool symmetric, uint32_t seed) {
+  edge_list    ee = random_edges(n / 2, 2 * n, symmetric, seed);
+  std::mt19937 rng(seed + 1);
+  auto         add = [&](uint32_t u, uint32_t v) {
+    ee.push_back({u, v});
+    if (symmetric)
+      ee.push_back({v, u});
+  };
+  for (uint32_t u = n / 2; u + 1 < n; ++u) {
+    if (rng() % 4 == 0)
+      continue;
+    if (rng() % 2)
+      add(u, u + 1);
+    else
+      add(u + 1, u);
+  }
+  add(n - 1, n - 1);
+  sort_by_source(ee);
+  return ee;
+}
+
+// Least vertex id of each weakly connected component, by sequential union-find
+std::vector<uint32_t> reference_labels(const edge_list& ee, uint32_t n) {
+  std::vector<uint32_t> parent(n);
+  for (uint32_t i = 0; i < n; ++i)
+    parent[i] = i;
+  auto find = [&](uint32_t x) {
+    while (parent[x] != x)
+      x = parent[x];
+    return x;
+  };
+  for (auto& e : ee) {
+    uint32_t a = find(e.source_id), b = find(e.target_id);
+    if (a != b)
+      parent[std::max(a, b)] = std::min(a, b);
+  }
+  for (uint32_t i = 0; i < n; ++i)
+    parent[i] = find(i);
+  return parent;
+}
+} // namespace
+
+TEST_CASE("union_find", "[algorithm][connected_components][union_find]") {
+  graph::detail::union_find<uint32_t> sets(10);
+  REQUIRE(sets.count() == 10);
+  REQUIRE(sets.unite(7, 3));
+  REQUIRE(sets.unite(3, 9));
+  REQUIRE_FALSE(sets.unite(9, 7));
+  REQUIRE(sets.unite(5, 8));
+  REQUIRE(sets.find(9) == 3);
+  REQUIRE(sets.same(7, 9));
+  REQUIRE_FALSE(sets.same(7, 8));
+  REQUIRE(sets.count() == 7);
+  sets.compress();
+  REQUIRE(sets.parent(9) == 3);
+  REQUIRE(sets.parent(8) == 5);
+
+  sets.reset(4);
+  REQUIRE(sets.count() == 4);
+  REQUIRE(sets.find(3) == 3);
+}
+
+TEST_CASE("union_find concurrent_unite", "[algorithm][connected_components][union_find]") {
+  const uint32_t                      n = 20000;
+  graph::detail::union_find<uint32_t> sets(n);
+
+  // Several threads join i with i+2, making the even and the odd ids two sets
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < 4; ++t)
+    threads.emplace_back([&sets, t] {
+      for (uint32_t i = t; i + 2 < n; i += 4)
+        sets.concurrent_unite(n - 3 - i, n - 1 - i);
+    });
+  for (auto& th : threads)
+    th.join();
+  REQUIRE(sets.concurrent_find(n - 1) == 1);
+  sets.compress();
+  REQUIRE(sets.count() == 2);
+  for (uint32_t i = 0; i < n; ++i)
+    REQUIRE(sets.parent(i) == i % 2);
+}
+
+TEMPLATE_TEST_CASE("connected_components matches union-find", "[algorithm][connected_components]", vov_g, bidir_g, csr_g) {
+  using G            = TestType;
+  const uint32_t n   = 20000;
+  const bool     sym = GENERATE(false, true);
+  const edge_list ee = component_edges(n, sym, 5);
+  G               g  = make_graph<G>(ee, n);
+  REQUIRE(num_vertices(g) == n);
+
+  const auto   expected = reference_labels(ee, n);
+  const size_t count    = static_cast<size_t>(std::ranges::count_if(std::views::iota(0u, n), [&](uint32_t i) { return expected[i] == i; }));
+
+  auto check = [&] {
+    for (connected_components_options opt : {connected_components_options{}, connected_components_options{.neighbor_rounds = 0},
+                                             connected_components_options{.neighbor_rounds = 5, .samples = 16},
+                                             connected_components_options{.symmetric = sym}}) {
+      std::vector<uint32_t> labels(n, 7);
+      REQUIRE(connected_components(g, labels, opt) == count);
+      REQUIRE(labels == expected);
+    }
+  };
+  check();
+
+  // Again with the in-edges of a compressed_graph, so the largest component can be skipped
+  if constexpr (std::is_same_v<G, csr_g>) {
+    g.build_in_edges();
+    check();
+  }
+}
+
+TEST_CASE("connected_components small graphs", "[algorithm][connected_components]") {
+  std::vector<int> labels(8);
+  REQUIRE(connected_components(csr_g(), labels) == 0);
+
+  // 0 <- 1, 2 -> 3 -> 4, 5 and 6 isolated, 7 only has a self loop
+  csr_g g(edge_list{{1, 0}, {2, 3}, {3, 4}, {7, 7}});
+  REQUIRE(connected_components(g, labels) == 5);
+  REQUIRE(labels == std::vector<int>{0, 0, 2, 2, 2, 5, 6, 7});
+
+  std::vector<int> small(3);
+  REQUIRE_THROWS_AS(connected_components(g, small), graph_error);
+}
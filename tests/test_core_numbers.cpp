@@ -0,0 +1,128 @@
+/**
+ * @file test_core_numbers.cpp
+ * @brief Tests for the sequential and parallel core_numbers
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/core_numbers.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_g = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using csr_g = compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<>;
+
+namespace {
+// Random undirected edges in both directions, with a dense cluster over [0, 40) so the cores are
+// deep, sorted by source
+edge_list clustered_edges(uint32_t n, uint32_t m, uint32_t seed) {
+  edge_list ee = random_symmetric_edges(n, m, seed);
+  std::ranges::copy(random_symmetric_edges(40, 400, seed + 1), std::back_inserter(ee));
+  sort_by_source(ee);
+  return ee;
+}
+
+// Core numbers by repeatedly removing a vertex of least degree, in O(V^2)
+std::vector<size_t> reference_cores(const edge_list& ee, uint32_t n) {
+  std::vector<size_t> degree(n, 0);
+  for (auto& e : ee)
+    degree[e.source_id] += e.source_id != e.target_id;
+  std::vector<std::vector<uint32_t>> adj(n);
+  for (auto& e : ee)
+    adj[e.source_id].push_back(e.target_id);
+  std::vector<bool>   removed(n, false);
+  std::vector<size_t> core(n, 0);
+  size_t              k = 0;
+  for (uint32_t step = 0; step < n; ++step) {
+    uint32_t v = n;
+    for (uint32_t u = 0; u < n; ++u)
+      if (!removed[u] && (v == n || degree[u] < degree[v]))
+        v = u;
+    k          = std::max(k, degree[v]);
+    core[v]    = k;
+    removed[v] = true;
+    for (uint32_t u : adj[v])
+      if (!removed[u])
+        --degree[u];
+  }
+  return core;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("core_numbers matches repeated min-degree removal", "[algorithm][core_numbers]", vov_g, csr_g) {
+  using G = TestType;
+
+  const uint32_t  n  = 3000;
+  const edge_list ee = clustered_edges(n, 9000, 21);
+  G               g  = make_graph<G>(ee, n);
+
+  const std::vector<size_t> expected   = reference_cores(ee, n);
+  const size_t              degeneracy = *std::ranges::max_element(expected);
+  REQUIRE(degeneracy >= 10);
+
+  for (bool parallel : {false, true}) {
+    std::vector<uint32_t> cores(n, 99), order(n);
+    REQUIRE(core_numbers(g, cores, order, {.parallel = parallel}) == degeneracy);
+    REQUIRE(std::ranges::equal(cores, expected));
+
+    // A degeneracy ordering: a permutation where each vertex has at most its core number of
+    // neighbors after it
+    std::vector<uint32_t> position(n, n);
+    for (uint32_t i = 0; i < n; ++i)
+      position.at(order[i]) = i;
+    REQUIRE(std::ranges::find(position, n) == position.end());
+    std::vector<size_t> later(n, 0);
+    for (auto& e : ee)
+      later[e.source_id] += position[e.target_id] > position[e.source_id];
+    for (uint32_t v = 0; v < n; ++v)
+      REQUIRE(later[v] <= cores[v]);
+
+    std::vector<int> only_cores(n);
+    REQUIRE(core_numbers(g, only_cores, {.parallel = parallel}) == degeneracy);
+    REQUIRE(std::ranges::equal(only_cores, expected));
+  }
+}
+
+TEST_CASE("core_numbers on small graphs", "[algorithm][core_numbers]") {
+  SECTION("a triangle with a tail, a self-loop and an isolated vertex") {
+    // Triangle 0-1-2, tail 2-3-4, self-loop on 4, 5 isolated
+    csr_g g(edge_list{{0, 1}, {0, 2}, {1, 0}, {1, 2}, {2, 0}, {2, 1}, {2, 3}, {3, 2}, {3, 4}, {4, 3}, {4, 4}});
+    std::vector<int> cores(6);
+    for (bool parallel : {false, true}) {
+      REQUIRE(core_numbers(g, cores, {.parallel = parallel}) == 2);
+      REQUIRE(cores == std::vector<int>{2, 2, 2, 1, 1, 0});
+    }
+  }
+
+  SECTION("parallel batches are sorted by id") {
+    // A path 0-1-2-3: 0 and 3 are peeled first, then 1 and 2
+    vov_g g;
+    g.load_edges(edge_list{{0, 1}, {1, 0}, {1, 2}, {2, 1}, {2, 3}, {3, 2}}, std::identity(), 4);
+    std::vector<int> cores(4), order(4);
+    core_numbers(g, cores, order, {.parallel = true});
+    REQUIRE(order == std::vector<int>{0, 3, 1, 2});
+  }
+
+  SECTION("empty graph and too small outputs") {
+    csr_g            empty;
+    std::vector<int> none;
+    REQUIRE(core_numbers(empty, none) == 0);
+    REQUIRE(core_numbers(empty, none, none, {.parallel = true}) == 0);
+
+    csr_g            g(edge_list{{0, 1}, {1, 0}});
+    std::vector<int> two(2), one(1);
+    REQUIRE_THROWS_AS(core_numbers(g, one), graph_error);
+    REQUIRE_THROWS_AS(core_numbers(g, two, one), graph_error);
+  }
+}
@@ -0,0 +1,115 @@
+/**
+ * @file test_delta_stepping_shortest_paths.cpp
+ * @brief Tests for the parallel delta_stepping_shortest_paths
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/delta_stepping_shortest_paths.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_double = dynamic_graph<double, void, void, uint32_t, false, vov_graph_traits<double, void, void, uint32_t, false>>;
+using csr_double = compressed_graph<double, void, void, uint32_t, uint32_t>;
+using csr_uint   = compressed_graph<uint32_t, void, void, uint32_t, uint32_t>;
+
+namespace {
+// Random edges sorted by source, then by weight, so each row is in weight order
+template <class EV>
+edge_list_t<EV> weight_ordered_edges(uint32_t n, uint32_t m, uint32_t max_weight, uint32_t seed) {
+  auto ee = random_weighted_edges<EV>(n, m, 0, max_weight, seed);
+  std::ranges::sort(ee, [](auto& a, auto& b) { return std::tie(a.source_id, a.value) < std::tie(b.source_id, b.value); });
+  return ee;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("delta_stepping_shortest_paths matches Dijkstra", "[algorithm][delta_stepping]", vov_double, csr_double,
+                   csr_uint) {
+  using G  = TestType;
+  using EV = std::remove_cvref_t<decltype(edge_value(std::declval<G&>(), std::declval<edge_t<G>>()))>;
+  using D  = std::conditional_t<std::is_floating_point_v<EV>, double, uint64_t>;
+
+  G              g    = make_graph<G>(weight_ordered_edges<EV>(3000, 15000, 1000, 11));
+  const uint32_t seed = 1;
+
+  std::vector<D>        expected(num_vertices(g));
+  std::vector<uint32_t> pred(num_vertices(g));
+  dijkstra_shortest_paths(g, seed, expected, pred);
+
+  for (delta_stepping_options opt : {delta_stepping_options{}, delta_stepping_options{.delta = 1},
+                                     delta_stepping_options{.delta = 37.5}, delta_stepping_options{.delta = 1e12},
+                                     delta_stepping_options{.delta = 100, .edges_sorted_by_weight = true}}) {
+    std::vector<D> dist(num_vertices(g), D{7});
+    delta_stepping_shortest_paths(g, seed, dist, opt);
+    REQUIRE(dist == expected);
+  }
+}
+
+TEST_CASE("delta_stepping_shortest_paths with a weight function", "[algorithm][delta_stepping]") {
+  //  0 -> 1 -> 2 -> 3 with weight 2 each, 0 -> 3 with weight 5, 4 isolated
+  csr_uint g(edge_list_t<uint32_t>{{0, 1, 2}, {0, 3, 5}, {1, 2, 2}, {2, 3, 2}, {4, 4, 0}});
+
+  std::vector<int> dist(num_vertices(g));
+  delta_stepping_shortest_paths(g, uint32_t(0), dist);
+  REQUIRE(dist == std::vector<int>{0, 2, 4, 5, shortest_path_infinite_distance<int>()});
+
+  delta_stepping_shortest_paths(g, uint32_t(0), dist, [](const auto&) { return 1; });
+  REQUIRE(dist == std::vector<int>{0, 1, 2, 1, shortest_path_infinite_distance<int>()});
+
+  // Zero weights
+  delta_stepping_shortest_paths(g, uint32_t(0), dist, [](const auto&) { return 0; }, {.delta = 0.5});
+  REQUIRE(dist == std::vector<int>{0, 0, 0, 0, shortest_path_infinite_distance<int>()});
+
+  REQUIRE_THROWS_AS(delta_stepping_shortest_paths(g, uint32_t(0), dist, [](const auto&) { return -1; }), graph_error);
+  REQUIRE_THROWS_AS(delta_stepping_shortest_paths(g, uint32_t(5), dist), graph_error);
+  REQUIRE_THROWS_AS(delta_stepping_shortest_paths(g, uint32_t(0), dist, {.delta = -1}), graph_error);
+}
+
+TEST_CASE("delta_stepping_shortest_paths on a long path", "[algorithm][delta_stepping]") {
+  // Many buckets, each with a single vertex
+  edge_list_t<double> ee;
+  for (uint32_t i = 0; i + 1 < 5000; ++i)
+    ee.push_back({i, i + 1, 0.75});
+  csr_double g(ee);
+
+  std::vector<double> dist(num_vertices(g));
+  delta_stepping_shortest_paths(g, uint32_t(0), dist);
+  for (uint32_t i = 0; i < 5000; ++i)
+    REQUIRE(dist[i] == 0.75 * i);
+}
+
+TEST_CASE("delta_stepping_shortest_paths with a small delta", "[algorithm][delta_stepping]") {
+  // Far more buckets than the window holds, so most vertices go through the overflow lists
+  csr_double     g    = make_graph<csr_double>(weight_ordered_edges<double>(2000, 10000, 100000, 3));
+  const uint32_t seed = 0;
+
+  std::vector<double>   expected(num_vertices(g));
+  std::vector<uint32_t> pred(num_vertices(g));
+  dijkstra_shortest_paths(g, seed, expected, pred);
+
+  for (double delta : {0.5, 7.0, 1000.0}) {
+    std::vector<double> dist(num_vertices(g));
+    delta_stepping_shortest_paths(g, seed, dist, {.delta = delta});
+    REQUIRE(dist == expected);
+  }
+
+  // A path with a bucket of its own for every vertex, 400 buckets apart
+  edge_list_t<double> ee;
+  for (uint32_t i = 0; i + 1 < 1000; ++i)
+    ee.push_back({i, i + 1, 100.0});
+  csr_double          path(ee);
+  std::vector<double> dist(num_vertices(path));
+  delta_stepping_shortest_paths(path, uint32_t(0), dist, {.delta = 0.25});
+  for (uint32_t i = 0; i < 1000; ++i)
+    REQUIRE(dist[i] == 100.0 * i);
+}
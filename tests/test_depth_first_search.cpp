@@ -0,0 +1,151 @@
+/**
+ * @file test_depth_first_search.cpp
+ * @brief Tests for the non-recursive vertices_depth_first_search view
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/views/depth_first_search.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vol_graph_traits.hpp>
+#include <graph/container/traits/mos_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_g = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using vol_g = dynamic_graph<void, void, void, uint32_t, false, vol_graph_traits<void, void, void, uint32_t, false>>;
+using mos_ord = dynamic_graph<void, void, void, uint32_t, false, mos_graph_traits<void, void, void, uint32_t, false, true>>;
+using mos_plain = dynamic_graph<void, void, void, uint32_t, false, mos_graph_traits<void, void, void, uint32_t, false>>;
+using csr_g = compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<>;
+
+template <class G>
+concept dfs_searchable = requires(G& g, uint32_t seed) { views::vertices_depth_first_search(g, seed); };
+
+namespace {
+//  0 -> 1 -> 3
+//  0 -> 2 -> 3 -> 4,  4 -> 1 (back to an earlier vertex),  5 -> 0 (not reachable from 0)
+edge_list sample_edges() { return {{0, 1}, {0, 2}, {1, 3}, {2, 3}, {3, 4}, {4, 1}, {5, 0}}; }
+
+template <class G>
+struct recording_visitor {
+  std::vector<uint32_t> discovered;
+  std::vector<uint32_t> finished;
+  size_t                examined = 0;
+
+  void on_discover_vertex(const G& g, const vertex_t<const G>& u) { discovered.push_back(static_cast<uint32_t>(vertex_id(g, u))); }
+  void on_finish_vertex(const G& g, const vertex_t<const G>& u) { finished.push_back(static_cast<uint32_t>(vertex_id(g, u))); }
+  void on_examine_edge(const G&, const edge_t<const G>&) { ++examined; }
+};
+
+template <class R>
+std::vector<uint32_t> ids_of(R&& r) {
+  std::vector<uint32_t> ids;
+  for (auto&& [vid, u] : r)
+    ids.push_back(static_cast<uint32_t>(vid));
+  return ids;
+}
+} // namespace
+
+TEST_CASE("vertices_depth_first_search requires vertex ordinals", "[views][dfs]") {
+  STATIC_REQUIRE(dfs_searchable<vov_g>);
+  STATIC_REQUIRE(dfs_searchable<const vov_g>);
+  STATIC_REQUIRE(dfs_searchable<csr_g>);
+  STATIC_REQUIRE(dfs_searchable<mos_ord>);
+  STATIC_REQUIRE_FALSE(dfs_searchable<mos_plain>);
+  STATIC_REQUIRE(std::ranges::input_range<views::vertices_depth_first_search_view<vov_g>>);
+}
+
+TEMPLATE_TEST_CASE("vertices_depth_first_search order", "[views][dfs]", vov_g, vol_g, mos_ord, csr_g) {
+  using G       = TestType;
+  const G g     = make_graph<G>(sample_edges());
+
+  SECTION("discovery order") {
+    REQUIRE(ids_of(views::vertices_depth_first_search(g, uint32_t(0))) == std::vector<uint32_t>{0, 1, 3, 4, 2});
+    REQUIRE(ids_of(views::vertices_depth_first_search(g, uint32_t(2))) == std::vector<uint32_t>{2, 3, 4, 1});
+    REQUIRE(ids_of(views::vertices_depth_first_search(g, *find_vertex(g, uint32_t(5)))) ==
+            std::vector<uint32_t>{5, 0, 1, 3, 4, 2});
+  }
+
+  SECTION("seed outside the graph") {
+    REQUIRE_THROWS_AS(views::vertices_depth_first_search(g, uint32_t(6)), graph_error);
+    REQUIRE_THROWS_AS(views::vertices_depth_first_search(g, uint32_t(100)), graph_error);
+    auto dfs = views::vertices_depth_first_search(g, uint32_t(0));
+    REQUIRE_THROWS_AS(dfs.reset(uint32_t(6)), graph_error);
+    REQUIRE_THROWS_AS(dfs.resume(uint32_t(100)), graph_error);
+  }
+
+  SECTION("elements are the vertex descriptors") {
+    for (auto&& [vid, u] : views::vertices_depth_first_search(g, uint32_t(0)))
+      REQUIRE(vertex_id(g, u) == vid);
+  }
+
+  SECTION("visitor hooks") {
+    recording_visitor<G> vis;
+    auto                 dfs = views::vertices_depth_first_search(g, uint32_t(0), vis);
+    for (auto&& vi : dfs)
+      (void)vi;
+    REQUIRE(vis.discovered == std::vector<uint32_t>{0, 1, 3, 4, 2});
+    REQUIRE(vis.finished == std::vector<uint32_t>{4, 3, 1, 2, 0});
+    REQUIRE(vis.examined == 6);
+  }
+}
+
+TEST_CASE("vertices_depth_first_search reuses its state", "[views][dfs]") {
+  const vov_g g   = make_graph<vov_g>(sample_edges());
+  auto        dfs = views::vertices_depth_first_search(g, uint32_t(0));
+  REQUIRE(ids_of(dfs) == std::vector<uint32_t>{0, 1, 3, 4, 2});
+  REQUIRE(dfs.visited(uint32_t(4)));
+  REQUIRE_FALSE(dfs.visited(uint32_t(5)));
+
+  SECTION("reset forgets visited vertices") {
+    dfs.reset(uint32_t(3));
+    REQUIRE_FALSE(dfs.visited(uint32_t(0)));
+    REQUIRE(ids_of(dfs) == std::vector<uint32_t>{3, 4, 1});
+  }
+
+  SECTION("resume skips visited vertices") {
+    dfs.resume(uint32_t(5));
+    REQUIRE(ids_of(dfs) == std::vector<uint32_t>{5});
+    dfs.resume(uint32_t(3));
+    REQUIRE(ids_of(dfs).empty());
+  }
+
+  SECTION("the current path is the stack") {
+    std::vector<size_t> depths;
+    for (auto it = dfs.begin(); it != dfs.end(); ++it)
+      depths.push_back(dfs.depth());
+    REQUIRE(depths.empty());
+    dfs.reset(uint32_t(0));
+    for (auto it = dfs.begin(); it != dfs.end(); ++it)
+      depths.push_back(dfs.depth());
+    REQUIRE(depths == std::vector<size_t>{1, 2, 3, 4, 2});
+  }
+}
+
+TEST_CASE("vertices_depth_first_search handles deep graphs", "[views][dfs]") {
+  // A path this long would overflow the call stack of a recursive DFS in a debug build
+  const uint32_t n = 500000;
+  edge_list      ee;
+  for (uint32_t i = 0; i + 1 < n; ++i)
+    ee.push_back({i, i + 1});
+  vov_g g = make_graph<vov_g>(ee);
+
+  size_t count = 0, max_depth = 0;
+  auto   dfs   = views::vertices_depth_first_search(g, uint32_t(0));
+  for (auto&& [vid, u] : dfs) {
+    REQUIRE(vid == count);
+    ++count;
+    max_depth = std::max(max_depth, dfs.depth());
+  }
+  REQUIRE(count == n);
+  REQUIRE(max_depth == n);
+}
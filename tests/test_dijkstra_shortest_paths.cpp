@@ -0,0 +1,213 @@
+/**
+ * @file test_dijkstra_shortest_paths.cpp
+ * @brief Tests for dijkstra_shortest_paths and its priority queues
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <graph/property_map.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_double = dynamic_graph<double, void, void, uint32_t, false, vov_graph_traits<double, void, void, uint32_t, false>>;
+using vov_uint   = dynamic_graph<uint32_t, void, void, uint32_t, false, vov_graph_traits<uint32_t, void, void, uint32_t, false>>;
+using csr_double = compressed_graph<double, void, void, uint32_t, uint32_t>;
+using csr_uint   = compressed_graph<uint32_t, void, void, uint32_t, uint32_t>;
+
+namespace {
+// Only integral distances can use the radix heap
+template <class G, class Dist>
+concept radix_searchable = requires(G& g, Dist& dist, std::vector<uint32_t>& pred) {
+  dijkstra_shortest_paths<dijkstra_queue::radix_heap>(g, uint32_t(0), dist, pred);
+};
+
+// Bellman-Ford, as an independent check
+template <class D, class G>
+std::vector<D> reference_distances(G& g, uint32_t seed) {
+  std::vector<D> dist(num_vertices(g), shortest_path_infinite_distance<D>());
+  dist.at(seed) = 0;
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (auto u : vertices(g)) {
+      const auto uid = vertex_id(g, u);
+      if (dist[uid] == shortest_path_infinite_distance<D>())
+        continue;
+      for (auto uv : edges(g, u)) {
+        const auto vid = target_id(g, uv);
+        const D    dv  = static_cast<D>(dist[uid] + static_cast<D>(edge_value(g, uv)));
+        if (dv < dist[vid]) {
+          dist[vid] = dv;
+          changed   = true;
+        }
+      }
+    }
+  }
+  return dist;
+}
+
+// Each reached vertex other than the seed has a predecessor with an edge that makes up its distance
+template <class G, class D>
+void require_consistent_predecessors(G& g, uint32_t seed, const std::vector<D>& dist, const std::vector<uint32_t>& pred) {
+  for (uint32_t vid = 0; vid < dist.size(); ++vid) {
+    if (vid == seed || dist[vid] == shortest_path_infinite_distance<D>()) {
+      REQUIRE(pred[vid] == vid);
+      continue;
+    }
+    bool found = false;
+    for (auto uv : edges(g, *find_vertex(g, pred[vid])))
+      found |= target_id(g, uv) == vid && static_cast<D>(dist[pred[vid]] + static_cast<D>(edge_value(g, uv))) == dist[vid];
+    REQUIRE(found);
+  }
+}
+} // namespace
+
+TEST_CASE("indexed_dary_heap", "[algorithm][dijkstra][heap]") {
+  graph::detail::indexed_dary_heap<int, uint32_t> heap(100);
+  std::mt19937                                    rng(3);
+  std::vector<int>                                keys(100);
+  for (uint32_t i = 0; i < 100; ++i) {
+    keys[i] = static_cast<int>(rng() % 1000);
+    heap.push(i, keys[i]);
+  }
+  for (uint32_t i = 0; i < 100; i += 3) {
+    keys[i] -= 500;
+    heap.decrease(i, keys[i]);
+  }
+  REQUIRE_FALSE(heap.push_or_decrease(5, keys[5] + 1));
+  REQUIRE(heap.size() == 100);
+
+  std::vector<int> popped;
+  while (!heap.empty()) {
+    auto [k, id] = heap.pop();
+    REQUIRE(k == keys[id]);
+    REQUIRE_FALSE(heap.contains(id));
+    popped.push_back(k);
+  }
+  REQUIRE(std::ranges::is_sorted(popped));
+
+  heap.push(7, 1);
+  heap.push(9, 0);
+  heap.clear();
+  REQUIRE(heap.empty());
+  REQUIRE_FALSE(heap.contains(7));
+}
+
+TEST_CASE("radix_heap", "[algorithm][dijkstra][heap]") {
+  graph::detail::radix_heap<uint32_t, uint32_t> heap;
+  std::mt19937                                  rng(5);
+  std::vector<uint32_t>                         popped;
+  heap.push(0, 10);
+  while (!heap.empty()) {
+    auto [k, id] = heap.pop();
+    popped.push_back(k);
+    if (popped.size() < 2000)
+      for (int i = 0; i < 2; ++i)
+        heap.push(id + 1, k + static_cast<uint32_t>(rng() % 5000));
+  }
+  REQUIRE(std::ranges::is_sorted(popped));
+  REQUIRE(popped.front() == 10);
+}
+
+TEMPLATE_TEST_CASE("dijkstra_shortest_paths matches Bellman-Ford", "[algorithm][dijkstra]", vov_double, vov_uint, csr_double,
+                   csr_uint) {
+  using G  = TestType;
+  using EV = std::remove_cvref_t<decltype(edge_value(std::declval<G&>(), std::declval<edge_t<G>>()))>;
+  using D  = std::conditional_t<std::is_floating_point_v<EV>, double, uint64_t>;
+
+  G              g    = make_graph<G>(random_weighted_edges<EV>(2000, 10000, 0, 100, 7));
+  const uint32_t seed = 3;
+  const auto     expected = reference_distances<D>(g, seed);
+
+  std::vector<D>        dist(num_vertices(g));
+  std::vector<uint32_t> pred(num_vertices(g));
+  const size_t reachable = static_cast<size_t>(std::ranges::count_if(expected, [](D d) { return d != shortest_path_infinite_distance<D>(); }));
+
+  REQUIRE(dijkstra_shortest_paths(g, seed, dist, pred) == reachable);
+  REQUIRE(dist == expected);
+  require_consistent_predecessors(g, seed, dist, pred);
+
+  if constexpr (std::integral<D>) {
+    std::ranges::fill(dist, D{0});
+    REQUIRE(dijkstra_shortest_paths<dijkstra_queue::radix_heap>(g, seed, dist, pred) == reachable);
+    REQUIRE(dist == expected);
+    require_consistent_predecessors(g, seed, dist, pred);
+  } else {
+    STATIC_REQUIRE_FALSE(radix_searchable<G, std::vector<D>>);
+  }
+}
+
+TEST_CASE("dijkstra_shortest_paths with a weight function", "[algorithm][dijkstra]") {
+  //  0 -1-> 1 -1-> 2,  0 -5-> 2,  3 is not reachable
+  vov_uint g = make_graph<vov_uint>(edge_list_t<uint32_t>{{0, 1, 1}, {0, 2, 5}, {1, 2, 1}, {3, 0, 1}});
+
+  vertex_property_map<vov_uint, int>      dist(g, 0);
+  vertex_property_map<vov_uint, uint32_t> pred(g, 0);
+
+  SECTION("edge values") {
+    REQUIRE(dijkstra_shortest_paths(g, uint32_t(0), dist, pred) == 3);
+    REQUIRE(dist[uint32_t(2)] == 2);
+    REQUIRE(pred[uint32_t(2)] == 1);
+    REQUIRE(dist[uint32_t(3)] == shortest_path_infinite_distance<int>());
+    REQUIRE(pred[uint32_t(3)] == 3);
+  }
+
+  SECTION("hop count") {
+    dijkstra_shortest_paths(g, uint32_t(0), dist, pred, [](const auto&) { return 1; });
+    REQUIRE(dist[uint32_t(2)] == 1);
+    REQUIRE(pred[uint32_t(2)] == 0);
+  }
+
+  SECTION("negative weights are rejected") {
+    REQUIRE_THROWS_AS(dijkstra_shortest_paths(g, uint32_t(0), dist, pred, [&g](const auto& uv) { return 1 - static_cast<int>(edge_value(g, uv)); }),
+                      graph_error);
+  }
+
+  SECTION("argument errors") {
+    std::vector<int> small(2);
+    REQUIRE_THROWS_AS(dijkstra_shortest_paths(g, uint32_t(9), dist, pred), graph_error);
+    REQUIRE_THROWS_AS(dijkstra_shortest_paths(g, uint32_t(0), small, pred), graph_error);
+  }
+}
+
+TEST_CASE("dijkstra_shortest_paths stops at the target", "[algorithm][dijkstra]") {
+  // A long path 0 -> 1 -> ... -> 999
+  edge_list_t<double> ee;
+  for (uint32_t i = 0; i + 1 < 1000; ++i)
+    ee.push_back({i, i + 1, 1.0});
+  csr_double g = make_graph<csr_double>(ee);
+
+  std::vector<double>   dist(num_vertices(g));
+  std::vector<uint32_t> pred(num_vertices(g));
+  REQUIRE(dijkstra_shortest_paths(g, uint32_t(0), dist, pred, {.target = 10}) == 11);
+  REQUIRE(dist[10] == 10.0);
+  REQUIRE(dist[500] == shortest_path_infinite_distance<double>());
+
+  std::vector<uint32_t> idist(num_vertices(g));
+  REQUIRE(dijkstra_shortest_paths<dijkstra_queue::radix_heap>(g, uint32_t(0), idist, pred, {.target = 10}) == 11);
+  REQUIRE(idist[10] == 10);
+}
+
+TEST_CASE("dijkstra_shortest_paths saturates integral distances", "[algorithm][dijkstra]") {
+  //  0 -> 1 -> 2 with weights close to the range of uint8_t
+  vov_uint g = make_graph<vov_uint>(edge_list_t<uint32_t>{{0, 1, 200}, {1, 2, 100}, {0, 3, 50}});
+
+  std::vector<uint8_t>  dist(num_vertices(g));
+  std::vector<uint32_t> pred(num_vertices(g));
+  REQUIRE(dijkstra_shortest_paths(g, uint32_t(0), dist, pred) == 3);
+  REQUIRE(dist == std::vector<uint8_t>{0, 200, shortest_path_infinite_distance<uint8_t>(), 50});
+  REQUIRE(pred[2] == 2);
+
+  std::ranges::fill(dist, uint8_t{0});
+  REQUIRE(dijkstra_shortest_paths<dijkstra_queue::radix_heap>(g, uint32_t(0), dist, pred) == 3);
+  REQUIRE(dist == std::vector<uint8_t>{0, 200, shortest_path_infinite_distance<uint8_t>(), 50});
+}
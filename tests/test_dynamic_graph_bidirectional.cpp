@@ -0,0 +1,264 @@
+/**
+ * @file test_dynamic_graph_bidirectional.cpp
+ * @brief Tests for dynamic_graph traits that keep a reverse adjacency (in_edges_type)
+ *
+ * Covers the in_edges(g,u)/in_edges(g,uid) and in_degree(g,u)/in_degree(g,uid) CPOs
+ * on vov_bidirectional_graph_traits, a map-based traits with in-edges, and a custom
+ * graph that provides in_edges through ADL.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/container/traits/vov_bidirectional_graph_traits.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+// Map vertices + set edges, with in-edges kept in a vector on each vertex
+template <class EV = void, class VV = void, class GV = void, class VId = uint32_t, bool Sourced = false>
+struct mov_bidirectional_test_traits {
+  using edge_value_type         = EV;
+  using vertex_value_type       = VV;
+  using graph_value_type        = GV;
+  using vertex_id_type          = VId;
+  static constexpr bool sourced = Sourced;
+
+  using edge_type   = dynamic_edge<EV, VV, GV, VId, Sourced, mov_bidirectional_test_traits>;
+  using vertex_type = dynamic_vertex<EV, VV, GV, VId, Sourced, mov_bidirectional_test_traits>;
+  using graph_type  = dynamic_graph<EV, VV, GV, VId, Sourced, mov_bidirectional_test_traits>;
+
+  using vertices_type = std::map<VId, vertex_type>;
+  using edges_type    = std::vector<edge_type>;
+  using in_edges_type = std::vector<VId>;
+};
+
+using bidir_void = dynamic_graph<void, void, void, uint32_t, false,
+                                 vov_bidirectional_graph_traits<void, void, void, uint32_t, false>>;
+using bidir_int  = dynamic_graph<int, void, void, uint32_t, false,
+                                 vov_bidirectional_graph_traits<int, void, void, uint32_t, false>>;
+using bidir_sourced = dynamic_graph<void, void, void, uint32_t, true,
+                                    vov_bidirectional_graph_traits<void, void, void, uint32_t, true>>;
+using bidir_map_str = dynamic_graph<void, void, void, std::string, false,
+                                    mov_bidirectional_test_traits<void, void, void, std::string, false>>;
+using vov_void = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+
+namespace {
+template <class R>
+std::vector<typename std::ranges::range_value_t<R>> sorted_ids(R&& r) {
+  std::vector<typename std::ranges::range_value_t<R>> ids(std::ranges::begin(r), std::ranges::end(r));
+  std::ranges::sort(ids);
+  return ids;
+}
+
+template <class G>
+concept has_in_edges_cpo = requires(G& g, vertex_t<G> u) { graph::in_edges(g, u); };
+
+template <class G>
+concept has_in_degree_cpo = requires(G& g, vertex_t<G> u) { graph::in_degree(g, u); };
+} // namespace
+
+// =============================================================================
+// Category 1: Trait detection
+// =============================================================================
+
+TEST_CASE("bidirectional traits are detected", "[dynamic_graph][bidirectional][traits]") {
+  STATIC_REQUIRE(has_in_edges_type<vov_bidirectional_graph_traits<>>);
+  STATIC_REQUIRE(has_in_edges_type<mov_bidirectional_test_traits<>>);
+  STATIC_REQUIRE_FALSE(has_in_edges_type<vov_graph_traits<>>);
+}
+
+TEST_CASE("in_edges is unavailable without in_edges_type", "[dynamic_graph][bidirectional][traits]") {
+  STATIC_REQUIRE(has_in_edges_cpo<bidir_void>);
+  STATIC_REQUIRE(has_in_degree_cpo<bidir_void>);
+  STATIC_REQUIRE_FALSE(has_in_edges_cpo<vov_void>);
+  STATIC_REQUIRE_FALSE(has_in_degree_cpo<vov_void>);
+  STATIC_REQUIRE(sizeof(vov_void::vertex_type) == sizeof(vov_void::edges_type));
+}
+
+// =============================================================================
+// Category 2: Vector vertices
+// =============================================================================
+
+TEST_CASE("bidirectional vov in_edges(g, u)", "[dynamic_graph][bidirectional][in_edges]") {
+  SECTION("empty graph") {
+    bidir_void g;
+    REQUIRE(num_vertices(g) == 0);
+  }
+
+  SECTION("source ids of incoming edges") {
+    bidir_void g({{0, 1}, {0, 2}, {1, 2}, {3, 2}, {2, 0}});
+    REQUIRE(num_vertices(g) == 4);
+
+    auto u0 = *find_vertex(g, uint32_t(0));
+    auto u2 = *find_vertex(g, uint32_t(2));
+    auto u3 = *find_vertex(g, uint32_t(3));
+    REQUIRE(sorted_ids(in_edges(g, u0)) == std::vector<uint32_t>{2});
+    REQUIRE(sorted_ids(in_edges(g, u2)) == std::vector<uint32_t>{0, 1, 3});
+    REQUIRE(std::ranges::empty(in_edges(g, u3)));
+  }
+
+  SECTION("vertex id overload") {
+    bidir_void g({{0, 1}, {2, 1}, {1, 1}});
+    REQUIRE(sorted_ids(in_edges(g, uint32_t(1))) == std::vector<uint32_t>{0, 1, 2});
+    REQUIRE(std::ranges::empty(in_edges(g, uint32_t(0))));
+  }
+
+  SECTION("const graph") {
+    const bidir_void g({{0, 1}, {2, 1}});
+    auto             u1 = *find_vertex(g, uint32_t(1));
+    REQUIRE(sorted_ids(in_edges(g, u1)) == std::vector<uint32_t>{0, 2});
+  }
+
+  SECTION("edge values and sourced edges") {
+    bidir_int g({{0, 1, 10}, {2, 1, 20}});
+    REQUIRE(sorted_ids(in_edges(g, uint32_t(1))) == std::vector<uint32_t>{0, 2});
+
+    bidir_sourced gs({{0, 1}, {2, 1}});
+    REQUIRE(sorted_ids(in_edges(gs, uint32_t(1))) == std::vector<uint32_t>{0, 2});
+  }
+
+  SECTION("duplicate edges are kept") {
+    bidir_void g({{0, 1}, {0, 1}});
+    REQUIRE(in_degree(g, uint32_t(1)) == 2);
+  }
+}
+
+TEST_CASE("bidirectional vov in_degree(g, u)", "[dynamic_graph][bidirectional][in_degree]") {
+  bidir_void g({{0, 1}, {0, 2}, {1, 2}, {3, 2}});
+
+  SECTION("by descriptor") {
+    size_t total = 0;
+    for (auto u : vertices(g))
+      total += in_degree(g, u);
+    REQUIRE(total == num_edges(g));
+  }
+
+  SECTION("by id") {
+    REQUIRE(in_degree(g, uint32_t(0)) == 0);
+    REQUIRE(in_degree(g, uint32_t(1)) == 1);
+    REQUIRE(in_degree(g, uint32_t(2)) == 3);
+    REQUIRE(in_degree(g, uint32_t(3)) == 0);
+  }
+
+  SECTION("matches out-degree of the transpose") {
+    std::vector<size_t> counts(num_vertices(g), 0);
+    for (auto u : vertices(g))
+      for (auto uv : edges(g, u))
+        ++counts[target_id(g, uv)];
+    for (auto u : vertices(g))
+      REQUIRE(in_degree(g, u) == counts[vertex_id(g, u)]);
+  }
+}
+
+TEST_CASE("bidirectional vov edge-modifying operations", "[dynamic_graph][bidirectional][modify]") {
+  SECTION("load_edges appends to existing in-edges") {
+    bidir_void g({{0, 1}});
+    std::vector<copyable_edge_t<uint32_t, void>> more = {{2, 1}, {1, 3}};
+    g.load_edges(more);
+    REQUIRE(num_edges(g) == 3);
+    REQUIRE(sorted_ids(in_edges(g, uint32_t(1))) == std::vector<uint32_t>{0, 2});
+    REQUIRE(sorted_ids(in_edges(g, uint32_t(3))) == std::vector<uint32_t>{1});
+  }
+
+  SECTION("load_edges with explicit vertex count") {
+    bidir_void                                   g;
+    std::vector<copyable_edge_t<uint32_t, void>> ee = {{0, 4}, {3, 4}};
+    g.load_edges(ee, std::identity(), 6);
+    REQUIRE(num_vertices(g) == 6);
+    REQUIRE(sorted_ids(in_edges(g, uint32_t(4))) == std::vector<uint32_t>{0, 3});
+    REQUIRE(in_degree(g, uint32_t(5)) == 0);
+  }
+
+  SECTION("load_edges rejects out of range ids without a partial in-edge") {
+    bidir_void                                   g;
+    std::vector<copyable_edge_t<uint32_t, void>> ee = {{0, 1}, {1, 9}};
+    REQUIRE_THROWS_AS(g.load_edges(ee, std::identity(), 2), std::runtime_error);
+    REQUIRE(in_degree(g, uint32_t(1)) == 1);
+  }
+
+  SECTION("clear removes in-edges") {
+    bidir_void g({{0, 1}, {1, 2}});
+    g.clear();
+    REQUIRE(num_vertices(g) == 0);
+    g.load_edges(std::vector<copyable_edge_t<uint32_t, void>>{{1, 0}});
+    REQUIRE(in_degree(g, uint32_t(0)) == 1);
+    REQUIRE(in_degree(g, uint32_t(1)) == 0);
+  }
+
+  SECTION("copies are independent") {
+    bidir_void g({{0, 1}});
+    bidir_void h = g;
+    h.load_edges(std::vector<copyable_edge_t<uint32_t, void>>{{0, 1}});
+    REQUIRE(in_degree(g, uint32_t(1)) == 1);
+    REQUIRE(in_degree(h, uint32_t(1)) == 2);
+  }
+}
+
+// =============================================================================
+// Category 3: Associative vertices
+// =============================================================================
+
+TEST_CASE("bidirectional map in_edges(g, u) with string ids", "[dynamic_graph][bidirectional][map]") {
+  bidir_map_str g({{"alice", "bob"}, {"carol", "bob"}, {"bob", "dave"}});
+  REQUIRE(num_vertices(g) == 4);
+
+  SECTION("by id") {
+    REQUIRE(sorted_ids(in_edges(g, std::string("bob"))) == std::vector<std::string>{"alice", "carol"});
+    REQUIRE(in_degree(g, std::string("dave")) == 1);
+    REQUIRE(in_degree(g, std::string("alice")) == 0);
+  }
+
+  SECTION("by descriptor") {
+    size_t total = 0;
+    for (auto u : vertices(g))
+      total += in_degree(g, u);
+    REQUIRE(total == num_edges(g));
+  }
+}
+
+// =============================================================================
+// Category 4: CPO dispatch
+// =============================================================================
+
+namespace test_adl {
+struct GraphWithADLInEdges {
+  std::vector<std::vector<int>> adj_list;
+  std::vector<std::vector<int>> rev_list;
+
+  explicit GraphWithADLInEdges(size_t n) : adj_list(n), rev_list(n) {}
+
+  void add_edge(size_t from, size_t to) {
+    adj_list[from].push_back(static_cast<int>(to));
+    rev_list[to].push_back(static_cast<int>(from));
+  }
+};
+
+inline const std::vector<int>& in_edges(const GraphWithADLInEdges& g, size_t uid) { return g.rev_list[uid]; }
+} // namespace test_adl
+
+struct GraphWithMemberInDegree {
+  std::vector<std::vector<int>> rev_list;
+  size_t                        in_degree(size_t uid) const { return rev_list[uid].size() * 10; }
+};
+
+TEST_CASE("in_edges(g, uid) and in_degree(g, uid) dispatch", "[in_edges][in_degree][cpo]") {
+  SECTION("ADL in_edges with default in_degree") {
+    test_adl::GraphWithADLInEdges g(3);
+    g.add_edge(0, 2);
+    g.add_edge(1, 2);
+    REQUIRE(graph::in_edges(g, size_t(2)).size() == 2);
+    REQUIRE(graph::in_degree(g, size_t(2)) == 2);
+    REQUIRE(graph::in_degree(g, size_t(0)) == 0);
+  }
+
+  SECTION("member in_degree is preferred") {
+    GraphWithMemberInDegree g{{{1}, {0, 2}, {}}};
+    REQUIRE(graph::in_degree(g, size_t(1)) == 20);
+  }
+}
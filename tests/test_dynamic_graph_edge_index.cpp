@@ -0,0 +1,193 @@
+/**
+ * @file test_dynamic_graph_edge_index.cpp
+ * @brief Tests for the per-vertex target index of dynamic_graph (Traits::edge_index_threshold)
+ *
+ * Vertices whose degree reaches the threshold keep a hash index from target id to edge position,
+ * which the contains_edge and find_vertex_edge CPOs use through the graph's members.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/dov_graph_traits.hpp>
+#include <graph/container/traits/uov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+using vov_idx = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false, false, 4>>;
+using dov_idx = dynamic_graph<int, void, void, uint32_t, false, dov_graph_traits<int, void, void, uint32_t, false, false, 4>>;
+using uov_idx = dynamic_graph<int, void, void, uint32_t, false, uov_graph_traits<int, void, void, uint32_t, false, 4>>;
+using vov_idx_ts = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false, true, 4>>;
+using vov_plain  = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false>>;
+
+template <class G>
+concept has_member_contains_edge = requires(const G& g, uint32_t uid, uint32_t vid) { g.contains_edge(uid, vid); };
+
+template <class G>
+bool is_indexed(const G& g, uint32_t uid) {
+  return (*find_vertex(g, uid)).inner_value(g).edge_index().has_value();
+}
+
+namespace {
+// Vertex 0 is a hub with edges to 1..20 (and a second edge to 5), vertex 1 has 2 edges
+std::vector<copyable_edge_t<uint32_t, int>> hub_edges() {
+  std::vector<copyable_edge_t<uint32_t, int>> ee;
+  for (uint32_t v = 1; v <= 20; ++v)
+    ee.push_back({0, v, static_cast<int>(v)});
+  ee.push_back({0, 5, 500});
+  ee.push_back({1, 2, 12});
+  ee.push_back({1, 3, 13});
+  return ee;
+}
+} // namespace
+
+TEST_CASE("edge index trait detection", "[dynamic_graph][edge_index]") {
+  STATIC_REQUIRE(has_edge_index<vov_graph_traits<int, void, void, uint32_t, false, false, 4>>);
+  STATIC_REQUIRE(has_edge_index<uov_graph_traits<int, void, void, uint32_t, false, 4>>);
+  STATIC_REQUIRE_FALSE(has_edge_index<vov_graph_traits<int, void, void, uint32_t, false>>);
+  STATIC_REQUIRE_FALSE(has_edge_index<uov_graph_traits<>>);
+
+  STATIC_REQUIRE(has_member_contains_edge<vov_idx>);
+  STATIC_REQUIRE_FALSE(has_member_contains_edge<vov_plain>);
+  STATIC_REQUIRE(sizeof(vov_plain::vertex_type) < sizeof(vov_idx::vertex_type));
+}
+
+TEMPLATE_TEST_CASE("edge index lookups", "[dynamic_graph][edge_index]", vov_idx, dov_idx, uov_idx, vov_idx_ts) {
+  using G = TestType;
+  G g;
+  g.load_edges(hub_edges());
+
+  SECTION("only high-degree vertices are indexed") {
+    REQUIRE(is_indexed(g, 0));
+    REQUIRE_FALSE(is_indexed(g, 1));
+    REQUIRE((*find_vertex(g, uint32_t(0))).inner_value(g).edge_index()->size() == 20);
+  }
+
+  SECTION("contains_edge") {
+    for (uint32_t v = 1; v <= 20; ++v)
+      REQUIRE(contains_edge(g, uint32_t(0), v));
+    REQUIRE_FALSE(contains_edge(g, uint32_t(0), uint32_t(0)));
+    REQUIRE_FALSE(contains_edge(g, uint32_t(0), uint32_t(21)));
+    REQUIRE(contains_edge(g, uint32_t(1), uint32_t(3)));
+    REQUIRE_FALSE(contains_edge(g, uint32_t(1), uint32_t(4)));
+    REQUIRE_FALSE(contains_edge(g, uint32_t(42), uint32_t(1)));
+
+    auto u0 = *find_vertex(g, uint32_t(0));
+    auto u7 = *find_vertex(g, uint32_t(7));
+    REQUIRE(contains_edge(g, u0, u7));
+    REQUIRE_FALSE(contains_edge(g, u7, u0));
+
+    const G& cg = g;
+    REQUIRE(contains_edge(cg, uint32_t(0), uint32_t(9)));
+  }
+
+  SECTION("find_vertex_edge returns the first matching edge") {
+    auto u0 = *find_vertex(g, uint32_t(0));
+    auto e5 = find_vertex_edge(g, u0, uint32_t(5));
+    REQUIRE(target_id(g, e5) == 5);
+    REQUIRE(edge_value(g, e5) == 5);
+    REQUIRE(edge_value(g, find_vertex_edge(g, uint32_t(0), uint32_t(17))) == 17);
+    REQUIRE(edge_value(g, find_vertex_edge(g, u0, *find_vertex(g, uint32_t(12)))) == 12);
+    REQUIRE(edge_value(g, find_vertex_edge(g, uint32_t(1), uint32_t(3))) == 13);
+
+    const G& cg = g;
+    REQUIRE(edge_value(cg, find_vertex_edge(cg, uint32_t(0), uint32_t(20))) == 20);
+
+    // Not found: the end position of edges(g,u)
+    auto none = find_vertex_edge(g, u0, uint32_t(0));
+    REQUIRE(none.value() == (*find_vertex(g, uint32_t(0))).inner_value(g).edges().size());
+  }
+
+  SECTION("edges loaded later are indexed") {
+    g.load_edges(std::vector<copyable_edge_t<uint32_t, int>>{{0, 21, 21}, {1, 4, 14}, {1, 5, 15}, {21, 0, 0}});
+    REQUIRE(contains_edge(g, uint32_t(0), uint32_t(21)));
+    REQUIRE(edge_value(g, find_vertex_edge(g, uint32_t(0), uint32_t(21))) == 21);
+    REQUIRE(is_indexed(g, 1)); // reached the threshold
+    REQUIRE(edge_value(g, find_vertex_edge(g, uint32_t(1), uint32_t(5))) == 15);
+    REQUIRE(contains_edge(g, uint32_t(21), uint32_t(0)));
+  }
+}
+
+TEMPLATE_TEST_CASE("edge index agrees with a linear scan", "[dynamic_graph][edge_index]", vov_idx, uov_idx) {
+  using G = TestType;
+  std::vector<copyable_edge_t<uint32_t, int>> ee;
+  for (uint32_t u = 0; u < 200; ++u)
+    for (uint32_t k = 0; k < u % 13; ++k)
+      ee.push_back({u, (u * 7 + k * k) % 200, static_cast<int>(u * 100 + k)});
+  G         g;
+  vov_plain p;
+  g.load_edges(ee);
+  p.load_edges(ee);
+
+  for (uint32_t u = 0; u < 200; ++u) {
+    for (uint32_t v = 0; v < 200; ++v) {
+      const bool expected = contains_edge(p, u, v);
+      REQUIRE(contains_edge(g, u, v) == expected);
+      if (expected)
+        REQUIRE(edge_value(g, find_vertex_edge(g, u, v)) == edge_value(p, find_vertex_edge(p, u, v)));
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE("edge index stays in sync with erase_edge", "[dynamic_graph][edge_index][erase]", vov_idx, dov_idx,
+                   vov_idx_ts) {
+  using G = TestType;
+  G g;
+  g.load_edges(hub_edges());
+
+  SECTION("erasing a multi-edge moves the index to the next one") {
+    REQUIRE(g.erase_edge(0, 5));
+    REQUIRE(contains_edge(g, uint32_t(0), uint32_t(5)));
+    REQUIRE(edge_value(g, find_vertex_edge(g, uint32_t(0), uint32_t(5))) == 500);
+    REQUIRE(g.erase_edge(0, 5));
+    REQUIRE_FALSE(contains_edge(g, uint32_t(0), uint32_t(5)));
+    REQUIRE_FALSE(g.erase_edge(0, 5));
+  }
+
+  SECTION("later edges are still found") {
+    REQUIRE(g.erase_edge(0, 1));
+    REQUIRE(g.erase_edge(0, 10));
+    for (uint32_t v = 2; v <= 20; ++v) {
+      REQUIRE(contains_edge(g, uint32_t(0), v) == (v != 10));
+      if (v != 10)
+        REQUIRE(target_id(g, find_vertex_edge(g, uint32_t(0), v)) == v);
+    }
+  }
+
+  SECTION("the index is dropped below the threshold") {
+    for (uint32_t v = 1; v <= 18; ++v)
+      REQUIRE(g.erase_edge(0, v));
+    REQUIRE(g.erase_edge(0, 5));
+    REQUIRE(degree(g, *find_vertex(g, uint32_t(0))) == 2);
+    compact(g);
+    REQUIRE_FALSE(is_indexed(g, 0));
+    REQUIRE(contains_edge(g, uint32_t(0), uint32_t(20)));
+    REQUIRE(edge_value(g, find_vertex_edge(g, uint32_t(0), uint32_t(19))) == 19);
+  }
+}
+
+TEST_CASE("edge index after compact", "[dynamic_graph][edge_index][tombstone]") {
+  vov_idx_ts g;
+  g.load_edges(hub_edges());
+  REQUIRE(g.erase_edge(0, 3));
+  REQUIRE(g.erase_edge(0, 5));
+  REQUIRE(compact(g) == 2);
+  REQUIRE(is_indexed(g, 0));
+  REQUIRE(edge_value(g, find_vertex_edge(g, uint32_t(0), uint32_t(5))) == 500);
+  REQUIRE(edge_value(g, find_vertex_edge(g, uint32_t(0), uint32_t(20))) == 20);
+  REQUIRE_FALSE(contains_edge(g, uint32_t(0), uint32_t(3)));
+
+  vov_idx_ts c = g;
+  REQUIRE(edge_value(c, find_vertex_edge(c, uint32_t(0), uint32_t(4))) == 4);
+}
+
+TEST_CASE("edge index memory is reported", "[dynamic_graph][edge_index][memory_usage]") {
+  vov_idx   g;
+  vov_plain p;
+  g.load_edges(hub_edges());
+  p.load_edges(hub_edges());
+  REQUIRE(memory_usage(g).edges > memory_usage(p).edges);
+}
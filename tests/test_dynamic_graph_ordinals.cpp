@@ -0,0 +1,118 @@
+/**
+ * @file test_dynamic_graph_ordinals.cpp
+ * @brief Tests for dense vertex ordinals on dynamic_graph with keyed vertices (Traits::vertex_ordinals)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/container/traits/mos_graph_traits.hpp>
+#include <graph/container/traits/mol_graph_traits.hpp>
+#include <graph/container/traits/uod_graph_traits.hpp>
+#include <graph/container/traits/uov_graph_traits.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/property_map.hpp>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+using mos_ord = dynamic_graph<int, int, void, uint32_t, false, mos_graph_traits<int, int, void, uint32_t, false, true>>;
+using mol_ord = dynamic_graph<int, int, void, uint32_t, false, mol_graph_traits<int, int, void, uint32_t, false, true>>;
+using uod_ord = dynamic_graph<int, int, void, uint32_t, false, uod_graph_traits<int, int, void, uint32_t, false, true>>;
+using uov_ord = dynamic_graph<int, int, void, uint32_t, false, uov_graph_traits<int, int, void, uint32_t, false, 0, true>>;
+using mos_plain = dynamic_graph<int, int, void, uint32_t, false, mos_graph_traits<int, int, void, uint32_t, false>>;
+using str_ord = dynamic_graph<void, void, void, std::string, false, mos_graph_traits<void, void, void, std::string, false, true>>;
+
+template <class G>
+concept has_descriptor_ordinal = requires(vertex_t<G> u) { u.ordinal(); };
+
+namespace {
+std::vector<copyable_edge_t<uint32_t, int>> sparse_edges() {
+  // Sparse ids, so ordinals can't be the ids
+  return {{1000, 20, 1}, {20, 7, 2}, {7, 1000, 3}, {55, 20, 4}, {90000, 55, 5}};
+}
+
+template <class G>
+void require_dense_ordinals(G& g) {
+  std::set<size_t> seen;
+  size_t           expected = 0;
+  for (auto u : vertices(g)) {
+    REQUIRE(u.ordinal() == expected++); // container order
+    seen.insert(u.ordinal());
+  }
+  REQUIRE(seen.size() == num_vertices(g));
+}
+} // namespace
+
+TEST_CASE("vertex ordinal trait detection", "[dynamic_graph][ordinals]") {
+  STATIC_REQUIRE(has_vertex_ordinals<mos_graph_traits<int, int, void, uint32_t, false, true>>);
+  STATIC_REQUIRE_FALSE(has_vertex_ordinals<mos_graph_traits<int, int, void, uint32_t, false>>);
+  STATIC_REQUIRE_FALSE(has_vertex_ordinals<vov_graph_traits<>>);
+
+  STATIC_REQUIRE(has_descriptor_ordinal<mos_ord>);
+  STATIC_REQUIRE(has_descriptor_ordinal<uov_ord>);
+  STATIC_REQUIRE_FALSE(has_descriptor_ordinal<mos_plain>);
+  // Index graphs use the index as the ordinal
+  STATIC_REQUIRE(has_descriptor_ordinal<dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int>>>);
+
+  STATIC_REQUIRE(sizeof(mos_plain::vertex_type) < sizeof(mos_ord::vertex_type));
+}
+
+TEMPLATE_TEST_CASE("vertex ordinals are dense", "[dynamic_graph][ordinals]", mos_ord, mol_ord, uod_ord, uov_ord) {
+  using G = TestType;
+  G g;
+
+  SECTION("after load_edges") {
+    g.load_edges(sparse_edges());
+    REQUIRE(num_vertices(g) == 5);
+    require_dense_ordinals(g);
+  }
+
+  SECTION("after load_vertices and later loads") {
+    g.load_vertices(std::vector<copyable_vertex_t<uint32_t, int>>{{500, 1}, {3, 2}});
+    require_dense_ordinals(g);
+    g.load_edges(sparse_edges());
+    REQUIRE(num_vertices(g) == 7);
+    require_dense_ordinals(g);
+    g.load_edges(std::vector<copyable_edge_t<uint32_t, int>>{{1, 2, 0}});
+    REQUIRE(num_vertices(g) == 9);
+    require_dense_ordinals(g);
+  }
+
+  SECTION("copies keep the ordinals") {
+    g.load_edges(sparse_edges());
+    G c = g;
+    for (auto u : vertices(c))
+      REQUIRE(u.ordinal() == (*find_vertex(g, vertex_id(c, u))).ordinal());
+  }
+
+  SECTION("ordinals index vertex_property_map") {
+    g.load_edges(sparse_edges());
+    STATIC_REQUIRE(vertex_property_map<G, int>::has_ordinals);
+    vertex_property_map<G, int> m(g, 0);
+    for (auto u : vertices(g)) {
+      REQUIRE(m.index_of(u) == u.ordinal());
+      m[u] = static_cast<int>(vertex_id(g, u));
+    }
+    for (uint32_t uid : {1000u, 20u, 7u, 55u, 90000u})
+      REQUIRE(m[uid] == static_cast<int>(uid));
+
+    edge_property_map<G, int> em(g, 0);
+    std::set<size_t>          indexes;
+    for (auto u : vertices(g))
+      for (auto uv : edges(g, u))
+        indexes.insert(em.index_of(uv));
+    REQUIRE(indexes.size() == num_edges(g));
+  }
+}
+
+TEST_CASE("vertex ordinals with string ids", "[dynamic_graph][ordinals]") {
+  str_ord g;
+  g.load_edges(std::vector<copyable_edge_t<std::string, void>>{{"b", "a"}, {"c", "b"}, {"a", "d"}});
+  require_dense_ordinals(g);
+  REQUIRE((*find_vertex(g, std::string("a"))).ordinal() == 0); // map order
+  REQUIRE((*find_vertex(g, std::string("d"))).ordinal() == 3);
+}
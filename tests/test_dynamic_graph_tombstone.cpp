@@ -0,0 +1,216 @@
+/**
+ * @file test_dynamic_graph_tombstone.cpp
+ * @brief Tests for erase_edge() and compact() on dynamic_graph, with and without tombstone edges
+ *
+ * With tombstones (Traits::tombstone_edges) erased edges are marked dead and skipped by edges(g,u)
+ * until compact(g) removes them from the edge containers.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vod_graph_traits.hpp>
+#include <graph/container/traits/dov_graph_traits.hpp>
+#include <graph/container/traits/dod_graph_traits.hpp>
+#include <graph/container/traits/vov_bidirectional_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <algorithm>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+using vov_ts = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false, true>>;
+using vod_ts = dynamic_graph<int, void, void, uint32_t, false, vod_graph_traits<int, void, void, uint32_t, false, true>>;
+using dov_ts = dynamic_graph<int, void, void, uint32_t, false, dov_graph_traits<int, void, void, uint32_t, false, true>>;
+using dod_ts = dynamic_graph<int, void, void, uint32_t, true, dod_graph_traits<int, void, void, uint32_t, true, true>>;
+using vov_plain = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false>>;
+using vov_bidir = dynamic_graph<void, void, void, uint32_t, false, vov_bidirectional_graph_traits<void, void, void, uint32_t, false>>;
+
+template <class G>
+std::vector<std::pair<uint32_t, int>> out_edges_of(G& g, uint32_t uid) {
+  std::vector<std::pair<uint32_t, int>> out;
+  for (auto uv : edges(g, *find_vertex(g, uid)))
+    out.emplace_back(static_cast<uint32_t>(target_id(g, uv)), edge_value(g, uv));
+  return out;
+}
+
+// =============================================================================
+// Trait detection
+// =============================================================================
+
+TEST_CASE("tombstone trait detection", "[dynamic_graph][tombstone]") {
+  STATIC_REQUIRE(has_tombstone_edges<vov_graph_traits<int, void, void, uint32_t, false, true>>);
+  STATIC_REQUIRE(has_tombstone_edges<dod_graph_traits<int, void, void, uint32_t, true, true>>);
+  STATIC_REQUIRE_FALSE(has_tombstone_edges<vov_graph_traits<int, void, void, uint32_t, false>>);
+  STATIC_REQUIRE_FALSE(has_tombstone_edges<vov_bidirectional_graph_traits<>>);
+
+  // No space is used on the vertex without tombstones
+  STATIC_REQUIRE(sizeof(vov_plain::vertex_type) < sizeof(vov_ts::vertex_type));
+}
+
+// =============================================================================
+// Erase with tombstones
+// =============================================================================
+
+TEMPLATE_TEST_CASE("tombstone erase_edge skips dead edges", "[dynamic_graph][tombstone]", vov_ts, vod_ts, dov_ts,
+                   dod_ts) {
+  using G = TestType;
+  G g({{0, 1, 10}, {0, 2, 20}, {0, 3, 30}, {1, 2, 40}, {0, 2, 50}});
+  REQUIRE(num_edges(g) == 5);
+
+  SECTION("erase by ids removes the first live match") {
+    REQUIRE(g.erase_edge(0, 2));
+    REQUIRE(num_edges(g) == 4);
+    REQUIRE(g.dead_edge_count() == 1);
+    REQUIRE(out_edges_of(g, 0) == std::vector<std::pair<uint32_t, int>>{{1, 10}, {3, 30}, {2, 50}});
+    REQUIRE(degree(g, *find_vertex(g, uint32_t(0))) == 3);
+
+    REQUIRE(g.erase_edge(0, 2));
+    REQUIRE(out_edges_of(g, 0) == std::vector<std::pair<uint32_t, int>>{{1, 10}, {3, 30}});
+    REQUIRE_FALSE(g.erase_edge(0, 2));
+    REQUIRE_FALSE(contains_edge(g, uint32_t(0), uint32_t(2)));
+    REQUIRE(contains_edge(g, uint32_t(0), uint32_t(3)));
+  }
+
+  SECTION("missing vertices or edges") {
+    REQUIRE_FALSE(g.erase_edge(0, 9));
+    REQUIRE_FALSE(g.erase_edge(9, 0));
+    REQUIRE_FALSE(g.erase_edge(3, 0));
+    REQUIRE(num_edges(g) == 5);
+    REQUIRE(g.dead_edge_count() == 0);
+  }
+
+  SECTION("erase by descriptor keeps other descriptors valid") {
+    auto u0   = *find_vertex(g, uint32_t(0));
+    auto view = edges(g, u0);
+    auto it   = view.begin();
+    auto e10  = *it;
+    auto e20  = *++it;
+    auto e30  = *++it;
+
+    REQUIRE(g.erase_edge(e20));
+    REQUIRE_FALSE(g.erase_edge(e20));
+    REQUIRE(edge_value(g, e10) == 10);
+    REQUIRE(edge_value(g, e30) == 30);
+    REQUIRE(target_id(g, e30) == 3);
+    REQUIRE(num_edges(g) == 4);
+  }
+
+  SECTION("a view made before an erase skips the erased edge") {
+    auto view = edges(g, *find_vertex(g, uint32_t(0)));
+    REQUIRE(view.size() == 4);
+    REQUIRE(g.erase_edge(0, 3));
+    REQUIRE(view.size() == 3);
+    REQUIRE(std::ranges::distance(view) == 3);
+    REQUIRE(std::ranges::none_of(view, [&g](auto uv) { return target_id(g, uv) == 3; }));
+  }
+
+  SECTION("erase every edge of a vertex") {
+    while (g.erase_edge(0, 1) || g.erase_edge(0, 2) || g.erase_edge(0, 3)) {
+    }
+    auto u0 = *find_vertex(g, uint32_t(0));
+    REQUIRE(std::ranges::empty(edges(g, u0)));
+    REQUIRE(edges(g, u0).begin() == edges(g, u0).end());
+    REQUIRE(degree(g, u0) == 0);
+    REQUIRE(num_edges(g) == 1);
+  }
+
+  SECTION("edges loaded after an erase are live") {
+    REQUIRE(g.erase_edge(0, 1));
+    g.load_edges(std::vector<copyable_edge_t<uint32_t, int>>{{0, 1, 60}});
+    REQUIRE(out_edges_of(g, 0) == std::vector<std::pair<uint32_t, int>>{{2, 20}, {3, 30}, {2, 50}, {1, 60}});
+    REQUIRE(num_edges(g) == 5);
+  }
+
+  SECTION("compact removes dead edges and keeps order") {
+    REQUIRE(g.erase_edge(0, 1));
+    REQUIRE(g.erase_edge(1, 2));
+    const auto before0 = out_edges_of(g, 0);
+
+    REQUIRE(compact(g) == 2);
+    REQUIRE(g.dead_edge_count() == 0);
+    REQUIRE(out_edges_of(g, 0) == before0);
+    REQUIRE((*find_vertex(g, uint32_t(0))).inner_value(g).edges().size() == 3);
+    REQUIRE((*find_vertex(g, uint32_t(1))).inner_value(g).edges().empty());
+    REQUIRE(num_edges(g) == 3);
+    REQUIRE(compact(g) == 0);
+  }
+
+  SECTION("compact honors the dead ratio") {
+    REQUIRE(g.erase_edge(0, 1)); // 1 of 4 edges of vertex 0
+    REQUIRE(g.erase_edge(1, 2)); // 1 of 1 edges of vertex 1
+
+    REQUIRE(compact(g, 0.5) == 1);
+    REQUIRE(g.dead_edge_count() == 1);
+    REQUIRE((*find_vertex(g, uint32_t(1))).inner_value(g).edges().empty());
+    REQUIRE((*find_vertex(g, uint32_t(0))).inner_value(g).edges().size() == 4);
+
+    REQUIRE(compact(g, 0.25) == 1);
+    REQUIRE(g.dead_edge_count() == 0);
+  }
+}
+
+TEST_CASE("tombstone copy keeps dead edges", "[dynamic_graph][tombstone]") {
+  vov_ts g({{0, 1, 1}, {0, 2, 2}});
+  REQUIRE(g.erase_edge(0, 1));
+  vov_ts c = g;
+  REQUIRE(out_edges_of(c, 0) == std::vector<std::pair<uint32_t, int>>{{2, 2}});
+  REQUIRE(c.dead_edge_count() == 1);
+}
+
+TEST_CASE("tombstone compact on a large graph", "[dynamic_graph][tombstone][compact]") {
+  // Enough vertices for compact() to split the work across workers
+  const uint32_t                        n = 5000;
+  std::vector<copyable_edge_t<uint32_t, int>> ee;
+  for (uint32_t u = 0; u < n; ++u)
+    for (uint32_t k = 1; k <= 4; ++k)
+      ee.push_back({u, (u + k) % n, static_cast<int>(u * 4 + k)});
+  vov_ts g;
+  g.load_edges(ee);
+
+  for (uint32_t u = 0; u < n; u += 2)
+    REQUIRE(g.erase_edge(u, (u + 2) % n));
+  REQUIRE(num_edges(g) == n * 4 - n / 2);
+
+  std::vector<std::pair<uint32_t, int>> before;
+  for (uint32_t u = 0; u < n; ++u)
+    for (auto& e : out_edges_of(g, u))
+      before.push_back(e);
+
+  REQUIRE(compact(g) == n / 2);
+
+  std::vector<std::pair<uint32_t, int>> after;
+  for (uint32_t u = 0; u < n; ++u)
+    for (auto& e : out_edges_of(g, u))
+      after.push_back(e);
+  REQUIRE(before == after);
+  REQUIRE(g.dead_edge_count() == 0);
+}
+
+// =============================================================================
+// Erase without tombstones
+// =============================================================================
+
+TEST_CASE("erase_edge without tombstones removes the edge", "[dynamic_graph][erase]") {
+  vov_plain g({{0, 1, 10}, {0, 2, 20}, {0, 3, 30}});
+  REQUIRE(g.erase_edge(0, 2));
+  REQUIRE((*find_vertex(g, uint32_t(0))).inner_value(g).edges().size() == 2);
+  REQUIRE(out_edges_of(g, 0) == std::vector<std::pair<uint32_t, int>>{{1, 10}, {3, 30}});
+  REQUIRE(num_edges(g) == 2);
+  REQUIRE(g.dead_edge_count() == 0);
+  REQUIRE(compact(g) == 0);
+}
+
+TEST_CASE("erase_edge keeps in-edges in sync", "[dynamic_graph][erase][in_edges]") {
+  vov_bidir g({{0, 2}, {1, 2}, {0, 2}});
+  auto      u2 = *find_vertex(g, uint32_t(2));
+  REQUIRE(in_degree(g, u2) == 3);
+
+  REQUIRE(g.erase_edge(0, 2));
+  REQUIRE(in_degree(g, u2) == 2);
+  REQUIRE(std::ranges::count(in_edges(g, u2), 0u) == 1);
+
+  REQUIRE(g.erase_edge(1, 2));
+  REQUIRE(std::ranges::equal(in_edges(g, u2), std::vector<uint32_t>{0}));
+}
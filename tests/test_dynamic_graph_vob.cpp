@@ -0,0 +1,238 @@
+/**
+ * @file test_dynamic_graph_vob.cpp
+ * @brief Tests for edge_block_list / edge_block_pool and dynamic_graph with vob_graph_traits
+ *
+ * vob_graph_traits stores vertices in a std::vector and the edges of each vertex in a chain
+ * of 64-byte blocks drawn from a pool shared by all vertices.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/container/traits/vob_graph_traits.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+using vob_void = dynamic_graph<void, void, void, uint32_t, false, vob_graph_traits<void, void, void, uint32_t, false>>;
+using vob_int  = dynamic_graph<int, void, void, uint32_t, false, vob_graph_traits<int, void, void, uint32_t, false>>;
+using vob_string = dynamic_graph<std::string, std::string, void, uint32_t, false,
+                                 vob_graph_traits<std::string, std::string, void, uint32_t, false>>;
+using vob_sourced = dynamic_graph<void, void, void, uint32_t, true, vob_graph_traits<void, void, void, uint32_t, true>>;
+using vov_int  = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false>>;
+
+// =============================================================================
+// Category 1: edge_block_list
+// =============================================================================
+
+TEST_CASE("edge_block_pool block layout", "[edge_block_list][pool]") {
+  using pool4 = edge_block_pool<uint32_t, 64>;
+  STATIC_REQUIRE(sizeof(pool4::block) == 64);
+  STATIC_REQUIRE(alignof(pool4::block) == 64);
+  STATIC_REQUIRE(pool4::capacity == (64 - pool4::header_bytes) / sizeof(uint32_t));
+
+  // An element larger than the block still gets one slot per block
+  struct big {
+    char bytes[100];
+  };
+  STATIC_REQUIRE(edge_block_pool<big, 64>::capacity == 1);
+}
+
+TEST_CASE("edge_block_list append and iterate", "[edge_block_list]") {
+  using list_t = edge_block_list<int, 64>;
+  constexpr size_t cap = list_t::block_capacity;
+
+  SECTION("empty") {
+    list_t l;
+    REQUIRE(l.empty());
+    REQUIRE(l.size() == 0);
+    REQUIRE(l.begin() == l.end());
+    REQUIRE(l.block_count() == 0);
+  }
+
+  SECTION("spans several blocks in order") {
+    list_t l;
+    const int n = static_cast<int>(cap * 3 + 2);
+    for (int i = 0; i < n; ++i)
+      l.push_back(i);
+    REQUIRE(l.size() == static_cast<size_t>(n));
+    REQUIRE(l.block_count() == 4);
+    REQUIRE(std::ranges::distance(l) == n);
+
+    std::vector<int> expected(static_cast<size_t>(n));
+    std::iota(expected.begin(), expected.end(), 0);
+    REQUIRE(std::ranges::equal(l, expected));
+  }
+
+  SECTION("appending keeps references valid") {
+    list_t l;
+    int&   first = l.emplace_back(42);
+    for (int i = 0; i < static_cast<int>(cap * 4); ++i)
+      l.push_back(i);
+    REQUIRE(first == 42);
+    REQUIRE(&first == &*l.begin());
+  }
+
+  SECTION("copy, move and clear") {
+    list_t l;
+    for (int i = 0; i < 40; ++i)
+      l.push_back(i);
+    list_t c = l;
+    REQUIRE(std::ranges::equal(c, l));
+
+    list_t m = std::move(c);
+    REQUIRE(m.size() == 40);
+    REQUIRE(c.empty());
+
+    m.clear();
+    REQUIRE(m.empty());
+    REQUIRE(m.begin() == m.end());
+    REQUIRE(l.size() == 40);
+  }
+
+  SECTION("non-trivial elements") {
+    edge_block_list<std::string, 64> l;
+    for (int i = 0; i < 10; ++i)
+      l.emplace_back(std::string(40, static_cast<char>('a' + i)));
+    REQUIRE(l.size() == 10);
+    REQUIRE(*l.begin() == std::string(40, 'a'));
+    auto copy = l;
+    REQUIRE(std::ranges::equal(copy, l));
+  }
+}
+
+TEST_CASE("edge_block_list compact and trim", "[edge_block_list][compact]") {
+  using list_t = edge_block_list<double, 64>;
+  using pool_t = list_t::pool_type;
+  constexpr size_t cap = list_t::block_capacity;
+
+  std::vector<list_t> lists(8);
+  // Interleave appends so each list's blocks are scattered through the slab
+  for (int round = 0; round < static_cast<int>(cap * 5); ++round)
+    for (auto& l : lists)
+      l.push_back(round);
+
+  const size_t in_use_before = pool_t::instance().blocks_in_use();
+  for (auto& l : lists)
+    l.compact();
+
+  for (auto& l : lists) {
+    REQUIRE(l.size() == cap * 5);
+    std::vector<double> expected(cap * 5);
+    std::iota(expected.begin(), expected.end(), 0.0);
+    REQUIRE(std::ranges::equal(l, expected));
+
+    // Blocks of a compacted list are adjacent and all full but the last
+    auto* b = &*l.begin();
+    for (size_t i = 0; i < l.size(); ++i) {
+      REQUIRE(*(b + (i % cap)) == static_cast<double>(i));
+      if (i % cap == cap - 1)
+        b = reinterpret_cast<double*>(reinterpret_cast<std::byte*>(b) + sizeof(list_t::block_type));
+    }
+  }
+  REQUIRE(pool_t::instance().blocks_in_use() == in_use_before);
+
+  lists.clear();
+  list_t::trim();
+  REQUIRE(pool_t::instance().blocks_in_use() == 0);
+  REQUIRE(pool_t::instance().reserved_bytes() == 0);
+}
+
+// =============================================================================
+// Category 2: dynamic_graph with vob_graph_traits
+// =============================================================================
+
+TEST_CASE("vob construction and traversal", "[dynamic_graph][vob]") {
+  SECTION("empty graph") {
+    vob_void g;
+    REQUIRE(num_vertices(g) == 0);
+    REQUIRE(num_edges(g) == 0);
+  }
+
+  SECTION("initializer list") {
+    vob_int g({{0, 1, 10}, {0, 2, 20}, {1, 2, 30}, {2, 0, 40}});
+    REQUIRE(num_vertices(g) == 3);
+    REQUIRE(num_edges(g) == 4);
+
+    std::vector<std::pair<uint32_t, int>> seen;
+    for (auto u : vertices(g))
+      for (auto uv : edges(g, u))
+        seen.emplace_back(target_id(g, uv), edge_value(g, uv));
+    REQUIRE(seen == std::vector<std::pair<uint32_t, int>>{{1, 10}, {2, 20}, {2, 30}, {0, 40}});
+  }
+
+  SECTION("degree and find_vertex_edge") {
+    vob_void g({{0, 1}, {0, 2}, {0, 3}, {1, 3}});
+    REQUIRE(degree(g, uint32_t(0)) == 3);
+    REQUIRE(degree(g, uint32_t(3)) == 0);
+    auto u0 = *find_vertex(g, uint32_t(0));
+    REQUIRE(contains_edge(g, u0, *find_vertex(g, uint32_t(2))));
+    REQUIRE_FALSE(contains_edge(g, *find_vertex(g, uint32_t(1)), *find_vertex(g, uint32_t(2))));
+  }
+
+  SECTION("sourced edges") {
+    vob_sourced g({{0, 1}, {1, 2}});
+    for (auto u : vertices(g))
+      for (auto uv : edges(g, u))
+        REQUIRE(source_id(g, uv) == vertex_id(g, u));
+  }
+
+  SECTION("string values") {
+    vob_string g;
+    g.load_edges(std::vector<copyable_edge_t<uint32_t, std::string>>{{0, 1, "a"}, {1, 0, "b"}});
+    auto u1 = *find_vertex(g, uint32_t(1));
+    REQUIRE(edge_value(g, *edges(g, u1).begin()) == "b");
+  }
+}
+
+TEST_CASE("vob matches vov for a high-degree vertex", "[dynamic_graph][vob]") {
+  std::vector<copyable_edge_t<uint32_t, int>> ee;
+  for (uint32_t i = 1; i < 500; ++i) {
+    ee.push_back({0, i, static_cast<int>(i)});
+    ee.push_back({i, (i * 7) % 500, static_cast<int>(i) * 2});
+  }
+  vob_int a;
+  vov_int b;
+  a.load_edges(ee);
+  b.load_edges(ee);
+  REQUIRE(num_edges(a) == num_edges(b));
+
+  auto flatten = [](auto& g) {
+    std::vector<std::tuple<uint32_t, uint32_t, int>> out;
+    for (auto u : vertices(g))
+      for (auto uv : edges(g, u))
+        out.emplace_back(static_cast<uint32_t>(vertex_id(g, u)), static_cast<uint32_t>(target_id(g, uv)),
+                         edge_value(g, uv));
+    return out;
+  };
+  REQUIRE(flatten(a) == flatten(b));
+}
+
+TEST_CASE("vob compact keeps the graph unchanged", "[dynamic_graph][vob][compact]") {
+  vob_int g;
+  for (int round = 0; round < 20; ++round) {
+    std::vector<copyable_edge_t<uint32_t, int>> ee;
+    for (uint32_t u = 0; u < 50; ++u)
+      ee.push_back({u, (u + static_cast<uint32_t>(round) + 1) % 50, round});
+    g.load_edges(ee);
+  }
+  REQUIRE(num_edges(g) == 1000);
+
+  auto before = std::vector<int>{};
+  for (auto u : vertices(g))
+    for (auto uv : edges(g, u))
+      before.push_back(edge_value(g, uv));
+
+  g.compact();
+
+  auto after = std::vector<int>{};
+  for (auto u : vertices(g))
+    for (auto uv : edges(g, u))
+      after.push_back(edge_value(g, uv));
+  REQUIRE(before == after);
+  REQUIRE(num_edges(g) == 1000);
+}
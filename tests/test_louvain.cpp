@@ -0,0 +1,208 @@
+/**
+ * @file test_louvain.cpp
+ * @brief Tests for louvain, with and without Leiden refinement, and modularity
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/louvain.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_double = dynamic_graph<double, void, void, uint32_t, false, vov_graph_traits<double, void, void, uint32_t, false>>;
+using csr_double = compressed_graph<double, void, void, uint32_t, uint32_t>;
+using vov_g      = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+
+using edge_list = edge_list_t<double>;
+
+namespace {
+// Adds u-v in both directions, or a self-loop once
+void add_undirected(edge_list& ee, uint32_t u, uint32_t v, double w) {
+  ee.push_back({u, v, w});
+  if (u != v)
+    ee.push_back({v, u, w});
+}
+
+// A ring of cliques of size k, each joined to the next by one light edge
+edge_list ring_of_cliques(uint32_t cliques, uint32_t k) {
+  edge_list ee;
+  for (uint32_t c = 0; c < cliques; ++c) {
+    for (uint32_t i = 0; i < k; ++i)
+      for (uint32_t j = i + 1; j < k; ++j)
+        add_undirected(ee, c * k + i, c * k + j, 1.0);
+    add_undirected(ee, c * k, ((c + 1) % cliques) * k + 1, 0.5);
+  }
+  sort_by_source(ee);
+  return ee;
+}
+
+// Planted partition: groups of size k with dense random edges inside and sparse ones between,
+// and isolated vertices at the end
+edge_list planted_partition(uint32_t groups, uint32_t k, uint32_t isolated, uint32_t seed) {
+  std::mt19937                           rng(seed);
+  std::uniform_real_distribution<double> weight(0.5, 2.0);
+  std::bernoulli_distribution            inside(0.4);
+  edge_list                              ee;
+  for (uint32_t g = 0; g < groups; ++g)
+    for (uint32_t i = 0; i < k; ++i)
+      for (uint32_t j = i + 1; j < k; ++j)
+        if (inside(rng))
+          add_undirected(ee, g * k + i, g * k + j, weight(rng));
+  for (auto& e : random_edges(groups * k, groups * k / 4, seed + 1))
+    add_undirected(ee, e.source_id, e.target_id, weight(rng));
+  add_undirected(ee, groups * k + isolated - 1, groups * k + isolated - 1, 0.0);
+  sort_by_source(ee);
+  return ee;
+}
+
+// Modularity computed directly from the edge list
+double reference_modularity(const edge_list& ee, uint32_t n, const std::vector<uint32_t>& comm) {
+  std::vector<double> tot(n, 0.0);
+  double              m2 = 0.0, inside = 0.0;
+  for (auto& e : ee) {
+    m2 += e.value;
+    tot[comm[e.source_id]] += e.value;
+    if (comm[e.source_id] == comm[e.target_id])
+      inside += e.value;
+  }
+  double q = inside / m2;
+  for (double t : tot)
+    q -= (t / m2) * (t / m2);
+  return q;
+}
+
+// Every community is connected within itself
+bool connected_communities(const edge_list& ee, uint32_t n, const std::vector<uint32_t>& comm) {
+  graph::detail::union_find<uint32_t> sets(n);
+  for (auto& e : ee)
+    if (comm[e.source_id] == comm[e.target_id])
+      sets.unite(e.source_id, e.target_id);
+  std::vector<uint32_t> root(n, n);
+  for (uint32_t v = 0; v < n; ++v) {
+    uint32_t& r = root.at(comm[v]);
+    if (r == n)
+      r = sets.find(v);
+    else if (r != sets.find(v))
+      return false;
+  }
+  return true;
+}
+
+// Communities are numbered from 0 in the order of their least vertex
+bool numbered_by_first_vertex(const std::vector<uint32_t>& comm, size_t count) {
+  uint32_t next = 0;
+  for (uint32_t c : comm) {
+    if (c > next)
+      return false;
+    next += c == next;
+  }
+  return next == count;
+}
+
+bool close(double a, double b) { return std::abs(a - b) <= 1e-9 * (1.0 + std::abs(a)); }
+} // namespace
+
+TEMPLATE_TEST_CASE("louvain finds a ring of cliques", "[algorithm][louvain]", vov_double, csr_double) {
+  using G = TestType;
+
+  const uint32_t  cliques = 30, k = 8, n = cliques * k;
+  const edge_list ee      = ring_of_cliques(cliques, k);
+  G               g       = make_graph<G>(ee, n);
+
+  for (bool leiden : {false, true}) {
+    std::vector<uint32_t> comm(n, n);
+    REQUIRE(louvain(g, comm, {.leiden = leiden}) == cliques);
+    for (uint32_t v = 0; v < n; ++v)
+      REQUIRE(comm[v] == v / k);
+    REQUIRE(close(modularity(g, comm), reference_modularity(ee, n, comm)));
+  }
+}
+
+TEMPLATE_TEST_CASE("louvain on a planted partition", "[algorithm][louvain]", vov_double, csr_double) {
+  using G = TestType;
+
+  const uint32_t  groups = 40, k = 25, isolated = 10, n = groups * k + isolated;
+  const edge_list ee     = planted_partition(groups, k, isolated, 46);
+  G               g      = make_graph<G>(ee, n);
+
+  std::vector<uint32_t> planted(n);
+  for (uint32_t v = 0; v < n; ++v)
+    planted[v] = v < groups * k ? v / k : groups + (v - groups * k);
+  const double planted_q = reference_modularity(ee, n, planted);
+
+  std::vector<uint32_t> singletons(n);
+  for (uint32_t v = 0; v < n; ++v)
+    singletons[v] = v;
+  REQUIRE(close(modularity(g, singletons), reference_modularity(ee, n, singletons)));
+
+  for (bool leiden : {false, true}) {
+    std::vector<uint32_t> comm(n);
+    const size_t          count = louvain(g, comm, {.leiden = leiden});
+    REQUIRE(numbered_by_first_vertex(comm, count));
+    REQUIRE(count >= groups + isolated - 5);
+    REQUIRE(count <= groups + isolated + 5);
+
+    const double q = modularity(g, comm);
+    REQUIRE(close(q, reference_modularity(ee, n, comm)));
+    REQUIRE(q >= planted_q - 0.01);
+    if (leiden)
+      REQUIRE(connected_communities(ee, n, comm));
+
+    // Isolated vertices stay alone
+    for (uint32_t v = groups * k; v < n; ++v)
+      REQUIRE(std::ranges::count(comm, comm[v]) == 1);
+  }
+
+  // Resolution 0 rewards any merge, so Leiden's communities are the connected components
+  std::vector<uint32_t> comm(n);
+  const size_t          count = louvain(g, comm, {.resolution = 0.0, .leiden = true});
+  REQUIRE(connected_communities(ee, n, comm));
+  REQUIRE(count == 1 + isolated);
+}
+
+TEST_CASE("louvain with a weight function, options and errors", "[algorithm][louvain]") {
+  SECTION("two triangles joined by an edge, unweighted") {
+    vov_g g = make_graph<vov_g>(edge_list_t<>{{0, 1}, {0, 2}, {1, 0}, {1, 2}, {2, 0}, {2, 1}, {2, 3},
+                                              {3, 2}, {3, 4}, {3, 5}, {4, 3}, {4, 5}, {5, 3}, {5, 4}});
+    auto             one = [](auto&&) { return 1.0; };
+    std::vector<int> comm(6);
+    REQUIRE(louvain(g, comm, one) == 2);
+    REQUIRE(comm == std::vector<int>{0, 0, 0, 1, 1, 1});
+    REQUIRE(close(modularity(g, comm, one), 5.0 / 14.0));
+    REQUIRE(close(modularity(g, std::vector<int>(6, 0), one), 0.0));
+
+    // A high resolution keeps every vertex alone; one level with one pass is still a partition
+    REQUIRE(louvain(g, comm, one, {.resolution = 10.0}) == 6);
+    REQUIRE(louvain(g, comm, one, {.max_passes = 1, .max_levels = 1}) >= 2);
+  }
+
+  SECTION("errors and an empty graph") {
+    csr_double       empty;
+    std::vector<int> none;
+    REQUIRE(louvain(empty, none) == 0);
+    REQUIRE(modularity(empty, none) == 0.0);
+
+    csr_double       g(edge_list{{0, 1, 1.0}, {1, 0, 1.0}});
+    std::vector<int> one(1), two(2);
+    REQUIRE_THROWS_AS(louvain(g, one), graph_error);
+    REQUIRE_THROWS_AS(modularity(g, one), graph_error);
+    REQUIRE_THROWS_AS(modularity(g, std::vector<int>{0, 2}), graph_error);
+    REQUIRE_THROWS_AS(modularity(g, std::vector<int>{-1, 0}), graph_error);
+    REQUIRE_THROWS_AS(louvain(g, two, [](auto&&) { return -1.0; }), graph_error);
+
+    // No edge weight: every vertex alone
+    csr_double light(edge_list{{0, 1, 0.0}, {1, 0, 0.0}});
+    REQUIRE(louvain(light, two) == 2);
+    REQUIRE(two == std::vector<int>{0, 1});
+  }
+}
@@ -0,0 +1,157 @@
+/**
+ * @file test_max_flow.cpp
+ * @brief Tests for max_flow by push-relabel
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/max_flow.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <random>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_int    = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false>>;
+using csr_int    = compressed_graph<int, void, void, uint32_t, uint32_t>;
+using csr_double = compressed_graph<double, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<int>;
+
+namespace {
+// Random directed edges with capacities in [1, 20], and some parallel and antiparallel pairs and
+// self-loops, sorted by source
+edge_list random_network(uint32_t n, uint32_t m, uint32_t seed) {
+  edge_list                          ee = random_weighted_edges<int>(n, m, 1, 20, seed);
+  std::mt19937                       rng(seed + 1);
+  std::uniform_int_distribution<int> capacity(1, 20);
+  for (uint32_t i = 0; i < 30; ++i) {
+    const auto a = ee[i * 37 % m], b = ee[(i * 37 + 11) % m];
+    ee.push_back({a.target_id, a.source_id, capacity(rng)});
+    ee.push_back({b.source_id, b.target_id, capacity(rng)});
+  }
+  sort_by_source(ee);
+  return ee;
+}
+
+// Maximum flow value by Edmonds-Karp over a capacity matrix
+long reference_flow(const edge_list& ee, uint32_t n, uint32_t s, uint32_t t) {
+  std::vector<std::vector<long>> cap(n, std::vector<long>(n, 0));
+  for (auto& e : ee)
+    if (e.source_id != e.target_id)
+      cap[e.source_id][e.target_id] += e.value;
+  long total = 0;
+  for (;;) {
+    std::vector<uint32_t> parent(n, n);
+    std::queue<uint32_t>  q;
+    parent[s] = s;
+    q.push(s);
+    while (!q.empty() && parent[t] == n) {
+      const uint32_t u = q.front();
+      q.pop();
+      for (uint32_t v = 0; v < n; ++v)
+        if (parent[v] == n && cap[u][v] > 0) {
+          parent[v] = u;
+          q.push(v);
+        }
+    }
+    if (parent[t] == n)
+      return total;
+    long push = std::numeric_limits<long>::max();
+    for (uint32_t v = t; v != s; v = parent[v])
+      push = std::min(push, cap[parent[v]][v]);
+    for (uint32_t v = t; v != s; v = parent[v]) {
+      cap[parent[v]][v] -= push;
+      cap[v][parent[v]] += push;
+    }
+    total += push;
+  }
+}
+
+// The flows respect the capacities and are conserved everywhere but s and t; returns the net
+// flow out of s
+long check_flows(const edge_list& ee, uint32_t n, uint32_t s, uint32_t t, const std::vector<int>& flows) {
+  std::vector<long> net(n, 0);
+  for (size_t e = 0; e < ee.size(); ++e) {
+    REQUIRE(flows[e] >= 0);
+    REQUIRE(flows[e] <= ee[e].value);
+    net[ee[e].source_id] += flows[e];
+    net[ee[e].target_id] -= flows[e];
+  }
+  for (uint32_t v = 0; v < n; ++v)
+    if (v != s && v != t)
+      REQUIRE(net[v] == 0);
+  REQUIRE(net[s] == -net[t]);
+  return net[s];
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("max_flow matches Edmonds-Karp", "[algorithm][max_flow]", vov_int, csr_int) {
+  using G = TestType;
+
+  const uint32_t  n        = 300;
+  const edge_list ee       = random_network(n, 2400, 48);
+  G               g        = make_graph<G>(ee, n);
+  auto            capacity = [&g](auto&& uv) { return edge_value(g, uv); };
+
+  for (auto [s, t] : {std::pair<uint32_t, uint32_t>{0, 1}, {5, 299}, {150, 7}, {42, 43}}) {
+    const long expected = reference_flow(ee, n, s, t);
+    REQUIRE(expected > 0);
+    for (max_flow_order order : {max_flow_order::highest_label, max_flow_order::fifo})
+      for (double frequency : {1.0, 0.1, 0.0}) {
+        const max_flow_options options{.order = order, .global_relabel_frequency = frequency};
+        REQUIRE(max_flow(g, s, t, capacity, options) == expected);
+
+        std::vector<int> flows(ee.size(), -1);
+        REQUIRE(max_flow(g, s, t, flows, capacity, options) == expected);
+        REQUIRE(check_flows(ee, n, s, t, flows) == expected);
+      }
+  }
+}
+
+TEST_CASE("max_flow on small networks", "[algorithm][max_flow]") {
+  SECTION("the classic CLRS network") {
+    // s=0, t=5; maximum flow 23
+    csr_int g(edge_list{{0, 1, 16}, {0, 2, 13}, {1, 3, 12}, {2, 1, 4}, {2, 4, 14}, {3, 2, 9}, {3, 5, 20}, {4, 3, 7}, {4, 5, 4}});
+    auto    capacity = [&g](auto&& uv) { return edge_value(g, uv); };
+    REQUIRE(max_flow(g, 0u, 5u, capacity) == 23);
+    REQUIRE(max_flow(g, 5u, 0u, capacity) == 0);
+    REQUIRE(max_flow(g, 0u, 5u, capacity, {.order = max_flow_order::fifo}) == 23);
+
+    // Unit capacities: the number of edge-disjoint paths
+    REQUIRE(max_flow(g, 0u, 5u, [](auto&&) { return 1; }) == 2);
+  }
+
+  SECTION("floating point capacities and excess that has to go back to s") {
+    // 0 -> 1 -> 2 -> 3 with a dead end 1 -> 4 and a bottleneck 2 -> 3
+    csr_double g(edge_list_t<double>{
+          {0, 1, 10.0}, {1, 2, 6.5}, {1, 4, 3.0}, {2, 3, 2.5}, {3, 3, 1.0}});
+    auto                capacity = [&g](auto&& uv) { return edge_value(g, uv); };
+    std::vector<double> flows(5);
+    REQUIRE(max_flow(g, 0u, 3u, flows, capacity) == 2.5);
+    REQUIRE(flows == std::vector<double>{2.5, 2.5, 0.0, 2.5, 0.0});
+  }
+
+  SECTION("errors") {
+    csr_int g(edge_list{{0, 1, 1}, {1, 2, 1}});
+    auto    capacity = [&g](auto&& uv) { return edge_value(g, uv); };
+    REQUIRE_THROWS_AS(max_flow(g, 0u, 0u, capacity), graph_error);
+    REQUIRE_THROWS_AS(max_flow(g, 0u, 3u, capacity), graph_error);
+    REQUIRE_THROWS_AS(max_flow(g, 0u, 2u, [](auto&&) { return -1; }), graph_error);
+    std::vector<int> one(1);
+    REQUIRE_THROWS_AS(max_flow(g, 0u, 2u, one, capacity), graph_error);
+
+    // flows is checked before any capacity is read
+    int reads = 0;
+    REQUIRE_THROWS_AS(max_flow(g, 0u, 2u, one, [&](auto&& uv) { return ++reads, edge_value(g, uv); }), graph_error);
+    REQUIRE(reads == 0);
+  }
+}
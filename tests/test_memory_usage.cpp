@@ -0,0 +1,137 @@
+/**
+ * @file test_memory_usage.cpp
+ * @brief Tests for memory_usage(g) on dynamic_graph and compressed_graph
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vofl_graph_traits.hpp>
+#include <graph/container/traits/vol_graph_traits.hpp>
+#include <graph/container/traits/vod_graph_traits.hpp>
+#include <graph/container/traits/vos_graph_traits.hpp>
+#include <graph/container/traits/vob_graph_traits.hpp>
+#include <graph/container/traits/mos_graph_traits.hpp>
+#include <graph/container/traits/uov_graph_traits.hpp>
+#include <graph/container/traits/vov_bidirectional_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using graph::container::detail::container_node_bytes;
+using graph::container::detail::heap_block_bytes;
+
+template <template <class, class, class, class, bool> class Traits>
+using graph_of = dynamic_graph<double, int, void, uint32_t, false, Traits<double, int, void, uint32_t, false>>;
+
+using vov_g  = graph_of<vov_graph_traits>;
+using vofl_g = graph_of<vofl_graph_traits>;
+using vol_g  = graph_of<vol_graph_traits>;
+using vod_g  = graph_of<vod_graph_traits>;
+using vos_g  = graph_of<vos_graph_traits>;
+using vob_g  = graph_of<vob_graph_traits>;
+using mos_g  = graph_of<mos_graph_traits>;
+using uov_g  = graph_of<uov_graph_traits>;
+
+namespace {
+std::vector<copyable_edge_t<uint32_t, double>> sample_edges() {
+  std::vector<copyable_edge_t<uint32_t, double>> ee;
+  for (uint32_t u = 0; u < 100; ++u)
+    for (uint32_t k = 1; k <= 3; ++k)
+      ee.push_back({u, (u + k) % 100, 1.0 * u});
+  return ee;
+}
+} // namespace
+
+TEST_CASE("graph_memory_usage total", "[memory_usage]") {
+  graph_memory_usage mu{1, 2, 3, 4, 5, 6};
+  REQUIRE(mu.total() == 21);
+  mu += mu;
+  REQUIRE(mu.total() == 42);
+  REQUIRE(mu == graph_memory_usage{2, 4, 6, 8, 10, 12});
+}
+
+TEMPLATE_TEST_CASE("dynamic_graph memory_usage", "[memory_usage][dynamic_graph]", vov_g, vofl_g, vol_g, vod_g, vos_g,
+                   vob_g, mos_g, uov_g) {
+  using G = TestType;
+
+  SECTION("empty graph") {
+    G    g;
+    auto mu = memory_usage(g);
+    REQUIRE(mu.edges == 0);
+    REQUIRE(mu.edge_values == 0);
+    REQUIRE(mu.vertex_values == 0);
+  }
+
+  SECTION("values are counted once per element") {
+    G g;
+    g.load_edges(sample_edges());
+    auto mu = memory_usage(g);
+    REQUIRE(mu.vertex_values == num_vertices(g) * sizeof(int));
+    REQUIRE(mu.edge_values == num_edges(g) * sizeof(double));
+    REQUIRE(mu.vertices >= num_vertices(g) * (sizeof(typename G::vertex_type) - sizeof(int)));
+    REQUIRE(mu.edges >= num_edges(g) * (sizeof(typename G::edge_type) - sizeof(double)));
+    REQUIRE(mu.total() == mu.vertices + mu.edges + mu.vertex_values + mu.edge_values + mu.partitions + mu.slack);
+  }
+
+  SECTION("doesn't change when nothing changes") {
+    G g;
+    g.load_edges(sample_edges());
+    REQUIRE(memory_usage(g) == memory_usage(g));
+  }
+}
+
+TEST_CASE("memory_usage of node-based edges", "[memory_usage][dynamic_graph]") {
+  vofl_g g;
+  g.load_edges(sample_edges());
+  auto mu = memory_usage(g);
+  REQUIRE(mu.edges + mu.edge_values == num_edges(g) * container_node_bytes<vofl_g::edges_type>());
+
+  vol_g h;
+  h.load_edges(sample_edges());
+  REQUIRE(memory_usage(h).edges + memory_usage(h).edge_values ==
+          num_edges(h) * heap_block_bytes(2 * sizeof(void*) + sizeof(vol_g::edge_type)));
+}
+
+TEST_CASE("memory_usage reports reserved capacity as slack", "[memory_usage][dynamic_graph]") {
+  vov_g g;
+  g.load_edges(sample_edges());
+  const auto before = memory_usage(g);
+
+  auto u0 = *find_vertex(g, uint32_t(0));
+  u0.inner_value(g).edges().reserve(1000);
+  const auto after = memory_usage(g);
+  REQUIRE(after.slack >= before.slack + (1000 - 3) * sizeof(vov_g::edge_type));
+  REQUIRE(after.edges - before.edges < heap_block_bytes(1));
+  REQUIRE(after.edge_values == before.edge_values);
+}
+
+TEST_CASE("memory_usage includes in-edges", "[memory_usage][dynamic_graph][in_edges]") {
+  using bidir_g = dynamic_graph<void, void, void, uint32_t, false, vov_bidirectional_graph_traits<>>;
+  using plain_g = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<>>;
+  std::vector<copyable_edge_t<uint32_t, void>> ee;
+  for (auto& e : sample_edges())
+    ee.push_back({e.source_id, e.target_id});
+  bidir_g a;
+  plain_g b;
+  a.load_edges(ee);
+  b.load_edges(ee);
+  REQUIRE(memory_usage(a).edges >= memory_usage(b).edges + num_edges(a) * sizeof(uint32_t));
+}
+
+TEST_CASE("compressed_graph memory_usage", "[memory_usage][compressed_graph]") {
+  using G = compressed_graph<double, int, void, uint32_t, uint32_t>;
+  G    g(sample_edges());
+  auto mu = memory_usage(g);
+  REQUIRE(mu.edges >= num_edges(g) * sizeof(uint32_t));
+  REQUIRE(mu.edges < num_edges(g) * sizeof(uint32_t) + heap_block_bytes(1));
+  REQUIRE(mu.vertices >= (num_vertices(g) + 1) * sizeof(uint32_t));
+  REQUIRE(mu.edge_values == num_edges(g) * sizeof(double));
+  REQUIRE(mu.partitions > 0);
+
+  G empty;
+  REQUIRE(memory_usage(empty).edges == 0);
+  REQUIRE(memory_usage(empty).edge_values == 0);
+}
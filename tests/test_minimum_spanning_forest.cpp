@@ -0,0 +1,220 @@
+/**
+ * @file test_minimum_spanning_forest.cpp
+ * @brief Tests for minimum_spanning_forest by Kruskal and by parallel Borůvka
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/minimum_spanning_forest.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vol_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <random>
+#include <functional>
+#include <ranges>
+#include <tuple>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_int = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false>>;
+using vol_int = dynamic_graph<int, void, void, uint32_t, false, vol_graph_traits<int, void, void, uint32_t, false>>;
+using csr_int = compressed_graph<int, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<int>;
+
+namespace {
+// Random weighted edges with few distinct weights, so ties are common; in both directions when
+// symmetric; sorted by source. Vertices [n - 20, n) only have edges among themselves.
+edge_list island_edges(uint32_t n, uint32_t m, bool symmetric, uint32_t seed) {
+  std::mt19937                       rng(seed);
+  std::uniform_int_distribution<int> weight(1, 20);
+  edge_list                          ee;
+  auto                               add = [&](uint32_t u, uint32_t v) {
+    const int w = weight(rng);
+    ee.push_back({u, v, w});
+    if (symmetric)
+      ee.push_back({v, u, w});
+  };
+  for (auto& e : random_edges(n - 20, m, seed + 1))
+    add(e.source_id, e.target_id);
+  for (auto& e : random_edges(20, 15, seed + 2))
+    add(n - 20 + e.source_id, n - 20 + e.target_id);
+  sort_by_source(ee);
+  return ee;
+}
+
+// Total weight of a minimum spanning forest and its number of edges, by Prim from every unreached vertex
+std::pair<long, size_t> reference_forest(const edge_list& ee, uint32_t n) {
+  std::vector<std::vector<std::pair<uint32_t, int>>> adj(n);
+  for (auto& e : ee) {
+    adj[e.source_id].push_back({e.target_id, e.value});
+    adj[e.target_id].push_back({e.source_id, e.value});
+  }
+  std::vector<bool> in(n, false);
+  long              total = 0;
+  size_t            edges = 0;
+  for (uint32_t root = 0; root < n; ++root) {
+    if (in[root])
+      continue;
+    std::vector<std::tuple<int, uint32_t>> heap{{0, root}};
+    bool                                   first = true;
+    while (!heap.empty()) {
+      std::ranges::pop_heap(heap, std::greater<>());
+      auto [w, v] = heap.back();
+      heap.pop_back();
+      if (in[v])
+        continue;
+      in[v] = true;
+      if (!first) {
+        total += w;
+        ++edges;
+      }
+      first = false;
+      for (auto [t, wt] : adj[v])
+        if (!in[t]) {
+          heap.push_back({wt, t});
+          std::ranges::push_heap(heap, std::greater<>());
+        }
+    }
+  }
+  return {total, edges};
+}
+
+// The edges are a forest: no edge joins two vertices that are already connected
+bool is_forest(const std::vector<std::pair<uint32_t, uint32_t>>& edges, uint32_t n) {
+  graph::detail::union_find<uint32_t> sets(n);
+  for (auto [u, v] : edges)
+    if (!sets.unite(u, v))
+      return false;
+  return true;
+}
+} // namespace
+
+TEST_CASE("parallel_sort", "[algorithm][minimum_spanning_forest]") {
+  std::mt19937     rng(2);
+  std::vector<int> values(10007);
+  for (int& x : values)
+    x = static_cast<int>(rng() % 1000);
+  std::vector<int> expected = values;
+  std::ranges::sort(expected);
+
+  for (size_t grain : {size_t{1}, size_t{100}, size_t{5000}, size_t{1} << 20}) {
+    std::vector<int> sorted = values;
+    graph::detail::parallel_sort(sorted.begin(), sorted.end(), std::ranges::less{}, grain);
+    REQUIRE(sorted == expected);
+  }
+  std::vector<int> descending = values;
+  graph::detail::parallel_sort(descending.begin(), descending.end(), std::greater<>{}, 100);
+  REQUIRE(std::ranges::equal(descending, expected | std::views::reverse));
+}
+
+TEST_CASE("minimum_spanning_forest of an edgelist by Kruskal", "[algorithm][minimum_spanning_forest]") {
+  const uint32_t  n  = 2000;
+  const edge_list ee = island_edges(n, 6000, false, 8);
+
+  edgelist<uint32_t, int> el(n);
+  for (auto& e : ee)
+    el.add_edge(e.source_id, e.target_id, e.value);
+
+  const auto [expected_weight, expected_edges] = reference_forest(ee, n);
+
+  std::vector<size_t> forest(n - 1);
+  const size_t        k = minimum_spanning_forest(el, forest);
+  REQUIRE(k == expected_edges);
+  REQUIRE(std::ranges::is_sorted(forest.begin(), forest.begin() + static_cast<std::ptrdiff_t>(k)));
+
+  long                                       total = 0;
+  std::vector<std::pair<uint32_t, uint32_t>> pairs;
+  for (size_t i = 0; i < k; ++i) {
+    auto& e = ee.at(forest[i]);
+    total += e.value;
+    pairs.push_back({e.source_id, e.target_id});
+  }
+  REQUIRE(total == expected_weight);
+  REQUIRE(is_forest(pairs, n));
+
+  // Negated weights give a maximum spanning forest
+  std::vector<size_t> heaviest(n - 1);
+  REQUIRE(minimum_spanning_forest(el, heaviest, [](const auto& e) { return -e.value; }) == k);
+  long heavy_total = 0;
+  for (size_t i = 0; i < k; ++i)
+    heavy_total += ee.at(heaviest[i]).value;
+  REQUIRE(heavy_total > total);
+}
+
+TEMPLATE_TEST_CASE("minimum_spanning_forest of a graph by Borůvka",
+                   "[algorithm][minimum_spanning_forest]",
+                   vov_int,
+                   vol_int,
+                   csr_int) {
+  using G = TestType;
+
+  for (bool symmetric : {false, true}) {
+    const uint32_t  n  = 2000;
+    const edge_list ee = island_edges(n, 6000, symmetric, 8);
+    G               g  = make_graph<G>(ee, n);
+
+    const auto [expected_weight, expected_edges] = reference_forest(ee, n);
+
+    std::vector<uint32_t> forest(n - 1);
+    const size_t          k = minimum_spanning_forest(g, forest);
+    REQUIRE(k == expected_edges);
+    REQUIRE(std::ranges::is_sorted(forest.begin(), forest.begin() + static_cast<std::ptrdiff_t>(k)));
+
+    // Edge indices of a graph loaded from edges sorted by source are positions in the edge list
+    long                                       total = 0;
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+    for (size_t i = 0; i < k; ++i) {
+      auto& e = ee.at(forest[i]);
+      total += e.value;
+      pairs.push_back({e.source_id, e.target_id});
+    }
+    REQUIRE(total == expected_weight);
+    REQUIRE(is_forest(pairs, n));
+
+    // Kruskal and Borůvka break ties the same way, so with one copy of each edge they pick the same edges
+    if (!symmetric) {
+      edgelist<uint32_t, int> el(n);
+      for (auto& e : ee)
+        el.add_edge(e.source_id, e.target_id, e.value);
+      std::vector<uint32_t> kruskal(n - 1);
+      REQUIRE(minimum_spanning_forest(el, kruskal) == k);
+      REQUIRE(kruskal == forest);
+    }
+  }
+}
+
+TEST_CASE("minimum_spanning_forest on small inputs", "[algorithm][minimum_spanning_forest]") {
+  SECTION("a weight function and a triangle") {
+    // Triangle 0-1-2 with weights 3, 1, 2 and a self-loop
+    csr_int          g(edge_list{{0, 1, 3}, {0, 0, 0}, {1, 2, 1}, {2, 0, 2}});
+    std::vector<int> forest(2);
+    REQUIRE(minimum_spanning_forest(g, forest) == 2);
+    REQUIRE(forest == std::vector<int>{2, 3});
+    REQUIRE(minimum_spanning_forest(g, forest, [](const auto&) { return 1; }) == 2);
+    REQUIRE(forest == std::vector<int>{0, 2}); // ties go to the smaller index
+  }
+
+  SECTION("errors and empty inputs") {
+    csr_int          empty;
+    std::vector<int> none;
+    REQUIRE(minimum_spanning_forest(empty, none) == 0);
+    edgelist<uint32_t, int> no_edges;
+    REQUIRE(minimum_spanning_forest(no_edges, none) == 0);
+
+    csr_int g(edge_list{{0, 1, 1}, {1, 2, 1}});
+    REQUIRE_THROWS_AS(minimum_spanning_forest(g, std::vector<int>(1)), graph_error);
+
+    edgelist<uint32_t, int> el;
+    el.add_edge(0, 5, 1);
+    el.set_num_vertices(3);
+    std::vector<int> two(2);
+    REQUIRE_THROWS_AS(minimum_spanning_forest(el, two), graph_error);
+  }
+}
@@ -0,0 +1,141 @@
+/**
+ * @file test_multi_source_bfs.cpp
+ * @brief Tests for multi_source_bfs, the batched bit-parallel BFS
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/multi_source_bfs.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vov_bidirectional_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <queue>
+#include <random>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_g   = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using bidir_g = dynamic_graph<void, void, void, uint32_t, false,
+                              vov_bidirectional_graph_traits<void, void, void, uint32_t, false>>;
+using csr_g   = compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<>;
+
+namespace {
+// Random graph with n vertices and about n*avg_degree edges, and a self-loop on the last vertex so
+// every vertex exists
+edge_list random_graph(uint32_t n, uint32_t avg_degree, bool symmetric, uint32_t seed) {
+  edge_list ee = random_edges(n, n * avg_degree / (symmetric ? 2 : 1), symmetric, seed);
+  ee.push_back({n - 1, n - 1});
+  return ee;
+}
+
+template <class G>
+std::vector<int> reference_levels(G& g, uint32_t seed) {
+  std::vector<int>     level(num_vertices(g), -1);
+  std::queue<uint32_t> q;
+  level[seed] = 0;
+  q.push(seed);
+  while (!q.empty()) {
+    uint32_t uid = q.front();
+    q.pop();
+    for (auto uv : edges(g, *find_vertex(g, uid))) {
+      auto vid = static_cast<uint32_t>(target_id(g, uv));
+      if (level[vid] < 0) {
+        level[vid] = level[uid] + 1;
+        q.push(vid);
+      }
+    }
+  }
+  return level;
+}
+
+// Runs multi_source_bfs and checks every source's levels against a sequential BFS, and that each
+// (source, vertex) pair is visited once
+template <class G>
+void require_reference_levels(G& g, const std::vector<uint32_t>& sources, const multi_source_bfs_options& options) {
+  const size_t        n = num_vertices(g);
+  std::vector<int>    levels(sources.size() * n, -1);
+  std::atomic<size_t> calls{0};
+  const size_t        reached = multi_source_bfs(g, sources, [&](size_t i, uint32_t vid, size_t depth) {
+    levels.at(i * n + vid) = static_cast<int>(depth);
+    calls.fetch_add(1, std::memory_order_relaxed);
+  }, options);
+  REQUIRE(reached == calls.load());
+
+  size_t expected_reached = 0;
+  for (size_t i = 0; i < sources.size(); ++i) {
+    const auto expected = reference_levels(g, sources[i]);
+    expected_reached += static_cast<size_t>(std::ranges::count_if(expected, [](int l) { return l >= 0; }));
+    REQUIRE(std::ranges::equal(levels.begin() + static_cast<std::ptrdiff_t>(i * n),
+                               levels.begin() + static_cast<std::ptrdiff_t>((i + 1) * n), expected.begin(),
+                               expected.end()));
+  }
+  REQUIRE(reached == expected_reached);
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("multi_source_bfs matches a BFS per source", "[algorithm][multi_source_bfs]", vov_g, bidir_g, csr_g) {
+  using G = TestType;
+
+  const uint32_t n = 2000;
+  for (bool symmetric : {false, true}) {
+    G g = make_graph<G>(random_graph(n, 6, symmetric, 49));
+
+    // 300 sources with repeats: two batches of 256, or five of 64
+    std::mt19937                            rng(symmetric ? 1 : 2);
+    std::uniform_int_distribution<uint32_t> pick(0, n - 1);
+    std::vector<uint32_t>                   sources(300);
+    for (auto& s : sources)
+      s = pick(rng);
+    sources[1] = sources[0];
+
+    // Default heuristics, pull whenever possible, and push only
+    for (multi_source_bfs_options opt :
+         {multi_source_bfs_options{.symmetric = symmetric}, multi_source_bfs_options{.batch_size = 64, .alpha = 1e9},
+          multi_source_bfs_options{.batch_size = 100, .symmetric = symmetric, .alpha = 1e-9}})
+      require_reference_levels(g, sources, opt);
+  }
+}
+
+TEST_CASE("multi_source_bfs pulls over the in-edges of a compressed_graph", "[algorithm][multi_source_bfs]") {
+  csr_g g = make_graph<csr_g>(random_graph(3000, 8, false, 49));
+  g.build_in_edges();
+  std::vector<uint32_t> sources(130);
+  for (uint32_t i = 0; i < sources.size(); ++i)
+    sources[i] = i * 23;
+
+  for (multi_source_bfs_options opt : {multi_source_bfs_options{}, multi_source_bfs_options{.alpha = 1e-9}})
+    require_reference_levels(g, sources, opt);
+}
+
+TEST_CASE("multi_source_bfs on a small graph", "[algorithm][multi_source_bfs]") {
+  //  0 -> 1 -> 2 -> 3,  0 -> 4 -> 3,  5 -> 0
+  vov_g g = make_graph<vov_g>({{0, 1}, {0, 4}, {1, 2}, {2, 3}, {4, 3}, {5, 0}});
+
+  // Sources from any input range; closeness-style sums of distances per source
+  const std::list<uint32_t> sources{5, 3, 0};
+  std::vector<int>          total(3, 0), count(3, 0);
+  REQUIRE(multi_source_bfs(g, sources, [&](size_t i, uint32_t, size_t depth) {
+    std::atomic_ref(total.at(i)).fetch_add(static_cast<int>(depth));
+    std::atomic_ref(count.at(i)).fetch_add(1);
+  }) == 6 + 1 + 5);
+  REQUIRE(total == std::vector<int>{1 + 2 + 2 + 3 + 3, 0, 1 + 1 + 2 + 2});
+  REQUIRE(count == std::vector<int>{6, 1, 5});
+
+  // No sources, and errors
+  REQUIRE(multi_source_bfs(g, std::vector<uint32_t>{}, [](size_t, uint32_t, size_t) { FAIL(); }) == 0);
+  REQUIRE_THROWS_AS(multi_source_bfs(g, std::vector<uint32_t>{0, 6}, [](size_t, uint32_t, size_t) {}), graph_error);
+  REQUIRE_THROWS_AS(multi_source_bfs(g, std::vector<int>{-1}, [](size_t, uint32_t, size_t) {}), graph_error);
+  // A wider id is checked before it's narrowed, so 2^32 + 1 doesn't wrap around to vertex 1
+  REQUIRE_THROWS_AS(multi_source_bfs(g, std::vector<uint64_t>{(uint64_t{1} << 32) + 1}, [](size_t, uint32_t, size_t) {}),
+                    graph_error);
+}
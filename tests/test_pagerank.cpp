@@ -0,0 +1,143 @@
+/**
+ * @file test_pagerank.cpp
+ * @brief Tests for the pull-based pagerank
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/pagerank.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vov_bidirectional_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_g   = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using bidir_g = dynamic_graph<void, void, void, uint32_t, false,
+                              vov_bidirectional_graph_traits<void, void, void, uint32_t, false>>;
+using csr_g   = compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<>;
+
+namespace {
+// Random edges with skewed in-degrees and, unless symmetric, some vertices without out-edges
+edge_list skewed_edges(uint32_t n, uint32_t m, bool symmetric, uint32_t seed) {
+  edge_list ee;
+  for (auto e : random_edges(n, m, seed)) {
+    if (!symmetric && e.source_id % 10 == 0)
+      continue; // dangling
+    if (e.target_id % 3 == 0)
+      e.target_id %= 16;
+    ee.push_back(e);
+    if (symmetric)
+      ee.push_back({e.target_id, e.source_id});
+  }
+  ee.push_back({n - 1, n - 1});
+  sort_by_source(ee);
+  return ee;
+}
+
+// Sequential push-based power iteration for a fixed number of iterations
+std::vector<double> reference_ranks(const edge_list& ee, uint32_t n, double damping, size_t iterations) {
+  std::vector<size_t> out_degree(n);
+  for (auto& e : ee)
+    ++out_degree[e.source_id];
+  std::vector<double> rank(n, 1.0 / n), next(n);
+  for (size_t it = 0; it < iterations; ++it) {
+    double dangling = 0;
+    for (uint32_t u = 0; u < n; ++u)
+      if (out_degree[u] == 0)
+        dangling += rank[u];
+    std::ranges::fill(next, (1 - damping) / n + damping * dangling / n);
+    for (auto& e : ee)
+      next[e.target_id] += damping * rank[e.source_id] / static_cast<double>(out_degree[e.source_id]);
+    rank.swap(next);
+  }
+  return rank;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("pagerank matches power iteration", "[algorithm][pagerank]", vov_g, bidir_g, csr_g) {
+  using G            = TestType;
+  const uint32_t  n  = 5000;
+  const bool      sym = GENERATE(false, true);
+  const edge_list ee  = skewed_edges(n, 40000, sym, 9);
+  G               g   = make_graph<G>(ee);
+  REQUIRE(num_vertices(g) == n);
+  if constexpr (std::is_same_v<G, csr_g>)
+    g.build_in_edges();
+
+  std::vector<double> ranks(n);
+  if constexpr (std::is_same_v<G, vov_g>) {
+    if (!sym) {
+      // Without in_edges only a symmetric graph can be pulled from
+      REQUIRE_THROWS_AS(pagerank(g, ranks), graph_error);
+      return;
+    }
+  }
+
+  const auto expected = reference_ranks(ee, n, 0.85, 20);
+  REQUIRE(pagerank(g, ranks, {.tolerance = 0, .max_iterations = 20, .symmetric = sym}) == 20);
+  for (uint32_t v = 0; v < n; ++v)
+    REQUIRE(std::abs(ranks[v] - expected[v]) < 1e-12);
+
+  std::vector<float> franks(n);
+  REQUIRE(pagerank(g, franks, {.tolerance = 0, .max_iterations = 20, .symmetric = sym}) == 20);
+  for (uint32_t v = 0; v < n; ++v)
+    REQUIRE(std::abs(static_cast<double>(franks[v]) - expected[v]) < 1e-5);
+  REQUIRE(std::abs(std::accumulate(franks.begin(), franks.end(), 0.0) - 1.0) < 1e-3);
+}
+
+TEST_CASE("pagerank convergence", "[algorithm][pagerank]") {
+  const uint32_t  n  = 3000;
+  const edge_list ee = skewed_edges(n, 30000, false, 9);
+  csr_g           g  = make_graph<csr_g>(ee);
+
+  std::vector<double> ranks(n);
+  REQUIRE_THROWS_AS(pagerank(g, ranks), graph_error); // in-edges not built yet
+  g.build_in_edges();
+  const size_t        iterations = pagerank(g, ranks, {.tolerance = 1e-10});
+  REQUIRE(iterations > 1);
+  REQUIRE(iterations < 100);
+
+  const auto expected = reference_ranks(ee, n, 0.85, 200);
+  for (uint32_t v = 0; v < n; ++v)
+    REQUIRE(std::abs(ranks[v] - expected[v]) < 1e-10);
+  REQUIRE(std::abs(std::accumulate(ranks.begin(), ranks.end(), 0.0) - 1.0) < 1e-9);
+}
+
+TEST_CASE("pagerank small graphs", "[algorithm][pagerank]") {
+  // A directed cycle ranks every vertex the same
+  csr_g               cycle(edge_list{{0, 1}, {1, 2}, {2, 3}, {3, 0}});
+  std::vector<double> ranks(4);
+  cycle.build_in_edges();
+  REQUIRE(pagerank(cycle, ranks) == 1);
+  for (double r : ranks)
+    REQUIRE(std::abs(r - 0.25) < 1e-15);
+
+  // No damping: every vertex gets the teleport probability
+  csr_g star(edge_list{{1, 0}, {2, 0}, {3, 0}});
+  star.build_in_edges();
+  REQUIRE(pagerank(star, ranks, {.damping = 0}) == 1);
+  for (double r : ranks)
+    REQUIRE(std::abs(r - 0.25) < 1e-15);
+
+  pagerank(star, ranks, {.tolerance = 1e-12});
+  REQUIRE(ranks[0] > ranks[1]);
+  REQUIRE(std::abs(ranks[1] - ranks[3]) < 1e-15);
+
+  REQUIRE(pagerank(csr_g(), ranks) == 0);
+
+  std::vector<double> small(3);
+  REQUIRE_THROWS_AS(pagerank(cycle, small), graph_error);
+  REQUIRE_THROWS_AS(pagerank(cycle, ranks, {.damping = 1.5}), graph_error);
+  REQUIRE_THROWS_AS(pagerank(cycle, ranks, {.tolerance = -1}), graph_error);
+}
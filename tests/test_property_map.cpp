@@ -0,0 +1,177 @@
+/**
+ * @file test_property_map.cpp
+ * @brief Tests for vertex_property_map and edge_property_map
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/property_map.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vofl_graph_traits.hpp>
+#include <graph/container/traits/mos_graph_traits.hpp>
+#include <graph/container/traits/uov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+using vov_g  = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false>>;
+using vofl_g = dynamic_graph<int, void, void, uint32_t, false, vofl_graph_traits<int, void, void, uint32_t, false>>;
+using mos_g  = dynamic_graph<int, void, void, uint32_t, false, mos_graph_traits<int, void, void, uint32_t, false>>;
+using uov_g  = dynamic_graph<int, void, void, uint32_t, false, uov_graph_traits<int, void, void, uint32_t, false>>;
+using vov_ts = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false, true>>;
+using csr_g  = compressed_graph<int, void, void, uint32_t, uint32_t>;
+
+namespace {
+// Vertex u has edges to u+1..u+(u%4), modulo n, with value u*10+k
+std::vector<copyable_edge_t<uint32_t, int>> sample_edges(uint32_t n) {
+  std::vector<copyable_edge_t<uint32_t, int>> ee;
+  for (uint32_t u = 0; u < n; ++u)
+    for (uint32_t k = 1; k <= u % 4; ++k)
+      ee.push_back({u, (u + k) % n, static_cast<int>(u * 10 + k)});
+  return ee;
+}
+
+template <class G>
+G make_graph(uint32_t n) {
+  if constexpr (std::is_same_v<G, csr_g>) {
+    return G(sample_edges(n));
+  } else {
+    G g;
+    g.load_edges(sample_edges(n));
+    return g;
+  }
+}
+} // namespace
+
+TEST_CASE("property map storage selection", "[property_map]") {
+  STATIC_REQUIRE(vertex_property_map<vov_g, int>::is_indexed);
+  STATIC_REQUIRE(vertex_property_map<csr_g, int>::is_indexed);
+  STATIC_REQUIRE_FALSE(vertex_property_map<mos_g, int>::is_indexed);
+  STATIC_REQUIRE_FALSE(vertex_property_map<uov_g, int>::is_indexed);
+
+  STATIC_REQUIRE(edge_property_map<vov_g, int>::is_indexed);
+  STATIC_REQUIRE(edge_property_map<uov_g, int>::is_indexed);
+  STATIC_REQUIRE(edge_property_map<csr_g, int>::is_indexed);
+  STATIC_REQUIRE_FALSE(edge_property_map<vofl_g, int>::is_indexed);
+  STATIC_REQUIRE_FALSE(edge_property_map<mos_g, int>::is_indexed);
+}
+
+TEMPLATE_TEST_CASE("vertex_property_map", "[property_map]", vov_g, vofl_g, mos_g, uov_g, csr_g) {
+  using G = TestType;
+  G g = make_graph<G>(50);
+
+  vertex_property_map<G, int> m(g, -1);
+  REQUIRE(m.size() == num_vertices(g));
+  REQUIRE(std::ranges::all_of(m, [](int x) { return x == -1; }));
+
+  std::set<size_t> indexes;
+  for (auto u : vertices(g)) {
+    indexes.insert(m.index_of(u));
+    m[u] = static_cast<int>(vertex_id(g, u));
+  }
+  REQUIRE(indexes.size() == num_vertices(g));
+  REQUIRE(*indexes.rbegin() == num_vertices(g) - 1);
+
+  for (uint32_t uid = 0; uid < 50; ++uid)
+    REQUIRE(m[uid] == static_cast<int>(uid));
+
+  // Descriptors of a const graph address the same values
+  const G& cg = g;
+  for (auto u : vertices(cg))
+    REQUIRE(m[u] == static_cast<int>(vertex_id(cg, u)));
+
+  m.fill(7);
+  auto it3 = find_vertex(g, uint32_t(3));
+  REQUIRE(it3 != std::ranges::end(vertices(g)));
+  REQUIRE(m[*it3] == 7);
+}
+
+TEST_CASE("vertex_property_map of a keyed graph rejects unknown vertices", "[property_map]") {
+  mos_g                           g = make_graph<mos_g>(10);
+  vertex_property_map<mos_g, int> m(g);
+  REQUIRE_THROWS_AS(m[uint32_t(99)], graph_error);
+}
+
+TEMPLATE_TEST_CASE("edge_property_map", "[property_map]", vov_g, vofl_g, mos_g, uov_g, csr_g) {
+  using G = TestType;
+  G g = make_graph<G>(50);
+
+  edge_property_map<G, int> m(g, 0);
+  REQUIRE(m.size() == num_edges(g));
+
+  std::set<size_t> indexes;
+  for (auto u : vertices(g)) {
+    for (auto uv : edges(g, u)) {
+      indexes.insert(m.index_of(uv));
+      m[uv] = edge_value(g, uv);
+    }
+  }
+  REQUIRE(indexes.size() == num_edges(g));
+  REQUIRE(*indexes.rbegin() == num_edges(g) - 1);
+
+  const G& cg = g;
+  for (auto u : vertices(cg))
+    for (auto uv : edges(cg, u))
+      REQUIRE(m[uv] == edge_value(cg, uv));
+}
+
+TEST_CASE("edge_property_map keeps room for dead edges", "[property_map][tombstone]") {
+  vov_ts g = make_graph<vov_ts>(20);
+  REQUIRE(g.erase_edge(3, 4));
+  REQUIRE(g.erase_edge(7, 10));
+
+  edge_property_map<vov_ts, int> m(g, 0);
+  REQUIRE(m.size() >= num_edges(g));
+  std::set<size_t> indexes;
+  for (auto u : vertices(g))
+    for (auto uv : edges(g, u))
+      REQUIRE(indexes.insert(m.index_of(uv)).second);
+  REQUIRE(indexes.size() == num_edges(g));
+  REQUIRE(*indexes.rbegin() < m.size());
+}
+
+TEST_CASE("property maps initialize large graphs in parallel", "[property_map][parallel]") {
+  const uint32_t n = 100000;
+  vov_g          g = make_graph<vov_g>(n);
+
+  vertex_property_map<vov_g, double> dist(g, 1.5);
+  REQUIRE(dist.size() == n);
+  REQUIRE(std::ranges::all_of(dist, [](double x) { return x == 1.5; }));
+
+  // Flags are bytes rather than bits, so threads filling neighboring elements don't share a word
+  edge_property_map<vov_g, uint8_t> seen(g, uint8_t{1});
+  REQUIRE(seen.size() == num_edges(g));
+  REQUIRE(std::ranges::all_of(seen, [](uint8_t x) { return x == 1; }));
+}
+
+TEST_CASE("property map atomic access", "[property_map][parallel]") {
+  vov_g                           g = make_graph<vov_g>(64);
+  vertex_property_map<vov_g, int> in_degree(g, 0);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([&] {
+      for (auto u : vertices(g))
+        for (auto uv : edges(g, u))
+          in_degree.atomic(target(g, uv)).fetch_add(1, std::memory_order_relaxed);
+    });
+  for (auto& t : threads)
+    t.join();
+
+  size_t total = 0;
+  for (int d : in_degree)
+    total += static_cast<size_t>(d);
+  REQUIRE(total == 4 * num_edges(g));
+
+  uov_g                         h = make_graph<uov_g>(8);
+  edge_property_map<uov_g, int> hits(h, 0);
+  for (auto u : vertices(h))
+    for (auto uv : edges(h, u))
+      hits.atomic(uv).store(1);
+  REQUIRE(std::ranges::count(hits, 1) == static_cast<std::ptrdiff_t>(num_edges(h)));
+}
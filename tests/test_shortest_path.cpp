@@ -0,0 +1,206 @@
+/**
+ * @file test_shortest_path.cpp
+ * @brief Tests for the point-to-point shortest_path (bidirectional Dijkstra) and astar_shortest_path
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/shortest_path.hpp>
+#include <graph/algorithm/dijkstra_shortest_paths.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vov_bidirectional_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using bidir_double = dynamic_graph<double, void, void, uint32_t, false,
+                                   vov_bidirectional_graph_traits<double, void, void, uint32_t, false>>;
+using vov_uint     = dynamic_graph<uint32_t, void, void, uint32_t, false, vov_graph_traits<uint32_t, void, void, uint32_t, false>>;
+using csr_double   = compressed_graph<double, void, void, uint32_t, uint32_t>;
+
+template <class EV>
+using edge_list = edge_list_t<EV>;
+
+namespace {
+// Random directed edges with weights in [0, max_weight], with parallel edges, sorted by source
+template <class EV>
+edge_list<EV> parallel_edges(uint32_t n, uint32_t m, uint32_t max_weight, uint32_t seed) {
+  edge_list<EV>                           ee = random_weighted_edges<EV>(n, m, 0, max_weight, seed);
+  std::mt19937                            rng(seed + 1);
+  std::uniform_int_distribution<uint32_t> weight(0, max_weight);
+  for (uint32_t i = 0; i < 20; ++i) {
+    const auto e = ee[i * 97 % m];
+    ee.push_back({e.source_id, e.target_id, static_cast<EV>(weight(rng))});
+  }
+  sort_by_source(ee);
+  return ee;
+}
+
+// A w x h grid with edges both ways between neighbors, of weight 1 plus a random extra
+edge_list<uint32_t> grid_edges(uint32_t w, uint32_t h, uint32_t seed = 50) {
+  std::mt19937                            rng(seed);
+  std::uniform_int_distribution<uint32_t> extra(0, 3);
+  edge_list<uint32_t>                     ee;
+  auto                                    both = [&](uint32_t u, uint32_t v) {
+    const uint32_t weight = 1 + extra(rng);
+    ee.push_back({u, v, weight});
+    ee.push_back({v, u, weight});
+  };
+  for (uint32_t y = 0; y < h; ++y)
+    for (uint32_t x = 0; x < w; ++x) {
+      if (x + 1 < w)
+        both(y * w + x, y * w + x + 1);
+      if (y + 1 < h)
+        both(y * w + x, (y + 1) * w + x);
+    }
+  sort_by_source(ee);
+  return ee;
+}
+
+template <class D, class G>
+std::vector<D> reference_distances(G& g, uint32_t s) {
+  std::vector<D>        dist(num_vertices(g));
+  std::vector<uint32_t> pred(num_vertices(g));
+  dijkstra_shortest_paths(g, s, dist, pred);
+  return dist;
+}
+
+// The path runs from s to t along edges whose least weights add up to distance
+template <class D, class EE>
+void require_path(const EE& ee, const std::vector<uint32_t>& path, uint32_t s, uint32_t t, D distance) {
+  REQUIRE(!path.empty());
+  REQUIRE(path.front() == s);
+  REQUIRE(path.back() == t);
+  D length = 0;
+  for (size_t i = 0; i + 1 < path.size(); ++i) {
+    D least = shortest_path_infinite_distance<D>();
+    for (auto& e : ee)
+      if (e.source_id == path[i] && e.target_id == path[i + 1])
+        least = std::min(least, static_cast<D>(e.value));
+    REQUIRE(least != shortest_path_infinite_distance<D>());
+    length += least;
+  }
+  REQUIRE(length == distance);
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("shortest_path matches Dijkstra", "[algorithm][shortest_path]", bidir_double, csr_double) {
+  using G = TestType;
+
+  const uint32_t                          n  = 1500;
+  const auto                              ee = parallel_edges<double>(n, 4000, 20, 50);
+  G                                       g  = make_graph<G>(ee, n);
+  std::mt19937                            rng(3);
+  std::uniform_int_distribution<uint32_t> pick(0, n - 1);
+  if constexpr (is_compressed_graph_v<G>)
+    g.build_in_edges();
+
+  // One state for every query, bidirectional and A*
+  shortest_path_state<double> state;
+  size_t                      unreached = 0;
+  for (int q = 0; q < 60; ++q) {
+    const uint32_t s = pick(rng), t = q % 10 == 0 ? s : pick(rng);
+    const auto     expected = reference_distances<double>(g, s);
+
+    const double d = shortest_path(g, s, t, state);
+    REQUIRE(d == expected[t]);
+    REQUIRE(state.distance() == d);
+    if (d == shortest_path_infinite_distance<double>()) {
+      REQUIRE(state.path().empty());
+      ++unreached;
+    } else {
+      require_path(ee, state.path(), s, t, d);
+    }
+
+    // A* with no estimate is Dijkstra
+    REQUIRE(astar_shortest_path(g, s, t, state, [](uint32_t) { return 0.0; }) == expected[t]);
+    if (expected[t] != shortest_path_infinite_distance<double>())
+      require_path(ee, state.path(), s, t, expected[t]);
+  }
+  REQUIRE(unreached < 30);
+}
+
+TEST_CASE("shortest_path and A* on a grid", "[algorithm][shortest_path]") {
+  const uint32_t w = 60, h = 40, n = w * h;
+  const auto     ee = grid_edges(w, h);
+  vov_uint       g;
+  g.load_edges(ee, std::identity(), n);
+
+  shortest_path_state<uint64_t> state(n);
+  for (auto [s, t] : {std::pair<uint32_t, uint32_t>{0, n - 1}, {w - 1, n - w}, {1234, 1300}, {17, 17}}) {
+    const auto expected = reference_distances<uint64_t>(g, s);
+
+    // Symmetric: the backward search uses the out-edges
+    REQUIRE(shortest_path(g, s, t, state, {.symmetric = true}) == expected[t]);
+    require_path(ee, state.path(), s, t, expected[t]);
+    const size_t bidirectional_settled = state.settled();
+    if (s == 1234)
+      REQUIRE(bidirectional_settled < n / 20); // a nearby target touches a small part of the grid
+
+    // Every edge weighs at least 1, so the Manhattan distance is a consistent heuristic
+    auto manhattan = [&](uint32_t v) {
+      return static_cast<uint64_t>(std::abs(static_cast<int>(v % w) - static_cast<int>(t % w)) +
+                                   std::abs(static_cast<int>(v / w) - static_cast<int>(t / w)));
+    };
+    REQUIRE(astar_shortest_path(g, s, t, state, manhattan) == expected[t]);
+    require_path(ee, state.path(), s, t, expected[t]);
+    REQUIRE(state.settled() <= bidirectional_settled + n / 4);
+
+    // With the exact distance to t as the heuristic, only vertices on shortest paths are settled
+    const auto to_t = reference_distances<uint64_t>(g, t);
+    REQUIRE(astar_shortest_path(g, s, t, state, [&](uint32_t v) { return to_t[v]; }) == expected[t]);
+    size_t on_shortest_paths = 0;
+    for (uint32_t v = 0; v < n; ++v)
+      on_shortest_paths += expected[v] + to_t[v] == expected[t];
+    REQUIRE(state.settled() >= state.path().size());
+    REQUIRE(state.settled() <= on_shortest_paths);
+  }
+}
+
+TEST_CASE("shortest_path reuses state, and errors", "[algorithm][shortest_path]") {
+  //  0 -> 1 -> 2 -> 3 with a shortcut 0 -> 2, and 4 alone
+  const edge_list<int> ee{{0, 1, 1}, {0, 2, 5}, {1, 2, 1}, {2, 3, 2}, {4, 4, 1}};
+  dynamic_graph<int, void, void, uint32_t, false, vov_bidirectional_graph_traits<int, void, void, uint32_t, false>> g;
+  g.load_edges(ee, std::identity(), 5);
+
+  shortest_path_state<int> state;
+  REQUIRE(shortest_path(g, 0u, 3u, state) == 4);
+  REQUIRE(state.path() == std::vector<uint32_t>{0, 1, 2, 3});
+  REQUIRE(shortest_path(g, 3u, 0u, state) == shortest_path_infinite_distance<int>());
+  REQUIRE(state.path().empty());
+  REQUIRE(shortest_path(g, 2u, 2u, state) == 0);
+  REQUIRE(state.path() == std::vector<uint32_t>{2});
+  REQUIRE(shortest_path(g, 1u, 3u, state, [](auto&&) { return 1; }) == 2);
+  REQUIRE(state.path() == std::vector<uint32_t>{1, 2, 3});
+  REQUIRE(astar_shortest_path(g, 0u, 4u, state, [](uint32_t) { return 0; }) == shortest_path_infinite_distance<int>());
+
+  // The state grows for a larger graph, and keeps its size for a smaller one
+  dynamic_graph<int, void, void, uint32_t, false, vov_bidirectional_graph_traits<int, void, void, uint32_t, false>> big;
+  big.load_edges(edge_list<int>{{0, 1, 1}, {1, 2, 1}, {2, 3, 2}, {3, 40, 1}, {40, 41, 1}}, std::identity(), 50);
+  REQUIRE(shortest_path(big, 0u, 41u, state) == 6);
+  REQUIRE(state.path() == std::vector<uint32_t>{0, 1, 2, 3, 40, 41});
+  REQUIRE(shortest_path(g, 0u, 3u, state) == 4);
+  REQUIRE(astar_shortest_path(g, 4u, 3u, state, [](uint32_t) { return 0; }) == shortest_path_infinite_distance<int>());
+  // Distances left from the query on big are stale, not reached
+  REQUIRE(shortest_path(big, 40u, 3u, state) == shortest_path_infinite_distance<int>());
+  REQUIRE(state.path().empty());
+  REQUIRE(astar_shortest_path(big, 1u, 41u, state, [](uint32_t) { return 0; }) == 5);
+
+  REQUIRE_THROWS_AS(shortest_path(g, 0u, 5u, state), graph_error);
+  REQUIRE_THROWS_AS(astar_shortest_path(g, 5u, 0u, state, [](uint32_t) { return 0; }), graph_error);
+  REQUIRE_THROWS_AS(shortest_path(g, 0u, 3u, state, [](auto&&) { return -1; }), graph_error);
+
+  // No in-edges and not symmetric
+  csr_double csr(edge_list<double>{{0, 1, 1.0}});
+  shortest_path_state<double> csr_state;
+  REQUIRE_THROWS_AS(shortest_path(csr, 0u, 1u, csr_state), graph_error);
+  REQUIRE(astar_shortest_path(csr, 0u, 1u, csr_state, [](uint32_t) { return 0.0; }) == 1.0);
+}
@@ -0,0 +1,179 @@
+/**
+ * @file test_strongly_connected_components.cpp
+ * @brief Tests for the sequential and parallel strongly_connected_components
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/strongly_connected_components.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/traits/vov_bidirectional_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_g   = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using bidir_g = dynamic_graph<void, void, void, uint32_t, false,
+                              vov_bidirectional_graph_traits<void, void, void, uint32_t, false>>;
+using csr_g   = compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<>;
+
+namespace {
+// Random directed edges, sparse enough to leave many small components beside a giant one, with
+// a few self-loops and duplicates, sorted by source
+edge_list sparse_edges(uint32_t n, uint32_t m, uint32_t seed) {
+  edge_list ee = random_edges(n, m, seed);
+  for (uint32_t i = 0; i < 20; ++i) {
+    const uint32_t v = (i * 7919u + seed) % n;
+    ee.push_back({v, v});
+    ee.push_back(ee[i * 97 % m]);
+  }
+  sort_by_source(ee);
+  return ee;
+}
+
+// Components by Kosaraju, labeled with their least vertex id
+std::vector<uint32_t> reference_components(const edge_list& ee, uint32_t n) {
+  std::vector<std::vector<uint32_t>> out(n), in(n);
+  for (auto& e : ee) {
+    out[e.source_id].push_back(e.target_id);
+    in[e.target_id].push_back(e.source_id);
+  }
+  // Postorder of an iterative DFS over the out-edges
+  std::vector<uint32_t>                    finished;
+  std::vector<bool>                        seen(n, false);
+  std::vector<std::pair<uint32_t, size_t>> stack;
+  for (uint32_t root = 0; root < n; ++root) {
+    if (seen[root])
+      continue;
+    seen[root] = true;
+    stack.push_back({root, 0});
+    while (!stack.empty()) {
+      auto& [v, i] = stack.back();
+      if (i < out[v].size()) {
+        const uint32_t w = out[v][i++];
+        if (!seen[w]) {
+          seen[w] = true;
+          stack.push_back({w, 0});
+        }
+      } else {
+        finished.push_back(v);
+        stack.pop_back();
+      }
+    }
+  }
+  // Reverse postorder over the in-edges; each search is one component
+  std::vector<uint32_t> comp(n, n);
+  for (auto it = finished.rbegin(); it != finished.rend(); ++it) {
+    if (comp[*it] != n)
+      continue;
+    std::vector<uint32_t> members{*it}, todo{*it};
+    comp[*it] = *it;
+    while (!todo.empty()) {
+      const uint32_t v = todo.back();
+      todo.pop_back();
+      for (uint32_t u : in[v])
+        if (comp[u] == n) {
+          comp[u] = *it;
+          members.push_back(u);
+          todo.push_back(u);
+        }
+    }
+    const uint32_t least = *std::ranges::min_element(members);
+    for (uint32_t v : members)
+      comp[v] = least;
+  }
+  return comp;
+}
+
+size_t count_components(const std::vector<uint32_t>& comp) {
+  size_t count = 0;
+  for (uint32_t v = 0; v < comp.size(); ++v)
+    count += comp[v] == v;
+  return count;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("strongly_connected_components matches Kosaraju",
+                   "[algorithm][strongly_connected_components]",
+                   vov_g,
+                   bidir_g,
+                   csr_g) {
+  using G = TestType;
+
+  for (uint32_t m : {3000u, 4000u, 9000u}) {
+    const uint32_t  n  = 3000;
+    const edge_list ee = sparse_edges(n, m, 45);
+    G               g  = make_graph<G>(ee, n);
+    if constexpr (std::is_same_v<G, csr_g>)
+      g.build_in_edges();
+
+    const std::vector<uint32_t> expected = reference_components(ee, n);
+    const size_t                count    = count_components(expected);
+
+    std::vector<uint32_t> comp(n);
+    REQUIRE(strongly_connected_components(g, comp) == count);
+    REQUIRE(comp == expected);
+
+    if constexpr (!std::is_same_v<G, vov_g>) {
+      std::vector<int> parallel(n, -1);
+      REQUIRE(strongly_connected_components(g, parallel, {.parallel = true}) == count);
+      REQUIRE(std::ranges::equal(parallel, expected));
+    }
+  }
+}
+
+TEST_CASE("strongly_connected_components on small graphs", "[algorithm][strongly_connected_components]") {
+  SECTION("two cycles joined one way, a self-loop and an isolated vertex") {
+    // Cycle 3->1->2->3, cycle 0->4->0, edge 4->1, self-loop on 5, 6 isolated
+    csr_g g(edge_list{{0, 4}, {1, 2}, {2, 3}, {3, 1}, {4, 0}, {4, 1}, {5, 5}, {6, 6}});
+    g.build_in_edges();
+    std::vector<int> comp(7);
+    for (bool parallel : {false, true}) {
+      REQUIRE(strongly_connected_components(g, comp, {.parallel = parallel}) == 4);
+      REQUIRE(comp == std::vector<int>{0, 1, 1, 1, 0, 5, 6});
+    }
+  }
+
+  SECTION("a long cycle and a long path don't recurse") {
+    const uint32_t n = 200000;
+    edge_list      ee;
+    for (uint32_t v = 0; v + 1 < n; ++v)
+      ee.push_back({v, v + 1});
+    vov_g path;
+    path.load_edges(ee, std::identity(), n);
+    std::vector<uint32_t> comp(n);
+    REQUIRE(strongly_connected_components(path, comp) == n);
+
+    ee.push_back({n - 1, 0});
+    bidir_g cycle;
+    cycle.load_edges(ee, std::identity(), n);
+    for (bool parallel : {false, true}) {
+      REQUIRE(strongly_connected_components(cycle, comp, {.parallel = parallel}) == 1);
+      REQUIRE(std::ranges::count(comp, 0u) == n);
+    }
+  }
+
+  SECTION("errors and an empty graph") {
+    csr_g            empty;
+    std::vector<int> none;
+    REQUIRE(strongly_connected_components(empty, none) == 0);
+
+    csr_g            g(edge_list{{0, 1}, {1, 0}});
+    std::vector<int> one(1), two(2);
+    REQUIRE_THROWS_AS(strongly_connected_components(g, one), graph_error);
+    REQUIRE_THROWS_AS(strongly_connected_components(g, two, {.parallel = true}), graph_error);
+    vov_g h;
+    h.load_edges(edge_list{{0, 1}, {1, 0}}, std::identity(), 2);
+    REQUIRE_THROWS_AS(strongly_connected_components(h, two, {.parallel = true}), graph_error);
+    g.build_in_edges();
+    REQUIRE(strongly_connected_components(g, two, {.parallel = true}) == 1);
+  }
+}
@@ -0,0 +1,122 @@
+/**
+ * @file test_topological_sort.cpp
+ * @brief Tests for the parallel topological_sort and dag_levels
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/topological_sort.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_g = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using csr_g = compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<>;
+
+namespace {
+// Random edges that go forward in a shuffled order of the vertices, sorted by source
+edge_list random_dag_edges(uint32_t n, uint32_t m, uint32_t seed) {
+  std::mt19937          rng(seed);
+  std::vector<uint32_t> rank(n);
+  std::iota(rank.begin(), rank.end(), 0u);
+  std::ranges::shuffle(rank, rng);
+  edge_list ee;
+  for (auto& e : random_edges(n, m, seed + 1))
+    if (e.source_id != e.target_id)
+      ee.push_back({rank[std::min(e.source_id, e.target_id)], rank[std::max(e.source_id, e.target_id)]});
+  sort_by_source(ee);
+  return ee;
+}
+
+// Longest path to each vertex, by relaxing the edges until nothing changes
+std::vector<uint32_t> reference_levels(const edge_list& ee, uint32_t n) {
+  std::vector<uint32_t> level(n, 0);
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (auto& e : ee)
+      if (level[e.target_id] < level[e.source_id] + 1) {
+        level[e.target_id] = level[e.source_id] + 1;
+        changed            = true;
+      }
+  }
+  return level;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("topological_sort and dag_levels on a random DAG", "[algorithm][topological_sort]", vov_g, csr_g) {
+  using G = TestType;
+
+  const uint32_t  n  = 5000;
+  const edge_list ee = random_dag_edges(n, 20000, 3);
+  G               g  = make_graph<G>(ee, n);
+
+  std::vector<uint32_t> order(n);
+  topological_sort(g, order);
+
+  std::vector<uint32_t> position(n, n);
+  for (uint32_t i = 0; i < n; ++i)
+    position.at(order[i]) = i;
+  REQUIRE(std::ranges::find(position, n) == position.end()); // a permutation
+  for (auto& e : ee)
+    REQUIRE(position[e.source_id] < position[e.target_id]);
+
+  const std::vector<uint32_t> expected = reference_levels(ee, n);
+  std::vector<uint64_t>       levels(n);
+  const size_t                depth = dag_levels(g, levels);
+  REQUIRE(std::ranges::equal(levels, expected));
+  REQUIRE(depth == size_t{*std::ranges::max_element(expected)} + 1);
+
+  // Ordered by level, then by id
+  for (uint32_t i = 0; i + 1 < n; ++i)
+    REQUIRE(std::pair(levels[order[i]], order[i]) < std::pair(levels[order[i + 1]], order[i + 1]));
+}
+
+TEST_CASE("topological_sort and dag_levels report cycles", "[algorithm][topological_sort]") {
+  std::vector<int> out(5);
+
+  SECTION("a cycle downstream of a source") {
+    // 0 -> 1 -> 2 -> 3 -> 1, 4 isolated
+    csr_g g(edge_list{{0, 1}, {1, 2}, {2, 3}, {3, 1}, {4, 4}});
+    REQUIRE_THROWS_AS(topological_sort(g, out), graph_error);
+    REQUIRE_THROWS_AS(dag_levels(g, out), graph_error);
+  }
+
+  SECTION("a self-loop") {
+    vov_g g;
+    g.load_edges(edge_list{{0, 1}, {2, 2}}, std::identity(), 5);
+    REQUIRE_THROWS_AS(topological_sort(g, out), graph_error);
+    REQUIRE_THROWS_AS(dag_levels(g, out), graph_error);
+  }
+
+  SECTION("no cycle") {
+    // Diamond 0 -> {1,2} -> 3, with a shortcut 0 -> 3; 4 isolated
+    vov_g g;
+    g.load_edges(edge_list{{0, 1}, {0, 2}, {0, 3}, {1, 3}, {2, 3}}, std::identity(), 5);
+    topological_sort(g, out);
+    REQUIRE(out == std::vector<int>{0, 4, 1, 2, 3});
+    REQUIRE(dag_levels(g, out) == 3);
+    REQUIRE(out == std::vector<int>{0, 1, 1, 2, 0});
+  }
+
+  SECTION("empty graph and a too small output") {
+    csr_g            empty;
+    std::vector<int> none;
+    topological_sort(empty, none);
+    REQUIRE(dag_levels(empty, none) == 0);
+
+    csr_g g(edge_list{{0, 1}, {1, 2}});
+    REQUIRE_THROWS_AS(topological_sort(g, std::vector<int>(2)), graph_error);
+    REQUIRE_THROWS_AS(dag_levels(g, std::vector<int>(2)), graph_error);
+  }
+}
@@ -0,0 +1,171 @@
+/**
+ * @file test_triangle_count.cpp
+ * @brief Tests for the parallel triangle_count
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <graph/algorithm/triangle_count.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include "algorithm_test_graphs.hpp"
+#include <algorithm>
+#include <set>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+using namespace graph::test;
+
+using vov_g = dynamic_graph<void, void, void, uint32_t, false, vov_graph_traits<void, void, void, uint32_t, false>>;
+using csr_g = compressed_graph<void, void, void, uint32_t, uint32_t>;
+
+using edge_list = edge_list_t<>;
+
+namespace {
+// Random undirected edges stored in both directions, plus a few hubs so the degrees are skewed,
+// sorted by source only so the rows of vov_g are not in target order
+edge_list hub_edges(uint32_t n, uint32_t m, uint32_t seed) {
+  edge_list ee = random_symmetric_edges(n, m, seed);
+  for (uint32_t hub = 0; hub < 3; ++hub)
+    for (uint32_t v = 0; v < n; v += 2 + hub) {
+      ee.push_back({hub, v});
+      ee.push_back({v, hub});
+    }
+  sort_by_source(ee);
+  return ee;
+}
+
+// The edges with each row sorted by target, as compressed_graph rows are expected to be
+edge_list sorted_rows(edge_list ee) {
+  std::ranges::sort(ee, [](auto& a, auto& b) { return std::tie(a.source_id, a.target_id) < std::tie(b.source_id, b.target_id); });
+  return ee;
+}
+
+// Triangles through each vertex, by checking every pair of neighbors
+std::vector<size_t> reference_counts(const edge_list& ee, uint32_t n) {
+  std::vector<std::set<uint32_t>> adj(n);
+  for (auto& e : ee)
+    if (e.source_id != e.target_id)
+      adj[e.source_id].insert(e.target_id);
+  std::vector<size_t> counts(n, 0);
+  for (uint32_t u = 0; u < n; ++u)
+    for (uint32_t v : adj[u])
+      for (uint32_t w : adj[u])
+        if (v < w && adj[v].contains(w))
+          ++counts[u];
+  return counts;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("triangle_count matches a brute-force count", "[algorithm][triangle_count]", vov_g, csr_g) {
+  using G = TestType;
+
+  for (uint32_t seed : {1u, 2u, 3u}) {
+    const uint32_t  n  = 600;
+    const edge_list ee = hub_edges(n, 6000, seed);
+    G               g  = make_graph<G>(is_compressed_graph_v<G> ? sorted_rows(ee) : ee, n);
+
+    const std::vector<size_t> expected = reference_counts(ee, n);
+    size_t                    total    = 0;
+    for (size_t c : expected)
+      total += c;
+    REQUIRE(total % 3 == 0);
+    REQUIRE(total > 0);
+
+    REQUIRE(triangle_count(g) == total / 3);
+
+    std::vector<uint64_t> local(n, 99);
+    REQUIRE(triangle_count(g, local) == total / 3);
+    REQUIRE(std::ranges::equal(local, expected));
+  }
+}
+
+TEST_CASE("for_each_common merges and gallops", "[algorithm][triangle_count]") {
+  std::vector<uint32_t> evens, sparse;
+  for (uint32_t x = 0; x < 4000; x += 2)
+    evens.push_back(x);
+  for (uint32_t x : {0u, 3u, 64u, 1001u, 1998u, 3998u, 4000u, 5000u})
+    sparse.push_back(x);
+
+  auto common = [](const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+    std::vector<uint32_t> out;
+    graph::detail::for_each_common(std::span<const uint32_t>(a), std::span<const uint32_t>(b), [&](uint32_t x) { out.push_back(x); });
+    return out;
+  };
+  const std::vector<uint32_t> expected{0, 64, 1998, 3998};
+  REQUIRE(common(sparse, evens) == expected); // galloping
+  REQUIRE(common(evens, sparse) == expected);
+
+  std::vector<uint32_t> threes;
+  for (uint32_t x = 0; x < 4000; x += 3)
+    threes.push_back(x);
+  std::vector<uint32_t> sixes;
+  for (uint32_t x = 0; x < 4000; x += 6)
+    sixes.push_back(x);
+  REQUIRE(common(evens, threes) == sixes); // merging
+  REQUIRE(common(evens, {}).empty());
+}
+
+TEST_CASE("triangle_count on small graphs", "[algorithm][triangle_count]") {
+  auto complete = [](uint32_t k) {
+    edge_list ee;
+    for (uint32_t u = 0; u < k; ++u)
+      for (uint32_t v = 0; v < k; ++v)
+        if (u != v)
+          ee.push_back({u, v});
+    return ee;
+  };
+
+  SECTION("complete graph") {
+    csr_g            g(complete(6));
+    std::vector<int> local(6);
+    REQUIRE(triangle_count(g, local) == 20);
+    REQUIRE(local == std::vector<int>(6, 10));
+  }
+
+  SECTION("self-loops and duplicate edges are ignored") {
+    edge_list ee = complete(3);
+    ee.push_back({0, 0});
+    ee.push_back({0, 1});
+    ee.push_back({1, 0});
+    ee.push_back({2, 2});
+    csr_g            g(sorted_rows(ee));
+    std::vector<int> local(3);
+    REQUIRE(triangle_count(g, local) == 1);
+    REQUIRE(local == std::vector<int>{1, 1, 1});
+  }
+
+  SECTION("a star whose hub is in two triangles") {
+    // Hub 0 joined to 1..1000, and to the edges 1-2 and 999-1000
+    edge_list ee;
+    auto      add = [&](uint32_t u, uint32_t v) {
+      ee.push_back({u, v});
+      ee.push_back({v, u});
+    };
+    for (uint32_t v = 1; v <= 1000; ++v)
+      add(0, v);
+    add(1, 2);
+    add(999, 1000);
+    vov_g g;
+    g.load_edges(ee, std::identity(), 1001);
+    std::vector<uint32_t> local(1001);
+    REQUIRE(triangle_count(g, local) == 2);
+    REQUIRE(local.at(0) == 2);
+    REQUIRE(local.at(1) == 1);
+    REQUIRE(local.at(1000) == 1);
+    REQUIRE(local.at(500) == 0);
+  }
+
+  SECTION("empty graph and a too small output") {
+    csr_g g;
+    REQUIRE(triangle_count(g) == 0);
+    std::vector<int> none;
+    REQUIRE(triangle_count(g, none) == 0);
+
+    csr_g            k4(complete(4));
+    std::vector<int> small(3);
+    REQUIRE_THROWS_AS(triangle_count(k4, small), graph_error);
+  }
+}
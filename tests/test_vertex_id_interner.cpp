@@ -0,0 +1,166 @@
+/**
+ * @file test_vertex_id_interner.cpp
+ * @brief Tests for vertex_id_interner, which maps external vertex keys to dense vertex ids
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <graph/container/vertex_id_interner.hpp>
+#include <graph/container/traits/vov_graph_traits.hpp>
+#include <graph/container/dynamic_graph.hpp>
+#include <graph/container/compressed_graph.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace graph;
+using namespace graph::container;
+
+namespace {
+struct route {
+  std::string from;
+  std::string to;
+  int         miles;
+};
+
+const std::vector<route> routes = {
+      {"Frankfurt", "Mannheim", 85},  {"Frankfurt", "Wurzburg", 217}, {"Frankfurt", "Kassel", 173},
+      {"Mannheim", "Karlsruhe", 80},  {"Wurzburg", "Erfurt", 186},    {"Wurzburg", "Nurnberg", 103},
+      {"Karlsruhe", "Augsburg", 250}, {"Nurnberg", "Stuttgart", 183}, {"Kassel", "Munchen", 502},
+};
+
+auto route_edge = [](const route& r) { return copyable_edge_t<std::string, int>{r.from, r.to, r.miles}; };
+} // namespace
+
+TEST_CASE("vertex_id_interner intern and lookup", "[interner]") {
+  vertex_id_interner<std::string> ids;
+  REQUIRE(ids.empty());
+
+  REQUIRE(ids.intern("a") == 0);
+  REQUIRE(ids.intern("b") == 1);
+  REQUIRE(ids.intern("a") == 0);
+  REQUIRE(ids.size() == 2);
+  REQUIRE(ids.key(1) == "b");
+  REQUIRE(ids.find("b") == 1u);
+  REQUIRE_FALSE(ids.find("c").has_value());
+  REQUIRE_FALSE(ids.contains("c"));
+
+  vertex_id_interner<std::string> moved = std::move(ids);
+  REQUIRE(moved.intern("c") == 2);
+  REQUIRE(moved.keys() == std::vector<std::string>{"a", "b", "c"});
+
+  // The moved-from interner is empty and can be used again
+  REQUIRE(ids.empty());
+  REQUIRE(ids.size() == 0);
+  REQUIRE_FALSE(ids.find("a"));
+  REQUIRE(ids.intern("z") == 0);
+  ids = std::move(moved);
+  REQUIRE(ids.size() == 3);
+  REQUIRE(moved.empty());
+  moved = std::move(ids);
+
+  moved.clear();
+  REQUIRE(moved.empty());
+  REQUIRE(moved.intern("c") == 0);
+}
+
+TEST_CASE("vertex_id_interner overflow", "[interner]") {
+  vertex_id_interner<int, uint8_t> ids;
+  for (int i = 0; i < 256; ++i)
+    REQUIRE(ids.intern(i * 1000) == static_cast<uint8_t>(i));
+  REQUIRE_THROWS_AS(ids.intern(-1), std::overflow_error);
+  REQUIRE(ids.size() == 256);
+
+  vertex_id_interner<int, uint8_t> bulk;
+  std::vector<int>                 keys(300);
+  for (int i = 0; i < 300; ++i)
+    keys[static_cast<size_t>(i)] = i;
+  REQUIRE_THROWS_AS(bulk.intern_all(keys), std::overflow_error);
+  REQUIRE(bulk.empty());
+}
+
+TEST_CASE("vertex_id_interner bulk intern matches sequential order", "[interner][parallel]") {
+  // Sparse 64-bit keys with many repeats, large enough to be split across workers
+  std::vector<uint64_t> keys;
+  for (uint64_t i = 0; i < 200000; ++i)
+    keys.push_back(((i * 7919) % 25013) << 32 | 0xABCDu);
+
+  vertex_id_interner<uint64_t> seq;
+  for (uint64_t k : keys)
+    seq.intern(k);
+
+  vertex_id_interner<uint64_t> bulk;
+  bulk.intern(keys[100]); // already interned keys keep their id
+  bulk.intern_all(keys);
+  REQUIRE(bulk.size() == seq.size());
+  REQUIRE(bulk.key(0) == keys[100]);
+  for (uint64_t k : keys)
+    REQUIRE(bulk.find(k).has_value());
+
+  vertex_id_interner<uint64_t> bulk2;
+  bulk2.intern_all(keys);
+  REQUIRE(bulk2.keys() == seq.keys());
+}
+
+TEST_CASE("vertex_id_interner concurrent intern", "[interner][parallel]") {
+  vertex_id_interner<uint64_t> ids;
+  std::vector<std::thread>     threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([&ids] {
+      for (uint64_t k = 0; k < 5000; ++k)
+        ids.intern(k * 31);
+    });
+  for (auto& t : threads)
+    t.join();
+
+  REQUIRE(ids.size() == 5000);
+  for (uint64_t k = 0; k < 5000; ++k) {
+    auto id = ids.find(k * 31);
+    REQUIRE(id.has_value());
+    REQUIRE(ids.key(*id) == k * 31);
+  }
+}
+
+TEST_CASE("vertex_id_interner feeds load_edges", "[interner][dynamic_graph][compressed_graph]") {
+  vertex_id_interner<std::string> ids;
+  ids.intern_edges(routes, route_edge);
+  REQUIRE(ids.size() == 10);
+  REQUIRE(ids.key(0) == "Frankfurt");
+  REQUIRE(ids.key(1) == "Mannheim");
+
+  SECTION("dynamic_graph") {
+    using G = dynamic_graph<int, void, void, uint32_t, false, vov_graph_traits<int, void, void, uint32_t, false>>;
+    G g;
+    g.load_edges(routes, ids.edge_projection(route_edge), ids.size());
+    REQUIRE(num_vertices(g) == 10);
+    REQUIRE(num_edges(g) == routes.size());
+
+    auto frankfurt = *find_vertex(g, *ids.find("Frankfurt"));
+    std::vector<std::string> reached;
+    for (auto uv : edges(g, frankfurt))
+      reached.push_back(ids.key(target_id(g, uv)));
+    REQUIRE(reached == std::vector<std::string>{"Mannheim", "Wurzburg", "Kassel"});
+  }
+
+  SECTION("compressed_graph") {
+    // compressed_graph needs edges ordered by source id
+    std::vector<copyable_edge_t<uint32_t, int>> ee;
+    auto                                        proj = ids.edge_projection(route_edge);
+    for (auto& r : routes)
+      ee.push_back(proj(r));
+    std::ranges::sort(ee, {}, [](auto& e) { return e.source_id; });
+
+    compressed_graph<int, void, void, uint32_t, uint32_t> g(ee);
+    REQUIRE(num_edges(g) == routes.size());
+    auto kassel = *find_vertex(g, *ids.find("Kassel"));
+    REQUIRE(ids.key(target_id(g, *edges(g, kassel).begin())) == "Munchen");
+  }
+
+  SECTION("projection interns unseen keys") {
+    vertex_id_interner<std::string> fresh;
+    auto                            proj = fresh.edge_projection(route_edge);
+    auto                            e    = proj(routes[0]);
+    REQUIRE(e.source_id == 0);
+    REQUIRE(e.target_id == 1);
+    REQUIRE(e.value == 85);
+  }
+}